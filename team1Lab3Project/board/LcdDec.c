@@ -0,0 +1,62 @@
+/****************************************************************************************
+* LcdDec.c - Decimal field formatting for LcdDispDecWord()
+*
+*            Turns a 32-bit word into the characters of a display field, so
+*            LcdDispDecWord() only holds the layer mutex to copy them in.
+*
+*            Split out of LcdLayered.c. The field limit is now a digit count
+*            instead of a floating point pow().
+****************************************************************************************/
+#include "MCUType.h"
+#include "LcdLayered.h"
+#include "LcdDec.h"
+
+/*************************************************************************
+  LcdDecFormat() - Fills chars with binword in a field of field digits,
+                   clamped to 1 to LCD_DEC_MAX_FIELD, and returns the
+                   number of characters written. See LcdDispDecWord()
+                   for the modes. A binword that needs more digits than
+                   field fills it with '-'.                       (Public)
+*************************************************************************/
+INT8U LcdDecFormat(INT8C *chars, INT32U binword, INT8U field, LCD_MODE mode){
+    INT8C digits[LCD_DEC_MAX_FIELD];
+    INT8U num_digits = 0;
+    INT8U pad;
+    INT8U i;
+
+    if(field > LCD_DEC_MAX_FIELD){
+        field = LCD_DEC_MAX_FIELD;
+    }else if(field < 1){
+        field = 1;
+    }else{
+    }
+
+    //Convert to ASCII, least significant digit first
+    do{
+        digits[num_digits] = (INT8C)((binword % 10) + '0');
+        binword = binword/10;
+        num_digits++;
+    }while(binword != 0);
+
+    if(num_digits > field){             //Writes '-' to all field slots if bin length exceeded
+        for(i = 0; i < field; i++){
+            chars[i] = '-';
+        }
+    }else if(mode == LCD_DEC_MODE_AL){  //digits first, then spaces
+        for(i = 0; i < num_digits; i++){
+            chars[i] = digits[num_digits-1-i];
+        }
+        for(; i < field; i++){
+            chars[i] = ' ';
+        }
+    }else{                              //zeros or spaces first, then digits
+        pad = field - num_digits;
+        for(i = 0; i < pad; i++){
+            chars[i] = (mode == LCD_DEC_MODE_LZ) ? '0' : ' ';
+        }
+        for(i = 0; i < num_digits; i++){
+            chars[field-1-i] = digits[i];
+        }
+    }
+    return field;
+}
@@ -0,0 +1,12 @@
+/****************************************************************************************
+* LcdDec.h - Header file for LcdDec.c
+*            Include LcdLayered.h first, for LCD_MODE.
+****************************************************************************************/
+#ifndef LCD_DEC_DEF
+#define LCD_DEC_DEF
+
+#define LCD_DEC_MAX_FIELD 10    /* digits in the largest INT32U */
+
+INT8U LcdDecFormat(INT8C *chars, INT32U binword, INT8U field, LCD_MODE mode);
+
+#endif
@@ -23,6 +23,7 @@
 * 03/09/2019 Changed parameters for LcdDispDecWord. Brad Cowgill
 * 03/13/2019 Changed LcdCursorDispMode() to be private, now lcdCursorDispMode(). BJC
 * 02/18/2020 Fixed col input error check. TDM
+* Digit conversion for LcdDispDecWord() moved to LcdDec.c, writes the field under the mutex.
 *****************************************************************************************
 * Header Files - Dependencies
 *****************************************************************************************/
@@ -31,7 +32,7 @@
 #include "MCUType.h"
 #include "LcdLayered.h"
 #include "K65TWR_GPIO.h"
-#include "math.h"
+#include "LcdDec.h"
 
 /*****************************************************************************************
 * LCD Port Defines 
@@ -418,90 +419,36 @@ void LcdDispDecWord(INT8U row,
                     INT8U field,
                     LCD_MODE mode){
     OS_ERR os_err;
-    INT8C digits[10];
-    INT32U lbinword = binword;
-    INT8U num_zeros = field;
-    INT32U max_field_num;
-    INT8U dig_num;
-    INT8U zero_flag = 0;
-    INT8U align_left_offset;
-    INT8U align_left_flag = 0;
-
+    INT8C chars[LCD_DEC_MAX_FIELD];
+    INT8U num_chars;
+    INT8U cnt;
     INT8U row_index;
     INT8U col_index;
     LCD_BUFFER *llayer = &lcdLayers[layer];
 
-    if((col) <= LCD_NUM_COLS){
+    if((row >= 1) && (row <= LCD_NUM_ROWS) && (col >= 1) && (col <= LCD_NUM_COLS)){
         //Convert row / col index 1 to index 0
         row_index = row - 1;
         col_index = col - 1;
 
-        //Clamp leading zeros to acceptable values
-        if(num_zeros > 10){
-            num_zeros = 10;
-        }else if(num_zeros < 1){
-            num_zeros = 1;
-        }else{
-        }
-    }else{
-    }
-
-    //Calculates maximum bin parameter
-    max_field_num = pow(10,field) - 1;
-    if(lbinword > max_field_num){  //Writes '-' to all field slots if bin length exceeded
-        while(num_zeros != 0){
-            llayer->lcd_char[row_index][col_index+field-num_zeros] = '-';
-            num_zeros--;
-        }
-        num_zeros = field;
-    }else{
-
-        //Clears field before writing to avoid leftover characters
-        for(INT8U i = 0; i < field; i++){
-            llayer->lcd_char[row_index][col_index+i] = ' ';
-        }
-
-        //Convert to ASCII, find offset if in left align mode
-        dig_num = 0;
-        while(dig_num < 10){
-            digits[dig_num] = (INT8C)((lbinword % 10) +'0');
-            lbinword = lbinword/10;
-            dig_num++;
-            if(lbinword == 0 && mode == LCD_DEC_MODE_AL && align_left_flag != 1){ //Calculates offset for left align
-                align_left_offset = field - dig_num + 1;
-                align_left_flag = 1;
-            }else{
-            }
-        }
+        //Convert to ASCII before taking the layers
+        num_chars = LcdDecFormat(&chars[0], binword, field, mode);
 
         OSMutexPend(&lcdLayersKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err);
         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
         }
 
-        //Display ascii digits
-        dig_num = 9;
-        while(dig_num > 0){
-            if(((digits[dig_num] != '0') || (dig_num < num_zeros)) && mode == LCD_DEC_MODE_LZ){
-                llayer->lcd_char[row_index][col_index+field-1-dig_num] = digits[dig_num];
-            }else if(((digits[dig_num] != '0') || (zero_flag == 1)) && mode == LCD_DEC_MODE_AR){
-                zero_flag = 1;
-                llayer->lcd_char[row_index][col_index+field-1-dig_num] = digits[dig_num];
-            }else if(((digits[dig_num] != '0') || (zero_flag == 1)) && mode == LCD_DEC_MODE_AL){
-                zero_flag = 1;
-                llayer->lcd_char[row_index][col_index+field-dig_num-align_left_offset] = digits[dig_num];
-            }else{
+        for(cnt = 0; cnt < num_chars; cnt++){
+            if((col_index+cnt) < LCD_NUM_COLS){ // not at end of row
+                llayer->lcd_char[row_index][col_index+cnt] = chars[cnt];
+            }else{ //outside buffer
             }
-            dig_num--;
         }
 
-        if(mode == LCD_DEC_MODE_LZ || mode == LCD_DEC_MODE_AR){
-            llayer->lcd_char[row_index][col_index+field-1-dig_num] = digits[0];
-        }else if(mode == LCD_DEC_MODE_AL){
-            llayer->lcd_char[row_index][col_index+field-dig_num-align_left_offset] = digits[0];
-        }else{
-        }(void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
-         while(os_err != OS_ERR_NONE){           /* Error Trap                        */
-         }
+        (void)OSMutexPost(&lcdLayersKey, OS_OPT_POST_NONE, &os_err);
+        while(os_err != OS_ERR_NONE){           /* Error Trap                        */
+        }
+    }else{
     }
 
     //We have modified a layer
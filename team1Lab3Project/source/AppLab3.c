@@ -27,6 +27,8 @@
 #include "Pulsetrain.h"
 #include "K65TWR_GPIO.h"
 #include "Sinewave.h"
+#include "WaveAna.h"
+#include "SineAnalyzer.h"
 #include "EEPROM.h"
 
 
@@ -53,6 +55,8 @@ static INT16U confirm_checksum[sizeof(EEWaveData.eesettings) - 1];
 #define INPUT_SIZE 8
 #define MAX_INPUT 10000 //10kHz
 #define MIN_INPUT 10 //10Hz
+#define MAX_PULSE_INPUT WAVE_PWM_MAX_FREQ //500kHz
+#define MIN_PULSE_INPUT WAVE_PWM_MIN_FREQ //4Hz
 #define MAX_AMP 20
 #define MIN_AMP 0
 #define DEFAULT_FREQ 1000 //1000Hz
@@ -81,6 +85,7 @@ static CPU_STK TSICounterTaskStk[APP_CFG_TSI_CNTR_TASK_STK_SIZE];
 static void  appStartTask(void *p_arg);
 static void  appUITask(void *p_arg);
 static void TSICounterTask(void *p_arg);
+static void appSetOutputMode(OUT_MODES_T mode);
 /*****************************************************************************************
 * main()
 *****************************************************************************************/
@@ -134,6 +139,7 @@ static void appStartTask(void *p_arg){
    	KeyInit();
    	PulseWaveInit();
 	SineWaveInit();
+	SineAnalyzerInit();
 	TSIInit();
 	SPIInit();
 
@@ -189,13 +195,13 @@ static void appStartTask(void *p_arg){
 	} else {
 	}
 
-	if((EEWaveData.wave_inputs.sqrFreqValue > MAX_INPUT)) {
+	if((EEWaveData.wave_inputs.sqrFreqValue > MAX_PULSE_INPUT)) {
 		EEWaveData.wave_inputs.sineAmpValue = DEFAULT_AMP;
 		EEWaveData.wave_inputs.sqrCycleValue = DEFAULT_AMP;
 		EEWaveData.wave_inputs.sineFreqValue = DEFAULT_FREQ;
 		EEWaveData.wave_inputs.sqrFreqValue = DEFAULT_FREQ;
 		EEWaveData.wave_inputs.modeStateValue = SINE;
-	} else if((EEWaveData.wave_inputs.sineFreqValue < MIN_INPUT)) {
+	} else if((EEWaveData.wave_inputs.sqrFreqValue < MIN_PULSE_INPUT)) {
 		EEWaveData.wave_inputs.sineAmpValue = DEFAULT_AMP;
 		EEWaveData.wave_inputs.sqrCycleValue = DEFAULT_AMP;
 		EEWaveData.wave_inputs.sineFreqValue = DEFAULT_FREQ;
@@ -228,8 +234,9 @@ static void appStartTask(void *p_arg){
 	//Initialize the wave outputs with the correct settings
 	SetPulseFreq(EEWaveData.wave_inputs.sqrFreqValue);
 	SetPulseDuty(EEWaveData.wave_inputs.sqrCycleValue);
-	SetSinFreq(EEWaveData.wave_inputs.sineFreqValue);
-	SetSinAmp(EEWaveData.wave_inputs.sineAmpValue);
+	SetSinFreq(SINE_CH_DAC0, EEWaveData.wave_inputs.sineFreqValue);
+	SetSinAmp(SINE_CH_DAC0, EEWaveData.wave_inputs.sineAmpValue);
+	appSetOutputMode(EEWaveData.wave_inputs.modeStateValue);
 
 	switch(EEWaveData.wave_inputs.modeStateValue){
 	case(SINE):
@@ -320,6 +327,7 @@ static void appUITask(void *p_arg){
 									   (CPU_TS *)0, &os_err);
 			EEWaveData.wave_inputs.modeStateValue = SINE;
 			OSMutexPost(&appUserInputKey, OS_OPT_POST_NONE, &os_err);
+			appSetOutputMode(SINE);
 			LcdDispClear(LCD_LAYER_MODE);
 			LcdDispString(LCD_ROW_1,LCD_COL_13,LCD_LAYER_MODE,"SINE");
 		} else if (kchar == DC2){  //B Key has been pressed
@@ -327,6 +335,7 @@ static void appUITask(void *p_arg){
 									   (CPU_TS *)0, &os_err);
 			EEWaveData.wave_inputs.modeStateValue = PULSE;
 			OSMutexPost(&appUserInputKey, OS_OPT_POST_NONE, &os_err);
+			appSetOutputMode(PULSE);
 			LcdDispClear(LCD_LAYER_MODE);
 			LcdDispString(LCD_ROW_1,LCD_COL_12,LCD_LAYER_MODE,"PULSE");
 		} else if (kchar == DC3){
@@ -350,7 +359,14 @@ static void appUITask(void *p_arg){
 				} else {
 				}
 			}
-			if(dec_user_input >= MAX_INPUT){
+			if(EEWaveData.wave_inputs.modeStateValue == PULSE){
+				if(dec_user_input >= MAX_PULSE_INPUT){
+					dec_user_input = MAX_PULSE_INPUT;
+				} else if(dec_user_input <= MIN_PULSE_INPUT){
+					dec_user_input = MIN_PULSE_INPUT;
+				} else {
+				}
+			} else if(dec_user_input >= MAX_INPUT){
 				dec_user_input = MAX_INPUT;
 			} else if(dec_user_input <= MIN_INPUT){
 				dec_user_input = MIN_INPUT;
@@ -367,6 +383,7 @@ static void appUITask(void *p_arg){
 			EEWaveData.wave_inputs.sqrFreqValue = DEFAULT_FREQ;
 			EEWaveData.wave_inputs.modeStateValue = SINE;
 			OSMutexPost(&appUserInputKey, OS_OPT_POST_NONE, &os_err);
+			appSetOutputMode(SINE);
 			dec_user_input = 0;
 			LcdDispClear(LCD_LAYER_MODE);
 			LcdDispString(LCD_ROW_1,LCD_COL_13,LCD_LAYER_MODE,"SINE");
@@ -401,8 +418,8 @@ static void appUITask(void *p_arg){
 			LcdDispString(LCD_ROW_2,LCD_COL_7,LCD_LAYER_WAVE_DATA,"Hz");
 			LcdDispClrLine(LCD_ROW_2,LCD_LAYER_TSI_VALUE);
 			LcdDispDecWord(LCD_ROW_2,LCD_COL_15	,LCD_LAYER_TSI_VALUE,EEWaveData.wave_inputs.sineAmpValue, 2, LCD_DEC_MODE_LZ);
-			SetSinFreq(EEWaveData.wave_inputs.sineFreqValue);
-			SetSinAmp(EEWaveData.wave_inputs.sineAmpValue);
+			SetSinFreq(SINE_CH_DAC0, EEWaveData.wave_inputs.sineFreqValue);
+			SetSinAmp(SINE_CH_DAC0, EEWaveData.wave_inputs.sineAmpValue);
 			SetPulseDuty(EEWaveData.wave_inputs.sqrCycleValue);
 			SetPulseFreq(EEWaveData.wave_inputs.sqrFreqValue);
 			OSMutexPost(&appUserInputKey, OS_OPT_POST_NONE, &os_err);
@@ -433,8 +450,8 @@ static void appUITask(void *p_arg){
 					LcdDispDecWord(LCD_ROW_2,LCD_COL_14	,LCD_LAYER_TSI_VALUE,(5 * EEWaveData.wave_inputs.sqrCycleValue), 2, LCD_DEC_MODE_LZ);
 				}
 				LcdDispString(LCD_ROW_2,LCD_COL_16,LCD_LAYER_TSI_VALUE,"%");
-				SetSinFreq(EEWaveData.wave_inputs.sineFreqValue);
-				SetSinAmp(EEWaveData.wave_inputs.sineAmpValue);
+				SetSinFreq(SINE_CH_DAC0, EEWaveData.wave_inputs.sineFreqValue);
+				SetSinAmp(SINE_CH_DAC0, EEWaveData.wave_inputs.sineAmpValue);
 				SetPulseDuty(EEWaveData.wave_inputs.sqrCycleValue);
 				SetPulseFreq(EEWaveData.wave_inputs.sqrFreqValue);
 				OSMutexPost(&appUserInputKey, OS_OPT_POST_NONE, &os_err);
@@ -445,6 +462,17 @@ static void appUITask(void *p_arg){
 	}
 }
 
+/*****************************************************************************************
+* appSetOutputMode()-Private
+* Runs the output engine for mode and parks the other one, so only the output
+* in use takes CPU, timer and DMA time. Each engine keeps its settings and
+* picks up where it left off when switched back.
+*****************************************************************************************/
+static void appSetOutputMode(OUT_MODES_T mode){
+	SetSinEnable(mode == SINE);
+	SetPulseEnable(mode == PULSE);
+}
+
 /**************************************************************************************
  * TSICounterTask()-Private
  * Touchpad count increases by 1 if touchpad 1 is triggered, count decreases by 1 if
@@ -480,7 +508,7 @@ static void TSICounterTask(void *p_arg){
 	        case(SINE):
 	        	if(EEWaveData.wave_inputs.sineAmpValue < 20){
 	        		EEWaveData.wave_inputs.sineAmpValue++;
-	        		SetSinAmp(EEWaveData.wave_inputs.sineAmpValue);
+	        		SetSinAmp(SINE_CH_DAC0, EEWaveData.wave_inputs.sineAmpValue);
 	        	    LcdDispClrLine(LCD_ROW_2,LCD_LAYER_TSI_VALUE);
 	        		LcdDispDecWord(LCD_ROW_2,LCD_COL_15	,LCD_LAYER_TSI_VALUE,EEWaveData.wave_inputs.sineAmpValue, 2, LCD_DEC_MODE_LZ);
 	        	} else {
@@ -532,7 +560,7 @@ static void TSICounterTask(void *p_arg){
 	        case(SINE):
 	        	if(EEWaveData.wave_inputs.sineAmpValue > 0){
 	        		EEWaveData.wave_inputs.sineAmpValue--;
-	        		SetSinAmp(EEWaveData.wave_inputs.sineAmpValue);
+	        		SetSinAmp(SINE_CH_DAC0, EEWaveData.wave_inputs.sineAmpValue);
 	        	    LcdDispClrLine(LCD_ROW_2,LCD_LAYER_TSI_VALUE);
 	        		LcdDispDecWord(LCD_ROW_2,LCD_COL_15	,LCD_LAYER_TSI_VALUE,EEWaveData.wave_inputs.sineAmpValue, 2, LCD_DEC_MODE_LZ);
 	        	} else {
@@ -0,0 +1,19 @@
+/****************************************************************************
+ * InterpTable.c
+ * Polyphase FIR taps, Q15, for the interpolating upsampler in WaveInterp.c.
+ * GENERATED FILE - do not edit. Regenerate with:
+ *     python3 tools/GenInterpTable.py 4 8 7.0 > source/InterpTable.c
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveInterp.h"
+
+#if (WAVE_INTERP_L != 4) || (WAVE_INTERP_TAPS != 8)
+#error "InterpTable.c does not match WaveInterp.h, regenerate it"
+#endif
+
+const INT16S WaveInterpTable[WAVE_INTERP_L][WAVE_INTERP_TAPS] = {
+    {   -97,    656,  -2686,  31825,   3860,   -952,    171,     -6},
+    {  -119,   1057,  -4603,  24928,  14165,  -3272,    678,    -51},
+    {   -51,    678,  -3272,  14165,  24928,  -4603,   1057,   -119},
+    {    -6,    171,   -952,   3860,  31825,  -2686,    656,    -97}
+};
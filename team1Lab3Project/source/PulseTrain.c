@@ -1,6 +1,32 @@
 /**********************************************************************
 * Pulsetrain.c
 * Program generates a Pulse train,  generated by FTM3 and output on PTE8
+* The task sleeps until a setter changes something, then plans the new
+* alignment, prescaler, MOD and CnV with WavePwm.c. MOD and CnV go through
+* FTM3's software synchronization, so period and duty switch together at
+* the next counter maximum. A new prescaler or alignment restarts FTM3 from
+* the FTM3 interrupt at the end of a pulse, so no pulse is cut short.
+* While disabled with SetPulseEnable() FTM3 is stopped.
+* SetPulseSequence() plays a table of frequency/duty steps, the FTM3
+* overflow interrupt counts the periods of each step and switches to the
+* next on the exact reload.
+* SetPulseBank() adds pulses on the other FTM3 channel pairs, combined so
+* each places its pulse anywhere in the pulse train period, complementary
+* with dead time where asked. Their C(n)V load in the same synchronized
+* reload as the pulse output's MOD and CnV.
+* SetPulseBurst() plays exactly N pulses per arm instead. The eDMA counts
+* periods, one request per channel 2 match at the start of each, and its
+* major loop links a second channel that writes the idle C(n)V and then
+* the software trigger during period N, so the outputs go idle at its
+* reload whatever the DMA latency within the period. The overflow ISR then
+* stops the counter. PulseBurstArm() or a rising edge on PTE27 arm the
+* next burst, PulseBurstPend() waits for one to finish.
+* SetPulsePattern() streams a MOD and CnV per period instead. Channel 2
+* matches at the start of every period and requests a DMA that writes the
+* next entry, then links a second channel to write the software trigger,
+* so each entry loads at the following reload. The entries come from a
+* ring of blocks the task refills through the producer as the DMA ISR
+* hands them back.
 *Created by: Karen Aguilar, Rodrick Muya 03/08/2022
 ***********************************************************************/
 /**********************************************************************
@@ -15,14 +41,126 @@
 #include "K65TWR_TSI.h"
 #include "MK65F18.h"
 #include "SysTickDelay.h"
+#include "WaveRing.h"
 #include "Pulsetrain.h"
 #include "K65TWR_GPIO.h"
 
+#define PULSE_BANK_PAIRS    4u              /* FTM3 channel pairs               */
+#define PULSE_PAIR          1u              /* pair of the pulse output, channel 3 */
+#define PULSE_DMA_COUNT_CH  2u              /* counts the periods of a burst     */
+#define PULSE_DMA_STOP_CH   3u              /* idles the outputs from the last   */
+#define PULSE_DMA_SIZE_32BIT 2u
+#define PULSE_TRIG_PIN      27u             /* PTE27, rising edge arms a burst   */
+#define PULSE_BURST_COUNT_CV 1u             /* channel 2 match counting a period, clear of the reload */
+#define PULSE_DMA_PAT_CH    4u              /* moves a pattern entry per period  */
+#define PULSE_DMA_SYNC_CH   5u              /* software trigger after each entry or the stop */
+#define PULSE_DMA_SRC_FTM3_CH2 34u          /* DMAMUX source                     */
+
 typedef struct{
     INT32U pulsefreq;
     INT32U pulseduty;
+    INT8U pulseenable;
+    WAVE_SEQ_STEP seq[WAVE_SEQ_MAX_STEPS];  // sequence steps, in order
+    INT8U seqnum;                           // steps used in seq
+    INT8U seqloop;                          // TRUE repeats the sequence
+    INT8U seqnew;                           // TRUE until the task picks up seq
+    PULSE_BANK_CH bank[PULSE_BANK_MAX_CH];  // bank channels, one per pair
+    INT8U banknum;                          // channels used in bank
+    INT8U bankdt;                           // FTM3_DEADTIME
+    INT8U banknew;                          // TRUE until the task picks up bank
+    INT16U burstnum;                        // pulses per burst, 0 runs continuously
+    INT8U burstarm;                         // TRUE until the task arms a burst
+    INT32U patfreq;                         // pattern frequency, sets the prescaler
+    PULSE_PAT_FILL patfill;                 // pattern producer, 0 out of pattern mode
+    void *patarg;
+    INT8U patnew;                           // TRUE until the task picks up the pattern
 } PULSE_DATA;
 static PULSE_DATA PulseData;
+/* Sequence in FTM3 counts, built by the task and played by the overflow ISR */
+typedef struct{
+    WAVE_SEQ seq;                               // counts reloads, running while seq.left > 0
+    INT16U mod[WAVE_SEQ_MAX_STEPS + 1];         // MOD of each step, then of the own setting
+    INT16U cnv[WAVE_SEQ_MAX_STEPS + 1];         // CnV as above
+    INT16U bankcv[WAVE_SEQ_MAX_STEPS + 1][PULSE_BANK_MAX_CH][2];   // bank C(n)V and C(n+1)V as above
+    WAVE_SEQ_STEP set[WAVE_SEQ_MAX_STEPS];      // task copy of PULSE_DATA.seq
+} PULSE_SEQ;
+static PULSE_SEQ PulseSeq;
+/* Settings the task read in one go */
+typedef struct{
+    INT32U freq;
+    INT16U duty;
+    INT8U enable;
+    INT8U seqnew;                               // TRUE with a new sequence in PulseSeq.set
+    INT8U seqnum;
+    INT8U seqloop;
+    PULSE_BANK_CH bank[PULSE_BANK_MAX_CH];
+    INT8U banknum;
+    INT8U bankdt;
+    INT8U banknew;                              // TRUE with a bank the task has not applied
+    INT16U burst;
+    INT8U arm;
+    INT32U patfreq;
+    PULSE_PAT_FILL patfill;
+    void *patarg;
+    INT8U patnew;                               // TRUE with a pattern the task has not started
+} PULSE_SET;
+/* Setting the FTM3 ISR restarts the counter with at the end of a pulse */
+typedef struct{
+    volatile INT8U restart;                     // TRUE until the ISR has restarted FTM3
+    WAVE_PWM pwm;
+} PULSE_SYNC;
+static PULSE_SYNC PulseSync;
+/* Bank in use and its C(n)V for the own setting, shared with the FTM3 ISR */
+typedef struct{
+    PULSE_BANK_CH set[PULSE_BANK_MAX_CH];
+    INT8U num;
+    INT8U deadtime;                             // FTM3_DEADTIME
+    INT16U cv[PULSE_BANK_MAX_CH][2];
+} PULSE_BANK;
+static PULSE_BANK PulseBank;
+/* Burst mode, shared with the DMA and trigger pin ISRs and read by the DMA */
+typedef struct{
+    INT16U num;                                 // pulses per burst, 0 out of burst mode
+    volatile INT8U ready;                       // TRUE while a burst may be armed
+    volatile INT8U running;                     // TRUE from arming to the stop
+    INT8U pending;                              // TRUE with a setting waiting for the stop
+    volatile INT8U stopping;                    // TRUE from the stop DMA to the overflow ISR
+    INT32U sc;                                  // FTM3_SC of the burst, clock off
+    INT16U cnv;                                 // channel 3 CnV of the burst
+    INT32U count;                               // word the count DMA moves onto itself
+    INT32U idle[2u * PULSE_BANK_PAIRS];         // C0V to C7V the stop DMA writes
+} PULSE_BURST;
+static PULSE_BURST PulseBurst;
+static OS_SEM PulseBurstDone;                   // posted once per finished burst
+/* eDMA TCD as laid out in the channel registers, as in Sinewave.c, loaded
+ * from RAM on scatter-gather. Must be 32 byte aligned.                     */
+typedef struct{
+    INT32U saddr;
+    INT16U soff;
+    INT16U attr;
+    INT32U nbytes;
+    INT32U slast;
+    INT32U daddr;
+    INT16U doff;
+    INT16U citer;
+    INT32U dlast_sga;
+    INT16U csr;
+    INT16U biter;
+}DMA_TCD;
+/* Pattern mode, shared with the DMA ISR and read by the DMA */
+typedef struct{
+    WAVE_RING ring;                             // blocks played and refilled
+    volatile INT8U running;                     // TRUE while the DMA streams entries
+    WAVE_PWM pwm;                               // prescaler and MOD of the pattern frequency
+    PULSE_PAT_FILL fill;
+    void *arg;
+    INT32U sync;                                // FTM3_SYNC the sync DMA writes
+} PULSE_PAT;
+static PULSE_PAT PulsePat;
+static PULSE_PAT_ENTRY PulsePatBuf[PULSE_PAT_BLOCKS * PULSE_PAT_BLOCK_LEN] __ALIGNED(4);
+static DMA_TCD PulsePatTcd[PULSE_PAT_BLOCKS] __ALIGNED(32);    // one TCD per ring block
+/* Pins of channels 2n and 2n+1 of each pair, PORTE ALT6 */
+static const INT8U pulseBankPin[PULSE_BANK_PAIRS][2] = {{5, 6}, {7, 8}, {9, 10}, {11, 12}};
 /*****************************************************************************************
 * Allocate task control blocks
 *****************************************************************************************/
@@ -39,8 +177,23 @@ static OS_MUTEX PulseKey;
 * Task Function and Function Prototypes.
 *****************************************************************************************/
 static void PulsewaveTask(void *p_arg);
-static INT16U GetPulseFreq(void);
-static INT16U GetPulseDuty(void);
+static void pulseGetSet(PULSE_SET *set);
+static void pulseApply(const WAVE_PWM *pwm, WAVE_PWM *now, const PULSE_SET *set);
+static void pulseRestart(const WAVE_PWM *pwm);
+static void pulseSeqStart(const PULSE_SET *set, INT8U num_steps, INT8U loop);
+static INT8U pulseBankCopy(const PULSE_SET *set);
+static void pulseBankCalc(const WAVE_PWM *pwm, INT16U cv[][2]);
+static void pulseBankSetup(void);
+static void pulseBankLoad(INT16U cv[][2]);
+static void pulseBurstApply(const WAVE_PWM *pwm, WAVE_PWM *now, const PULSE_SET *set);
+static void pulseBurstLoad(const WAVE_PWM *pwm);
+static void pulseBurstStart(void);
+static void pulseBurstEnd(void);
+static void pulsePatStart(const WAVE_PWM *pwm, const PULSE_SET *set);
+static void pulsePatLoad(const DMA_TCD *tcd);
+static void pulsePatEnd(void);
+static void pulsePatFill(void);
+static void pulsePatRender(INT16U blk);
 /****************************************************************************************
 * PulseWaveInit()-Public
 * Creates Pulse Wave task
@@ -50,7 +203,9 @@ void PulseWaveInit(void){
 
     OS_ERR os_err;
 
+    PulseData.pulseenable = TRUE;
     OSMutexCreate(&PulseKey, "Pulse Key", &os_err);   /* Create mutex for pulse*/
+    OSSemCreate(&PulseBurstDone, "Pulse Burst Done", 0, &os_err);
     OSTaskCreate(&PulsewaveTaskTCB,                   /* Address of TCB assigned to task */
                  "PulsewaveTask",                     /* Name you want to give the task */
                  PulsewaveTask,                       /* Address of the task itself */
@@ -69,16 +224,33 @@ void PulseWaveInit(void){
 /***********************************************************************************
  * PulsewaveTask()-Private
  * Generate Pulse Train wave.
+ * Pends on its semaphore, posted by the setters on a change and by the
+ * overflow ISR when a sequence ends, so there is no polling. FTM3 runs with
+ * enhanced synchronization, MOD and CnV only load at the counter maximum
+ * after a software trigger, so a new setting never cuts a period short.
+ * WavePwm.c picks edge-aligned or center-aligned and the prescaler for the
+ * least frequency error from 4Hz to 500kHz, edge-aligned only while the
+ * bank has channels.
+ * A new bank restarts a running sequence, whose steps carry the bank's
+ * C(n)V.
+ * While a sequence runs the overflow ISR owns MOD and CnV and the task
+ * leaves them alone, it only picks up new sequences.
+ * In burst mode FTM3 waits stopped with everything loaded, the task or the
+ * trigger pin start it and the stop DMA and the overflow ISR end it. A
+ * setting changed during a burst waits for the stop and holds off the next
+ * arm until it is loaded. Sequences wait for the end of burst mode.
+ * In pattern mode the DMA ISR wakes the task to refill the played blocks.
+ * Bursts, sequences and the own setting wait for the pattern to end, a new
+ * bank starts it again with fresh blocks.
+ * When disabled the FTM3 clock is turned off, which holds the counter and the
+ * output where they are. Enabling turns the clock back on so the pulse train
+ * carries on from the same count.
  * Created by: Karen Aguilar, Rodrick Muya 03/08/2022
  **********************************************************************************/
 static void PulsewaveTask(void *p_arg){
-	INT16U pulsefreq;
-    INT16U pulsedutycycle;
-    INT16U pulsefreqcon = 30000;
-    INT16U pulsedutycyclecon = 3000;
-
-    INT32U lowfreqstep=234375;
-    INT32U highfreqstep=1875000;
+    PULSE_SET set;
+    WAVE_PWM pwm;
+    WAVE_PWM now;
 
     OS_ERR os_err;
     (void)p_arg;                      /* avoid compiler error */
@@ -86,36 +258,204 @@ static void PulsewaveTask(void *p_arg){
     SIM->SCGC3 |= SIM_SCGC3_FTM3(1);   /* Enable clock gate for FTM3 */
     SIM->SCGC5 |= SIM_SCGC5_PORTE(1);  /* Enable clock gate for PORTE */
     PORTE->PCR[8] = PORT_PCR_MUX(6);        // Set PCR for FTM output
-    //Bus clock, center-aligned, divide by 16 prescaler
-    FTM3->SC = FTM_SC_CLKS(1) | FTM_SC_CPWMS(1) |FTM_SC_PS(4);
-    //PMW polarity
-    FTM3->CONTROLS[3].CnSC = FTM_CnSC_ELSA(0)|FTM_CnSC_ELSB(1);
-    //Set Initial signal period to 1000 Hz
-    FTM3->MOD = FTM_MOD_MOD(pulsefreqcon);
-    //Set Initial signal pulse width to 10% (duty cycle)
-    FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pulsedutycyclecon);
+    FTM3->MODE = FTM_MODE_WPDIS(1) | FTM_MODE_FTMEN(1);
+    //MOD and CnV load on the software trigger at the counter maximum, no counter reset
+    FTM3->SYNCONF = FTM_SYNCONF_SYNCMODE(1) | FTM_SYNCONF_SWWRBUF(1);
+    FTM3->SYNC = FTM_SYNC_CNTMAX(1);
+    FTM3->CNTIN = 0;
+    //Edge-aligned PWM when CPWMS is 0, high-true pulses
+    FTM3->CONTROLS[3].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSA(0)|FTM_CnSC_ELSB(1);
+    //Set Initial signal period to 1000 Hz, pulse width to 10% (duty cycle)
+    WavePwmPrescale(1000, &now);
+    WavePwmCalc(1000, 10, &now);
+    pulseRestart(&now);                     /* clock still off, load at once, sync the pulse pair and start */
+    NVIC_EnableIRQ(FTM3_IRQn);          /* overflow or channel interrupt, only enabled in FTM3 while sequencing or restarting */
+    //Burst DMA, the count channel moves a dummy word per period and its major loop links the stop channel,
+    //which writes the idle C(n)V and links the sync channel
+    SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+    SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+    DMA0->TCD[PULSE_DMA_COUNT_CH].SADDR = DMA_SADDR_SADDR(&PulseBurst.count);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].SOFF = 0;
+    DMA0->TCD[PULSE_DMA_COUNT_CH].ATTR = DMA_ATTR_SSIZE(PULSE_DMA_SIZE_32BIT)|DMA_ATTR_DSIZE(PULSE_DMA_SIZE_32BIT);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].NBYTES_MLOFFNO = DMA_NBYTES_MLOFFNO_NBYTES(4);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].SLAST = 0;
+    DMA0->TCD[PULSE_DMA_COUNT_CH].DADDR = DMA_DADDR_DADDR(&PulseBurst.count);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].DOFF = 0;
+    DMA0->TCD[PULSE_DMA_COUNT_CH].DLAST_SGA = 0;
+    DMA0->TCD[PULSE_DMA_COUNT_CH].CSR = DMA_CSR_DREQ(1)|DMA_CSR_MAJORELINK(1)|DMA_CSR_MAJORLINKCH(PULSE_DMA_STOP_CH);
+    PulseBurst.idle[2] = PULSE_BURST_COUNT_CV;  /* channel 3 low, bank pairs at 0% duty */
+    DMA0->TCD[PULSE_DMA_STOP_CH].SADDR = DMA_SADDR_SADDR(&PulseBurst.idle[0]);
+    DMA0->TCD[PULSE_DMA_STOP_CH].SOFF = DMA_SOFF_SOFF(4);
+    DMA0->TCD[PULSE_DMA_STOP_CH].ATTR = DMA_ATTR_SSIZE(PULSE_DMA_SIZE_32BIT)|DMA_ATTR_DSIZE(PULSE_DMA_SIZE_32BIT);
+    DMA0->TCD[PULSE_DMA_STOP_CH].NBYTES_MLOFFNO = DMA_NBYTES_MLOFFNO_NBYTES(sizeof(PulseBurst.idle));
+    DMA0->TCD[PULSE_DMA_STOP_CH].SLAST = DMA_SLAST_SLAST(-(INT32S)sizeof(PulseBurst.idle));
+    DMA0->TCD[PULSE_DMA_STOP_CH].DADDR = DMA_DADDR_DADDR(&FTM3->CONTROLS[0].CnV);
+    DMA0->TCD[PULSE_DMA_STOP_CH].DOFF = DMA_DOFF_DOFF(sizeof(FTM3->CONTROLS[0]));     /* CnV of each channel */
+    DMA0->TCD[PULSE_DMA_STOP_CH].DLAST_SGA = DMA_DLAST_SGA_DLASTSGA(-(INT32S)sizeof(FTM3->CONTROLS));
+    DMA0->TCD[PULSE_DMA_STOP_CH].CITER_ELINKNO = DMA_CITER_ELINKNO_CITER(1);
+    DMA0->TCD[PULSE_DMA_STOP_CH].BITER_ELINKNO = DMA_BITER_ELINKNO_BITER(1);
+    DMA0->TCD[PULSE_DMA_STOP_CH].CSR = DMA_CSR_INTMAJOR(1)|DMA_CSR_MAJORELINK(1)|DMA_CSR_MAJORLINKCH(PULSE_DMA_SYNC_CH);
+    NVIC_EnableIRQ(DMA3_DMA19_IRQn);
+    //Pattern DMA, channel 2 requests an entry per period, each minor loop links the sync channel.
+    //Channel 2 is the DMAMUX source of both modes, so only the one running has it enabled.
+    DMA0->CR |= DMA_CR_EMLM(1);             //minor loop offset steps DADDR back to MOD
+    PulsePat.sync = FTM_SYNC_CNTMAX(1)|FTM_SYNC_SWSYNC(1);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].SADDR = DMA_SADDR_SADDR(&PulsePat.sync);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].SOFF = 0;
+    DMA0->TCD[PULSE_DMA_SYNC_CH].ATTR = DMA_ATTR_SSIZE(PULSE_DMA_SIZE_32BIT)|DMA_ATTR_DSIZE(PULSE_DMA_SIZE_32BIT);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].NBYTES_MLOFFNO = DMA_NBYTES_MLOFFNO_NBYTES(4);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].SLAST = 0;
+    DMA0->TCD[PULSE_DMA_SYNC_CH].DADDR = DMA_DADDR_DADDR(&FTM3->SYNC);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].DOFF = 0;
+    DMA0->TCD[PULSE_DMA_SYNC_CH].DLAST_SGA = 0;
+    DMA0->TCD[PULSE_DMA_SYNC_CH].CITER_ELINKNO = DMA_CITER_ELINKNO_CITER(1);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].BITER_ELINKNO = DMA_BITER_ELINKNO_BITER(1);
+    DMA0->TCD[PULSE_DMA_SYNC_CH].CSR = 0;
+    NVIC_EnableIRQ(DMA4_DMA20_IRQn);
+    PORTE->PCR[PULSE_TRIG_PIN] = PORT_PCR_MUX(1)|PORT_PCR_IRQC(9)|PORT_PCR_PE(1);   // GPIO, rising edge, pull-down
+    NVIC_EnableIRQ(PORTE_IRQn);
 
     while(1){
 
 		DB2_TURN_OFF();                                 /* Disables debug bit 2 while waiting */
-		OSTimeDly(10,OS_OPT_TIME_PERIODIC,&os_err);     /* Task period = 10ms   */
+		(void)OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err); /* posted on every change */
 		DB2_TURN_ON();                                  /* Enables debut bit 2 while ready/running */
-		pulsefreq = GetPulseFreq();
-		pulsedutycycle= GetPulseDuty();
-
-		if(pulsefreq>=100){
-			FTM3->SC = FTM_SC_CLKS(1)|FTM_SC_CPWMS(1)|FTM_SC_PS(4);  //set prescaler to divide by 16
-			pulsefreqcon=highfreqstep/pulsefreq;                     //convert frequency to useful value
-			pulsedutycyclecon=(pulsefreqcon*pulsedutycycle)/100;     //convert duty cycle to useful valu
+		pulseGetSet(&set);
+		if(set.enable == FALSE){
+			PulseBurst.ready = FALSE;                   /* a parked output ignores the trigger */
+			FTM3->SC &= ~FTM_SC_CLKS_MASK;              /* stop FTM3, holds count and output */
+		}else if(set.patfill != (PULSE_PAT_FILL)0){
+			if((set.patnew == TRUE) || (set.banknew == TRUE) || (PulsePat.running == FALSE)){
+				if(PulseBurst.num > 0){
+					pulseBurstEnd();
+				}else{
+				}
+				WavePwmPrescaleEdge(set.patfreq, &pwm); //the DMA requests come from a channel match
+				WavePwmCalc(set.patfreq, 0, &pwm);
+				pulsePatStart(&pwm, &set);
+				now.mod = 0;                            /* registers no longer hold the own setting */
+			}else{
+				FTM3->SC |= FTM_SC_CLKS(1);             //resume after a park
+			}
+			pulsePatFill();
+		}else if(set.burst > 0){
+			if(PulsePat.running == TRUE){
+				pulsePatEnd();                          /* the burst loads FTM3 stopped */
+			}else{
+			}
+			WavePwmPrescaleEdge(set.freq, &pwm);        //the burst counts the periods on a channel match
+			WavePwmCalc(set.freq, set.duty, &pwm);
+			pulseBurstApply(&pwm, &now, &set);
 		}else{
-			FTM3->SC = FTM_SC_CLKS(1)|FTM_SC_CPWMS(1)|FTM_SC_PS(7);  //set prescaler to divide by 128
-			pulsefreqcon=lowfreqstep/pulsefreq;                      //convert frequency to useful value
-			pulsedutycyclecon=(pulsefreqcon*pulsedutycycle)/100;     //convert duty cycle to useful valu
+			if(PulseBurst.num > 0){
+				pulseBurstEnd();                        /* FTM3 carries on from where the burst left it */
+				now.mod = 0;                            /* the stop may have left the idle C(n)V */
+			}else{
+			}
+			if(PulsePat.running == TRUE){
+				pulsePatEnd();                          /* FTM3 carries on from the last entry */
+				now.mod = 0;
+			}else{
+			}
+			if(set.seqnew == TRUE){
+				pulseSeqStart(&set, set.seqnum, set.seqloop);
+				now.mod = 0;                            /* registers no longer hold the own setting */
+			}else if((set.banknew == TRUE) && (PulseSeq.seq.left > 0)){
+				pulseSeqStart(&set, PulseSeq.seq.num_steps, PulseSeq.seq.loop);
+				now.mod = 0;
+			}else{
 			}
-		//set our converted frequency
-		FTM3->MOD = FTM_MOD_MOD(pulsefreqcon);                    //updates output frequency FREQ_in IS DOUBLE on the OUTPUT
-		FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pulsedutycyclecon);   //updates output duty cycle
+			if(PulseSeq.seq.left > 0){
+				FTM3->SC |= FTM_SC_CLKS(1);             //sequence owns MOD/CnV, resume after a park
+			}else{
+				if(set.banknum > 0){
+					WavePwmPrescaleEdge(set.freq, &pwm);    //combined pairs only run edge-aligned
+				}else{
+					WavePwmPrescale(set.freq, &pwm);        //alignment and prescaler with the least error
+				}
+				WavePwmCalc(set.freq, set.duty, &pwm);  //convert frequency and duty cycle to useful values
+				pulseApply(&pwm, &now, &set);
+			}
+		}
+        }
+}
+/**********************************************************************************
+* pulseApply()-Private
+* Moves FTM3 from the settings in now to pwm and starts its clock. Stopped,
+* the registers load at once. Running, MOD and CnV load together at the next
+* counter maximum. A new prescaler or alignment cannot go through the
+* synchronization, so the FTM3 ISR restarts the counter with it at the end
+* of a pulse: on the channel match that ends it when edge-aligned, on the
+* overflow at the counter maximum, between pulses, when center-aligned or
+* when the output never changes. The output is low there and the restarted
+* counter only sets it again on a whole pulse. A restart still waiting
+* takes the latest setting. Unchanged settings are not rewritten.
+* The bank's C(n)V follow the period and load with MOD and CnV. A new bank
+* layout, its pairs, modes or dead time, is not buffered by FTM3 and goes
+* through the restart too.
+* SC, CnSC and PulseBank are shared with the ISR, so the update runs with
+* interrupts off.
+************************************************************************************/
+static void pulseApply(const WAVE_PWM *pwm, WAVE_PWM *now, const PULSE_SET *set){
+    INT32U sc;
+    INT8U layout = FALSE;
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    if(set->banknew == TRUE){
+        layout = pulseBankCopy(set);
+    }else{
+    }
+    pulseBankCalc(pwm, PulseBank.cv);
+    sc = FTM3->SC;
+    if((sc & FTM_SC_CLKS_MASK) == 0){
+        PulseSync.restart = FALSE;
+        if((((sc & FTM_SC_PS_MASK) >> FTM_SC_PS_SHIFT) == pwm->ps) &&
+           (((sc & FTM_SC_CPWMS_MASK) >> FTM_SC_CPWMS_SHIFT) == pwm->center) && (layout == FALSE)){
+            FTM3->MOD = FTM_MOD_MOD(pwm->mod);      /* resumes from the parked count */
+            FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pwm->cnv);
+            pulseBankLoad(PulseBank.cv);
+            FTM3->SC = sc | FTM_SC_CLKS(1);
+        }else{
+            pulseRestart(pwm);
+        }
+    }else if(PulseSync.restart == TRUE){
+        PulseSync.pwm = *pwm;
+    }else if((((sc & FTM_SC_PS_MASK) >> FTM_SC_PS_SHIFT) != pwm->ps) ||
+             (((sc & FTM_SC_CPWMS_MASK) >> FTM_SC_CPWMS_SHIFT) != pwm->center) || (layout == TRUE)){
+        PulseSync.pwm = *pwm;
+        PulseSync.restart = TRUE;
+        if(((sc & FTM_SC_CPWMS_MASK) == 0) && (FTM3->CONTROLS[3].CnV <= FTM3->MOD)){
+            FTM3->CONTROLS[3].CnSC = (FTM3->CONTROLS[3].CnSC & ~FTM_CnSC_CHF_MASK) | FTM_CnSC_CHIE(1);
+        }else{
+            FTM3->SC = (sc & ~FTM_SC_TOF_MASK) | FTM_SC_TOIE(1);   /* overflow of an older period does not count */
         }
+    }else if((pwm->mod != now->mod) || (pwm->cnv != now->cnv) || (set->banknew == TRUE)){
+        FTM3->MOD = FTM_MOD_MOD(pwm->mod);
+        FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pwm->cnv);
+        pulseBankLoad(PulseBank.cv);
+        FTM3->SYNC |= FTM_SYNC_SWSYNC(1);
+    }else{
+    }
+    CPU_CRITICAL_EXIT();
+    *now = *pwm;
+}
+/**********************************************************************************
+* pulseRestart()-Private
+* Stops FTM3, loads pwm straight into MOD and CnV with the clock off and
+* starts the counter again from 0 with pwm's alignment and prescaler. The
+* bank is set up again with the C(n)V in PulseBank.cv. The output holds
+* its level through the stop. Clears and disables the overflow and channel
+* interrupts. Called with interrupts off or from the FTM3 ISR.
+************************************************************************************/
+static void pulseRestart(const WAVE_PWM *pwm){
+    FTM3->SC &= ~(FTM_SC_CLKS_MASK|FTM_SC_TOIE_MASK|FTM_SC_TOF_MASK);
+    FTM3->CONTROLS[3].CnSC &= ~(FTM_CnSC_CHIE_MASK|FTM_CnSC_CHF_MASK);
+    FTM3->CNT = 0;                                  // any write resets the counter to CNTIN
+    FTM3->MOD = FTM_MOD_MOD(pwm->mod);
+    FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pwm->cnv);
+    pulseBankSetup();
+    pulseBankLoad(PulseBank.cv);
+    FTM3->SC = FTM_SC_CLKS(1)|FTM_SC_CPWMS(pwm->center)|FTM_SC_PS(pwm->ps);
 }
 /**********************************************************************************
 * SetPulseFreq()-Public Function
@@ -126,7 +466,11 @@ static void PulsewaveTask(void *p_arg){
 void SetPulseFreq(INT32U changefreq){
     OS_ERR os_err;
     OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-    PulseData.pulsefreq = changefreq;
+    if(changefreq != PulseData.pulsefreq){
+        PulseData.pulsefreq = changefreq;
+        (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    }else{
+    }
     OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
 }
 /**************************************************************************************
@@ -138,32 +482,807 @@ void SetPulseFreq(INT32U changefreq){
 void SetPulseDuty(INT32U duty_cycle){
     OS_ERR os_err;
     OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-    PulseData.pulseduty = duty_cycle;
+    if(duty_cycle != PulseData.pulseduty){
+        PulseData.pulseduty = duty_cycle;
+        (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    }else{
+    }
     OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
 }
-/*****************************************************************************************
-* GetPulseFreq()-Private
-* Gets the pulse wave frequency in mutex.
-* Created by: Karen Aguilar, Rodrick Muya 03/06/2022
-*****************************************************************************************/
-static INT16U GetPulseFreq(void){
-    INT16U returnfreq;
+/**************************************************************************************
+* SetPulseEnable()-Public function
+* Parameters: TRUE to run the pulse train, FALSE to park it.
+* Enables or parks the pulse output. Wakes the task to do it.
+****************************************************************************************/
+void SetPulseEnable(INT8U enable){
     OS_ERR os_err;
     OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-    returnfreq = PulseData.pulsefreq;
+    if(enable != PulseData.pulseenable){
+        PulseData.pulseenable = enable;
+        (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    }else{
+    }
     OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
-    return returnfreq;
 }
 /*****************************************************************************************
-* GetPulseDuty() - Private
-* Gets the pulse duty cycle in mutex.
-* Created by: Karen Aguilar, Rodrick Muya 03/06/2022
+* pulseGetSet()-Private
+* Reads the frequency, duty cycle, enable, bank, burst and pattern in one
+* mutex hold, and copies a new sequence into PulseSeq.set for
+* pulseSeqStart().
 *****************************************************************************************/
-static INT16U GetPulseDuty(void){
-	INT16U returnduty;
+static void pulseGetSet(PULSE_SET *set){
+    INT8U i;
+    OS_ERR os_err;
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    set->freq = PulseData.pulsefreq;
+    set->duty = (INT16U)PulseData.pulseduty;
+    set->enable = PulseData.pulseenable;
+    set->seqnew = PulseData.seqnew;
+    set->seqnum = PulseData.seqnum;
+    set->seqloop = PulseData.seqloop;
+    if((PulseData.seqnew == TRUE) && (PulseData.pulseenable == TRUE) && (PulseData.burstnum == 0) &&
+       (PulseData.patfill == (PULSE_PAT_FILL)0)){
+        for(i = 0; i < PulseData.seqnum; i++){
+            PulseSeq.set[i] = PulseData.seq[i];
+        }
+        PulseData.seqnew = FALSE;
+    }else{
+        set->seqnew = FALSE;                    /* a parked output picks it up once enabled, a burst or pattern once it ends */
+    }
+    for(i = 0; i < PulseData.banknum; i++){
+        set->bank[i] = PulseData.bank[i];
+    }
+    set->banknum = PulseData.banknum;
+    set->bankdt = PulseData.bankdt;
+    set->banknew = PulseData.banknew;
+    set->patfreq = PulseData.patfreq;
+    set->patfill = PulseData.patfill;
+    set->patarg = PulseData.patarg;
+    set->patnew = PulseData.patnew;
+    if(PulseData.pulseenable == TRUE){
+        PulseData.banknew = FALSE;
+        PulseData.patnew = FALSE;
+    }else{
+        set->banknew = FALSE;
+        set->patnew = FALSE;
+    }
+    set->burst = PulseData.burstnum;
+    set->arm = PulseData.burstarm;
+    if((PulseData.pulseenable == TRUE) || (PulseData.burstnum == 0)){
+        PulseData.burstarm = FALSE;             /* an arm out of burst mode is dropped */
+    }else{
+        set->arm = FALSE;
+    }
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+}
+/**********************************************************************************
+* pulseSeqStart()-Private
+* Works out MOD, CnV and the length in periods of every step, then restarts
+* FTM3 on step 0 with the overflow interrupt on. All steps share the
+* alignment and prescaler of the lowest frequency, including the own
+* setting, so only the buffered MOD and CnV change at a transition. When
+* center-aligned the first step also plays the half period from the counter
+* starting at 0 to its first reload. A new bank in set is taken up here,
+* with FTM3 stopped.
+************************************************************************************/
+static void pulseSeqStart(const PULSE_SET *set, INT8U num_steps, INT8U loop){
+    WAVE_PWM pwm;
+    INT32U freq = set->freq;
+    INT16U duty = set->duty;
+    INT32U minfreq = freq;
+    INT8U i;
+
+    FTM3->SC &= ~(FTM_SC_CLKS_MASK|FTM_SC_TOIE_MASK|FTM_SC_TOF_MASK);  /* stop, MOD and CnV then load at once */
+    FTM3->CONTROLS[3].CnSC &= ~(FTM_CnSC_CHIE_MASK|FTM_CnSC_CHF_MASK);
+    PulseSync.restart = FALSE;                                          /* the sequence sets its own prescaler */
+    NVIC_ClearPendingIRQ(FTM3_IRQn);
+    if(set->banknew == TRUE){
+        (void)pulseBankCopy(set);
+    }else{
+    }
+    pulseBankSetup();
+
+    for(i = 0; i < num_steps; i++){
+        if(PulseSeq.set[i].freq < minfreq){
+            minfreq = PulseSeq.set[i].freq;
+        }else{
+        }
+    }
+    if(PulseBank.num > 0){
+        WavePwmPrescaleEdge(minfreq, &pwm);
+    }else{
+        WavePwmPrescale(minfreq, &pwm);
+    }
+    for(i = 0; i <= num_steps; i++){
+        if(i < num_steps){
+            freq = PulseSeq.set[i].freq;
+            duty = PulseSeq.set[i].amp;
+        }else{
+        }
+        WavePwmCalc(freq, duty, &pwm);
+        PulseSeq.mod[i] = pwm.mod;
+        PulseSeq.cnv[i] = pwm.cnv;
+        pulseBankCalc(&pwm, PulseSeq.bankcv[i]);
+        if(i < num_steps){
+            PulseSeq.seq.length[i] = WaveSeqTicks(PulseSeq.set[i].time_ms, WAVE_PWM_BUS_CLK, pwm.period);
+        }else{
+        }
+    }
+    WaveSeqStart(&PulseSeq.seq, num_steps, loop);
+    if(PulseSeq.seq.left > 0){
+        FTM3->CNT = 0;
+        FTM3->MOD = FTM_MOD_MOD(PulseSeq.mod[0]);
+        FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(PulseSeq.cnv[0]);
+        pulseBankLoad(PulseSeq.bankcv[0]);
+        FTM3->SC = FTM_SC_CLKS(1)|FTM_SC_CPWMS(pwm.center)|FTM_SC_PS(pwm.ps)|FTM_SC_TOIE(1);
+    }else{
+    }
+}
+/**************************************************************************************
+* SetPulseSequence()-Public function
+* Parameters: num_steps steps of frequency in Hz, duty cycle in percent (amp)
+* and time, see WAVE_SEQ_STEP in WaveSeq.h, shape is ignored. loop TRUE
+* repeats them.
+* Plays the steps on the pulse output as soon as the task wakes, each for
+* its time rounded to whole periods of its own frequency. Without loop the
+* output goes back to SetPulseFreq()/SetPulseDuty() after the last step.
+* Steps past WAVE_SEQ_MAX_STEPS are dropped, num_steps 0 stops the sequence.
+* The steps are copied. Parking the output with SetPulseEnable() pauses the
+* sequence.
+****************************************************************************************/
+void SetPulseSequence(const WAVE_SEQ_STEP *steps, INT8U num_steps, INT8U loop){
+    OS_ERR os_err;
+    INT8U i;
+    if(num_steps > WAVE_SEQ_MAX_STEPS){
+        num_steps = WAVE_SEQ_MAX_STEPS;
+    }else{
+    }
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    for(i = 0; i < num_steps; i++){
+        PulseData.seq[i] = steps[i];
+    }
+    PulseData.seqnum = num_steps;
+    PulseData.seqloop = loop;
+    PulseData.seqnew = TRUE;
+    (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+}
+/**************************************************************************************
+* GetPulseSeqActive()-Public function
+* Returns TRUE while a sequence set with SetPulseSequence() is queued or
+* still running.
+****************************************************************************************/
+INT8U GetPulseSeqActive(void){
+    INT8U active;
+    OS_ERR os_err;
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    active = ((PulseData.seqnew == TRUE) && (PulseData.seqnum > 0)) || (PulseSeq.seq.left > 0);
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+    return active;
+}
+/**************************************************************************************
+* SetPulseBank()-Public function
+* Parameters: num_ch bank channels, see PULSE_BANK_CH in PulseTrain.h, and
+* the dead time of the PULSE_BANK_COMP channels in ns, rounded up, at most
+* 1008 bus clocks.
+* Puts a pulse on each channel's FTM3 pair at the pulse train frequency,
+* replacing the last bank, num_ch 0 turns the bank off. Channels on pair 1,
+* a pair used twice, or a mode out of range are dropped. While the bank
+* has channels the pulse train runs edge-aligned, which holds it at 7.2Hz
+* and above. Only phase and duty changed loads in one synchronized reload,
+* anything else restarts FTM3 at the end of a pulse. The channels are
+* copied. Parking the output with SetPulseEnable() parks the bank.
+****************************************************************************************/
+void SetPulseBank(const PULSE_BANK_CH *chans, INT8U num_ch, INT32U deadtime_ns){
+    OS_ERR os_err;
+    INT8U used = 0;
+    INT8U num = 0;
+    INT8U i;
+    if(num_ch > PULSE_BANK_MAX_CH){
+        num_ch = PULSE_BANK_MAX_CH;
+    }else{
+    }
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    for(i = 0; i < num_ch; i++){
+        if((chans[i].pair < PULSE_BANK_PAIRS) && (chans[i].pair != PULSE_PAIR) &&
+           ((used & (1u << chans[i].pair)) == 0) && (chans[i].mode <= PULSE_BANK_COMP)){
+            used |= (INT8U)(1u << chans[i].pair);
+            PulseData.bank[num] = chans[i];
+            num++;
+        }else{
+        }
+    }
+    PulseData.banknum = num;
+    PulseData.bankdt = WavePwmDeadtime(deadtime_ns);
+    PulseData.banknew = TRUE;
+    (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+}
+/**********************************************************************************
+* pulseBankCopy()-Private
+* Takes up the bank in set. Returns TRUE if its layout, pairs, modes or
+* dead time, differs from the one in use. Called with interrupts off or
+* FTM3 stopped.
+************************************************************************************/
+static INT8U pulseBankCopy(const PULSE_SET *set){
+    INT8U layout;
+    INT8U i;
+
+    layout = (INT8U)((set->banknum != PulseBank.num) || (set->bankdt != PulseBank.deadtime));
+    for(i = 0; i < set->banknum; i++){
+        if((set->bank[i].pair != PulseBank.set[i].pair) || (set->bank[i].mode != PulseBank.set[i].mode)){
+            layout = TRUE;
+        }else{
+        }
+        PulseBank.set[i] = set->bank[i];
+    }
+    PulseBank.num = set->banknum;
+    PulseBank.deadtime = set->bankdt;
+    return layout;
+}
+/**********************************************************************************
+* pulseBankCalc()-Private
+* C(n)V and C(n+1)V of each bank channel for the period in pwm.
+************************************************************************************/
+static void pulseBankCalc(const WAVE_PWM *pwm, INT16U cv[][2]){
+    INT8U i;
+
+    for(i = 0; i < PulseBank.num; i++){
+        WavePwmEdges(pwm, PulseBank.set[i].phase, PulseBank.set[i].duty, &cv[i][0], &cv[i][1]);
+    }
+}
+/**********************************************************************************
+* pulseBankSetup()-Private
+* Writes the bank layout from PulseBank into the unbuffered FTM3 registers,
+* combine, complement, dead time and sync enables, channel polarity and the
+* pin muxes. Pairs out of the bank have their pins turned off. Pair 1 keeps
+* the pulse output. Only with FTM3 stopped.
+************************************************************************************/
+static void pulseBankSetup(void){
+    INT32U combine = FTM_COMBINE_SYNCEN1(1);        /* pulse output, channels 2 and 3 */
+    INT32U els;
+    INT8U pins[PULSE_BANK_PAIRS] = {0, 0, 0, 0};    /* pins of each pair in use */
+    INT8U n;
+    INT8U i;
+
+    for(n = 0; n < PULSE_BANK_PAIRS; n++){
+        if(n != PULSE_PAIR){
+            FTM3->CONTROLS[2u * n].CnSC = 0;
+            FTM3->CONTROLS[(2u * n) + 1u].CnSC = 0;
+        }else{
+        }
+    }
+    for(i = 0; i < PulseBank.num; i++){
+        n = PulseBank.set[i].pair;
+        combine |= (FTM_COMBINE_COMBINE0_MASK|FTM_COMBINE_SYNCEN0_MASK) << (8u * n);
+        if(PulseBank.set[i].mode == PULSE_BANK_COMP){
+            combine |= (FTM_COMBINE_COMP0_MASK|FTM_COMBINE_DTEN0_MASK) << (8u * n);
+            pins[n] = 2;
+        }else{
+            pins[n] = 1;
+        }
+        //Combined, set on C(n)V and cleared on C(n+1)V, reversed for a low pulse
+        els = (PulseBank.set[i].mode == PULSE_BANK_LOW) ? FTM_CnSC_ELSA(1) : FTM_CnSC_ELSB(1);
+        FTM3->CONTROLS[2u * n].CnSC = els;
+        FTM3->CONTROLS[(2u * n) + 1u].CnSC = els;
+    }
+    FTM3->DEADTIME = PulseBank.deadtime;
+    FTM3->COMBINE = combine;
+    for(n = 0; n < PULSE_BANK_PAIRS; n++){
+        if(n != PULSE_PAIR){
+            PORTE->PCR[pulseBankPin[n][0]] = PORT_PCR_MUX((pins[n] > 0) ? 6 : 0);
+            PORTE->PCR[pulseBankPin[n][1]] = PORT_PCR_MUX((pins[n] > 1) ? 6 : 0);
+        }else{
+        }
+    }
+}
+/**********************************************************************************
+* pulseBankLoad()-Private
+* Writes the bank's C(n)V and C(n+1)V, loaded by the next synchronization
+* or at once with FTM3 stopped.
+************************************************************************************/
+static void pulseBankLoad(INT16U cv[][2]){
+    INT8U n;
+    INT8U i;
+
+    for(i = 0; i < PulseBank.num; i++){
+        n = PulseBank.set[i].pair;
+        FTM3->CONTROLS[2u * n].CnV = FTM_CnV_VAL(cv[i][0]);
+        FTM3->CONTROLS[(2u * n) + 1u].CnV = FTM_CnV_VAL(cv[i][1]);
+    }
+}
+/**************************************************************************************
+* SetPulseBurst()-Public function
+* Parameters: num pulses per burst, up to PULSE_BURST_MAX, 0 back to a
+* continuous pulse train.
+* Puts the output in burst mode, stopping the pulse train at once, and
+* holds it low until armed. Each arm plays num pulses at the
+* SetPulseFreq()/SetPulseDuty() setting, counted by the DMA, then stops low
+* again and posts PulseBurstPend(). A running burst is not cut short by a
+* new num, frequency or duty, they apply from the next arm. The pulse train
+* runs edge-aligned, 7.2Hz and above, at any duty. The DMA idles the
+* outputs during the last period, from its channel 2 match at
+* PULSE_BURST_COUNT_CV to the reload, so at 500kHz it has the same period
+* as the pattern DMA, PULSE_PAT_MIN_PERIOD bus clocks.
+****************************************************************************************/
+void SetPulseBurst(INT16U num){
+    OS_ERR os_err;
+    if(num > PULSE_BURST_MAX){
+        num = PULSE_BURST_MAX;
+    }else{
+    }
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    if(num != PulseData.burstnum){
+        PulseData.burstnum = num;
+        (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    }else{
+    }
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+}
+/**************************************************************************************
+* PulseBurstArm()-Public function
+* Arms the next burst from software, the same as a rising edge on PTE27.
+* Ignored while a burst runs or out of burst mode. With the output parked
+* it waits for SetPulseEnable().
+****************************************************************************************/
+void PulseBurstArm(void){
+    OS_ERR os_err;
+    OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    PulseData.burstarm = TRUE;
+    (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
+}
+/**************************************************************************************
+* PulseBurstPend()-Public function
+* Parameters: tout in ticks, 0 waits forever, and the error from OSSemPend.
+* Waits for a burst to finish. Counts bursts, so one that finished before
+* the call returns at once.
+****************************************************************************************/
+void PulseBurstPend(INT16U tout, OS_ERR *os_err){
+    (void)OSSemPend(&PulseBurstDone, tout, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, os_err);
+}
+/**********************************************************************************
+* pulseBurstApply()-Private
+* Enters or stays in burst mode with pwm. A running burst is left to play
+* out, a changed setting or bank waits for the overflow ISR to wake the
+* task at the stop and the trigger is ignored until then. A parked burst
+* is resumed. Otherwise FTM3 is loaded stopped, ready for an arm, and
+* armed if set asks for it. A running sequence is stopped.
+* SC, PulseBank and PulseBurst are shared with the ISRs, so the update
+* runs with interrupts off.
+************************************************************************************/
+static void pulseBurstApply(const WAVE_PWM *pwm, WAVE_PWM *now, const PULSE_SET *set){
+    INT32U sc;
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    if(PulseSeq.seq.left > 0){
+        FTM3->SC &= ~(FTM_SC_CLKS_MASK|FTM_SC_TOF_MASK);
+        WaveSeqStop(&PulseSeq.seq);
+    }else{
+    }
+    PulseSync.restart = FALSE;
+    if(set->banknew == TRUE){
+        (void)pulseBankCopy(set);
+    }else{
+    }
+    pulseBankCalc(pwm, PulseBank.cv);
+    PulseBurst.num = set->burst;
+    if(PulseBurst.running == TRUE){
+        if((pwm->ps != now->ps) || (pwm->mod != now->mod) || (pwm->cnv != now->cnv) || (set->banknew == TRUE)){
+            PulseBurst.pending = TRUE;          /* TOIE belongs to the stop */
+        }else{
+        }
+        PulseBurst.ready = (PulseBurst.pending == TRUE) ? FALSE : TRUE;
+        sc = FTM3->SC;
+        FTM3->SC = sc | FTM_SC_CLKS(1);         /* resume after a park */
+    }else{
+        NVIC_ClearPendingIRQ(FTM3_IRQn);
+        pulseBurstLoad(pwm);
+        *now = *pwm;
+        PulseBurst.pending = FALSE;
+        PulseBurst.ready = TRUE;
+        if(set->arm == TRUE){
+            pulseBurstStart();
+        }else{
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+/**********************************************************************************
+* pulseBurstLoad()-Private
+* Stops FTM3 with its outputs at their idle levels and loads pwm and the
+* bank for the next burst, channel 2 matching at PULSE_BURST_COUNT_CV to
+* request the count DMA once a period and the DMAMUX routing it to the
+* count channel. OUTINIT is then left with the pulse output high, so the
+* first pulse starts with the count. Called with interrupts off.
+************************************************************************************/
+static void pulseBurstLoad(const WAVE_PWM *pwm){
+    INT32U outinit = 0;
+    INT8U n;
+    INT8U i;
+
+    FTM3->SC &= ~(FTM_SC_CLKS_MASK|FTM_SC_TOIE_MASK|FTM_SC_TOF_MASK);
+    FTM3->CONTROLS[3].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSB(1);
+    FTM3->CONTROLS[2].CnV = PULSE_BURST_COUNT_CV;
+    FTM3->CONTROLS[2].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSB(1)|FTM_CnSC_CHIE(1)|FTM_CnSC_DMA(1);    /* PTE7 not muxed */
+    DMAMUX->CHCFG[PULSE_DMA_COUNT_CH] = 0;
+    DMAMUX->CHCFG[PULSE_DMA_COUNT_CH] = DMAMUX_CHCFG_ENBL(1)|DMAMUX_CHCFG_SOURCE(PULSE_DMA_SRC_FTM3_CH2);
+    FTM3->MOD = FTM_MOD_MOD(pwm->mod);
+    FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(pwm->cnv);
+    pulseBankSetup();
+    pulseBankLoad(PulseBank.cv);
+    for(i = 0; i < PulseBank.num; i++){
+        n = PulseBank.set[i].pair;
+        if(PulseBank.set[i].mode == PULSE_BANK_LOW){
+            outinit |= 3u << (2u * n);
+        }else if(PulseBank.set[i].mode == PULSE_BANK_COMP){
+            outinit |= 2u << (2u * n);
+        }else{
+        }
+    }
+    FTM3->OUTINIT = outinit;
+    FTM3->MODE |= FTM_MODE_INIT(1);             /* pulse output low, bank channels idle */
+    if(pwm->cnv > 0){
+        FTM3->OUTINIT = outinit | FTM_OUTINIT_CH3OI(1);
+    }else{
+    }
+    PulseBurst.cnv = pwm->cnv;
+    PulseBurst.sc = FTM_SC_PS(pwm->ps);
+    FTM3->SC = PulseBurst.sc;
+}
+/**********************************************************************************
+* pulseBurstStart()-Private
+* Arms the count DMA for PulseBurst.num periods and starts FTM3 from 0 with
+* its outputs at OUTINIT. With the clock off the burst's CnV and C(n)V
+* load at once over the idle ones the last stop left. Called with
+* interrupts off or from the trigger pin ISR, with PulseBurst.ready TRUE
+* and no burst running.
+************************************************************************************/
+static void pulseBurstStart(void){
+    FTM3->CNT = 0;
+    FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(PulseBurst.cnv);
+    pulseBankLoad(PulseBank.cv);
+    FTM3->MODE |= FTM_MODE_INIT(1);
+    FTM3->CONTROLS[2].CnSC &= ~FTM_CnSC_CHF_MASK;
+    DMA0->CDNE = DMA_CDNE_CDNE(PULSE_DMA_COUNT_CH);
+    DMA0->CDNE = DMA_CDNE_CDNE(PULSE_DMA_STOP_CH);
+    DMA0->CDNE = DMA_CDNE_CDNE(PULSE_DMA_SYNC_CH);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].CITER_ELINKNO = DMA_CITER_ELINKNO_CITER(PulseBurst.num);
+    DMA0->TCD[PULSE_DMA_COUNT_CH].BITER_ELINKNO = DMA_BITER_ELINKNO_BITER(PulseBurst.num);
+    DMA0->SERQ = DMA_SERQ_SERQ(PULSE_DMA_COUNT_CH);
+    PulseBurst.running = TRUE;
+    FTM3->SC = PulseBurst.sc | FTM_SC_CLKS(1);
+}
+/**********************************************************************************
+* pulseBurstEnd()-Private
+* Leaves burst mode. The count DMA is turned off and the stop and sync
+* channels allowed to finish, channel 2 stops requesting and channel 3 goes
+* back to a plain pulse output. FTM3 is left as it is for pulseApply(),
+* which must rewrite MOD, CnV and the C(n)V as a stop may have left the
+* idle ones.
+************************************************************************************/
+static void pulseBurstEnd(void){
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    PulseBurst.num = 0;
+    PulseBurst.ready = FALSE;
+    PulseBurst.running = FALSE;
+    PulseBurst.stopping = FALSE;
+    PulseBurst.pending = FALSE;
+    DMA0->CERQ = DMA_CERQ_CERQ(PULSE_DMA_COUNT_CH);
+    while((DMA0->TCD[PULSE_DMA_COUNT_CH].CSR & (DMA_CSR_ACTIVE_MASK|DMA_CSR_START_MASK)) != 0){}
+    while((DMA0->TCD[PULSE_DMA_STOP_CH].CSR & (DMA_CSR_ACTIVE_MASK|DMA_CSR_START_MASK)) != 0){}
+    while((DMA0->TCD[PULSE_DMA_SYNC_CH].CSR & (DMA_CSR_ACTIVE_MASK|DMA_CSR_START_MASK)) != 0){}
+    DMA0->CINT = DMA_CINT_CINT(PULSE_DMA_STOP_CH);
+    NVIC_ClearPendingIRQ(DMA3_DMA19_IRQn);
+    FTM3->SC &= ~FTM_SC_TOIE_MASK;
+    NVIC_ClearPendingIRQ(FTM3_IRQn);
+    DMAMUX->CHCFG[PULSE_DMA_COUNT_CH] = 0;
+    FTM3->CONTROLS[2].CnSC = 0;
+    FTM3->CONTROLS[3].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSA(0)|FTM_CnSC_ELSB(1);
+    CPU_CRITICAL_EXIT();
+}
+/**************************************************************************************
+* SetPulsePattern()-Public function
+* Parameters: freq in Hz for the prescaler and the default period, the
+* producer fill, see PULSE_PAT_FILL in PulseTrain.h, and arg passed to it.
+* fill 0 goes back to the continuous pulse train.
+* Puts the output in pattern mode, one PULSE_PAT_ENTRY per period. fill is
+* called from the pulse task for all PULSE_PAT_BLOCKS blocks at the start,
+* then for each block the DMA has played, up to PULSE_PAT_BLOCKS - 1
+* blocks ahead of it. A block not refilled in time plays again and counts
+* in GetPulsePatOverruns(). The pattern runs edge-aligned at the prescaler
+* of freq, 7.2Hz and above, periods are held to at least
+* PULSE_PAT_MIN_PERIOD bus clocks and the bank keeps the C(n)V of freq.
+* A new call restarts the pattern from fresh blocks.
+****************************************************************************************/
+void SetPulsePattern(INT32U freq, PULSE_PAT_FILL fill, void *arg){
     OS_ERR os_err;
     OSMutexPend(&PulseKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-    returnduty = PulseData.pulseduty;
+    PulseData.patfreq = freq;
+    PulseData.patfill = fill;
+    PulseData.patarg = arg;
+    PulseData.patnew = TRUE;
+    (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
     OSMutexPost(&PulseKey,OS_OPT_NONE,&os_err);
-    return returnduty;
+}
+/**************************************************************************************
+* GetPulsePatOverruns()-Public function
+* Returns the pattern blocks the DMA has played again since the last start
+* because the producer had not refilled them.
+****************************************************************************************/
+INT32U GetPulsePatOverruns(void){
+    INT32U overruns;
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    overruns = PulsePat.ring.overruns;
+    CPU_CRITICAL_EXIT();
+    return overruns;
+}
+/**********************************************************************************
+* pulsePatStart()-Private
+* Stops FTM3, renders every block and links one TCD per block into a
+* circle with scatter-gather. Each minor loop writes an entry's MOD and
+* CnV, steps DADDR back to MOD and links the sync channel, the major loop
+* links it too and raises the block interrupt. FTM3 starts from 0 on entry
+* 0, loaded at once, so the DMA starts on entry 1, written during period 0
+* and loaded at its end. A running burst, sequence or restart is dropped
+* and a new bank in set is taken up.
+************************************************************************************/
+static void pulsePatStart(const WAVE_PWM *pwm, const PULSE_SET *set){
+    DMA_TCD tcd;
+    INT16U blk;
+    INT16U next;
+    INT32U doff = (INT32U)&FTM3->CONTROLS[3].CnV - (INT32U)&FTM3->MOD;
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    if(PulsePat.running == TRUE){
+        pulsePatEnd();
+    }else{
+    }
+    FTM3->SC &= ~(FTM_SC_CLKS_MASK|FTM_SC_TOIE_MASK|FTM_SC_TOF_MASK);  /* stop, everything then loads at once */
+    FTM3->CONTROLS[3].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSB(1);       /* PWM, no restart or burst on channel 3 */
+    PulseSync.restart = FALSE;
+    WaveSeqStop(&PulseSeq.seq);
+    NVIC_ClearPendingIRQ(FTM3_IRQn);
+    CPU_CRITICAL_EXIT();
+    if(set->banknew == TRUE){
+        (void)pulseBankCopy(set);
+    }else{
+    }
+    pulseBankSetup();
+    pulseBankCalc(pwm, PulseBank.cv);
+
+    PulsePat.pwm = *pwm;
+    PulsePat.fill = set->patfill;
+    PulsePat.arg = set->patarg;
+    for(blk = 0; blk < PULSE_PAT_BLOCKS; blk++){
+        pulsePatRender(blk);
+    }
+    WaveRingInit(&PulsePat.ring, PULSE_PAT_BLOCKS);
+    for(blk = 0; blk < PULSE_PAT_BLOCKS; blk++){
+        next = blk + 1;
+        if(next >= PULSE_PAT_BLOCKS){
+            next = 0;
+        }else{
+        }
+        PulsePatTcd[blk].saddr = DMA_SADDR_SADDR(&PulsePatBuf[blk * PULSE_PAT_BLOCK_LEN]);
+        PulsePatTcd[blk].soff = DMA_SOFF_SOFF(4);
+        PulsePatTcd[blk].attr = DMA_ATTR_SSIZE(PULSE_DMA_SIZE_32BIT)|DMA_ATTR_DSIZE(PULSE_DMA_SIZE_32BIT);
+        PulsePatTcd[blk].nbytes = DMA_NBYTES_MLOFFYES_SMLOE(0) | DMA_NBYTES_MLOFFYES_DMLOE(1) |
+                                  DMA_NBYTES_MLOFFYES_MLOFF(-(INT32S)(2u * doff)) |
+                                  DMA_NBYTES_MLOFFYES_NBYTES(sizeof(PULSE_PAT_ENTRY));
+        PulsePatTcd[blk].slast = 0;
+        PulsePatTcd[blk].daddr = DMA_DADDR_DADDR(&FTM3->MOD);
+        PulsePatTcd[blk].doff = DMA_DOFF_DOFF(doff);
+        PulsePatTcd[blk].citer = DMA_CITER_ELINKYES_ELINK(1)|DMA_CITER_ELINKYES_LINKCH(PULSE_DMA_SYNC_CH)|
+                                 DMA_CITER_ELINKYES_CITER(PULSE_PAT_BLOCK_LEN);
+        PulsePatTcd[blk].dlast_sga = DMA_DLAST_SGA_DLASTSGA((INT32U)&PulsePatTcd[next]);
+        PulsePatTcd[blk].csr = DMA_CSR_ESG(1)|DMA_CSR_MAJORELINK(1)|DMA_CSR_MAJORLINKCH(PULSE_DMA_SYNC_CH)|
+                               DMA_CSR_INTMAJOR(1);
+        PulsePatTcd[blk].biter = DMA_BITER_ELINKYES_ELINK(1)|DMA_BITER_ELINKYES_LINKCH(PULSE_DMA_SYNC_CH)|
+                                 DMA_BITER_ELINKYES_BITER(PULSE_PAT_BLOCK_LEN);
+    }
+    tcd = PulsePatTcd[0];
+    tcd.saddr = DMA_SADDR_SADDR(&PulsePatBuf[1]);
+    tcd.citer = DMA_CITER_ELINKYES_ELINK(1)|DMA_CITER_ELINKYES_LINKCH(PULSE_DMA_SYNC_CH)|
+                DMA_CITER_ELINKYES_CITER(PULSE_PAT_BLOCK_LEN - 1u);
+    tcd.biter = DMA_BITER_ELINKYES_ELINK(1)|DMA_BITER_ELINKYES_LINKCH(PULSE_DMA_SYNC_CH)|
+                DMA_BITER_ELINKYES_BITER(PULSE_PAT_BLOCK_LEN - 1u);
+    pulsePatLoad(&tcd);
+
+    FTM3->CNT = 0;
+    FTM3->MOD = FTM_MOD_MOD(PulsePatBuf[0].mod);
+    FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(PulsePatBuf[0].cnv);
+    pulseBankLoad(PulseBank.cv);
+    FTM3->CONTROLS[2].CnV = 0;                                          /* match at the start of each period */
+    FTM3->CONTROLS[2].CnSC = FTM_CnSC_MSB(1)|FTM_CnSC_ELSB(1)|FTM_CnSC_CHIE(1)|FTM_CnSC_DMA(1);    /* PTE7 not muxed */
+    DMAMUX->CHCFG[PULSE_DMA_PAT_CH] = 0;
+    DMAMUX->CHCFG[PULSE_DMA_PAT_CH] = DMAMUX_CHCFG_ENBL(1)|DMAMUX_CHCFG_SOURCE(PULSE_DMA_SRC_FTM3_CH2);
+    PulsePat.running = TRUE;
+    DMA0->SERQ = DMA_SERQ_SERQ(PULSE_DMA_PAT_CH);
+    FTM3->SC = FTM_SC_CLKS(1)|FTM_SC_PS(pwm->ps);
+}
+/**********************************************************************************
+* pulsePatLoad()-Private
+* Copies tcd into the pattern DMA channel. CSR is written last with DONE
+* already clear, or the ESG bit would not take.
+************************************************************************************/
+static void pulsePatLoad(const DMA_TCD *tcd){
+    DMA0->CDNE = DMA_CDNE_CDNE(PULSE_DMA_PAT_CH);
+    DMA0->CDNE = DMA_CDNE_CDNE(PULSE_DMA_SYNC_CH);
+    DMA0->TCD[PULSE_DMA_PAT_CH].SADDR = tcd->saddr;
+    DMA0->TCD[PULSE_DMA_PAT_CH].ATTR = tcd->attr;
+    DMA0->TCD[PULSE_DMA_PAT_CH].SOFF = tcd->soff;
+    DMA0->TCD[PULSE_DMA_PAT_CH].NBYTES_MLOFFYES = tcd->nbytes;
+    DMA0->TCD[PULSE_DMA_PAT_CH].CITER_ELINKYES = tcd->citer;
+    DMA0->TCD[PULSE_DMA_PAT_CH].BITER_ELINKYES = tcd->biter;
+    DMA0->TCD[PULSE_DMA_PAT_CH].SLAST = tcd->slast;
+    DMA0->TCD[PULSE_DMA_PAT_CH].DADDR = tcd->daddr;
+    DMA0->TCD[PULSE_DMA_PAT_CH].DOFF = tcd->doff;
+    DMA0->TCD[PULSE_DMA_PAT_CH].DLAST_SGA = tcd->dlast_sga;
+    DMA0->TCD[PULSE_DMA_PAT_CH].CSR = tcd->csr;
+}
+/**********************************************************************************
+* pulsePatEnd()-Private
+* Leaves pattern mode. The DMA finishes the entry it is on and its sync,
+* channel 2 stops requesting and leaves the DMAMUX free for a burst. FTM3
+* is left running on the last entry for pulseApply() or the burst. Called
+* with interrupts off or from the task.
+************************************************************************************/
+static void pulsePatEnd(void){
+    DMA0->CERQ = DMA_CERQ_CERQ(PULSE_DMA_PAT_CH);
+    while((DMA0->TCD[PULSE_DMA_PAT_CH].CSR & (DMA_CSR_ACTIVE_MASK|DMA_CSR_START_MASK)) != 0){}
+    while((DMA0->TCD[PULSE_DMA_SYNC_CH].CSR & (DMA_CSR_ACTIVE_MASK|DMA_CSR_START_MASK)) != 0){}
+    FTM3->CONTROLS[2].CnSC = 0;
+    DMAMUX->CHCFG[PULSE_DMA_PAT_CH] = 0;
+    DMA0->CINT = DMA_CINT_CINT(PULSE_DMA_PAT_CH);
+    NVIC_ClearPendingIRQ(DMA4_DMA20_IRQn);      // no stale block done after a restart
+    PulsePat.running = FALSE;
+}
+/**********************************************************************************
+* pulsePatFill()-Private
+* Refills every block the DMA has played, oldest first, the ring calls
+* with interrupts off as they are shared with the DMA ISR.
+************************************************************************************/
+static void pulsePatFill(void){
+    INT16U blk;
+    INT8U ready;
+    CPU_SR_ALLOC();
+    CPU_CRITICAL_ENTER();
+    ready = WaveRingNextFill(&PulsePat.ring, &blk);
+    CPU_CRITICAL_EXIT();
+    while(ready == TRUE){
+        pulsePatRender(blk);
+        CPU_CRITICAL_ENTER();
+        WaveRingFilled(&PulsePat.ring, blk);
+        ready = WaveRingNextFill(&PulsePat.ring, &blk);
+        CPU_CRITICAL_EXIT();
+    }
+}
+/**********************************************************************************
+* pulsePatRender()-Private
+* Fills block blk through the producer, then holds each period to at
+* least PULSE_PAT_MIN_PERIOD bus clocks and 0x10000 counts, and each CnV
+* to the output held high.
+************************************************************************************/
+static void pulsePatRender(INT16U blk){
+    PULSE_PAT_ENTRY *entries = &PulsePatBuf[blk * PULSE_PAT_BLOCK_LEN];
+    INT32U minmod = ((PULSE_PAT_MIN_PERIOD + (1u << PulsePat.pwm.ps) - 1u) >> PulsePat.pwm.ps) - 1u;
+    INT32U maxcnv;
+    INT16U i;
+
+    for(i = 0; i < PULSE_PAT_BLOCK_LEN; i++){
+        entries[i].mod = PulsePat.pwm.mod;
+        entries[i].cnv = 0;
+    }
+    PulsePat.fill(PulsePat.arg, &PulsePat.pwm, entries, PULSE_PAT_BLOCK_LEN);
+    for(i = 0; i < PULSE_PAT_BLOCK_LEN; i++){
+        if(entries[i].mod < minmod){
+            entries[i].mod = minmod;
+        }else if(entries[i].mod > 0xFFFFu){
+            entries[i].mod = 0xFFFFu;
+        }else{
+        }
+        maxcnv = (entries[i].mod < 0xFFFFu) ? (entries[i].mod + 1u) : 0xFFFFu;
+        if(entries[i].cnv > maxcnv){
+            entries[i].cnv = maxcnv;
+        }else{
+        }
+    }
+}
+/***************************************************************************************
+ * DMA4_DMA20_IRQHandler()-Public
+ * Pattern block played, scatter-gather already loaded the next TCD. Hands
+ * the block back to the ring and wakes the task to refill it.
+ ***************************************************************************************/
+void DMA4_DMA20_IRQHandler(void){
+    OS_ERR os_err;
+    OSIntEnter();
+    DMA0->CINT = DMA_CINT_CINT(PULSE_DMA_PAT_CH);
+    (void)WaveRingBlockDone(&PulsePat.ring);
+    (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+    OSIntExit();
+}
+/***************************************************************************************
+ * DMA3_DMA19_IRQHandler()-Public
+ * Stop DMA finished in the last period of a burst, the idle C(n)V wait for
+ * its reload. Turns on the overflow interrupt for the FTM3 ISR to stop the
+ * counter there. Late past that reload, it stops at a later one with the
+ * outputs already idle.
+ ***************************************************************************************/
+void DMA3_DMA19_IRQHandler(void){
+    OSIntEnter();
+    DMA0->CINT = DMA_CINT_CINT(PULSE_DMA_STOP_CH);
+    PulseBurst.stopping = TRUE;
+    FTM3->SC = (FTM3->SC & ~FTM_SC_TOF_MASK) | FTM_SC_TOIE(1);     /* overflow of an older period does not count */
+    OSIntExit();
+}
+/***************************************************************************************
+ * PORTE_IRQHandler()-Public
+ * Rising edge on the PTE27 trigger, arms a burst if one may start.
+ ***************************************************************************************/
+void PORTE_IRQHandler(void){
+    OSIntEnter();
+    PORTE->ISFR = GPIO_PIN(PULSE_TRIG_PIN);          // write 1 clears the flag
+    if((PulseBurst.ready == TRUE) && (PulseBurst.running == FALSE)){
+        pulseBurstStart();
+    }else{
+    }
+    OSIntExit();
+}
+/***************************************************************************************
+ * FTM3_IRQHandler()-Public
+ * FTM3 overflow, at the counter maximum where synchronized MOD and CnV load,
+ * or channel 3 match. Enabled for three jobs:
+ * A prescaler, alignment or bank layout change from pulseApply(), on the
+ * first overflow or match at the end of a pulse, where the counter
+ * restarts with it.
+ * A sequence, on the overflow once per period. MOD and CnV written here
+ * load at the next reload, so when a step's count runs out the next step,
+ * and the bank's C(n)V for it, is written one period ahead and every step
+ * keeps its whole count. After the last step the own setting is loaded and
+ * the task is woken to put back its own alignment and prescaler.
+ * The end of a burst, on the overflow after the stop DMA, with the outputs
+ * idle from the reload. The counter is stopped, PulseBurstPend() posted
+ * and the task woken if a setting waits for the stop.
+ * The interrupt turns itself off when none is left.
+ ***************************************************************************************/
+void FTM3_IRQHandler(void){
+    INT8U idx;
+    OS_ERR os_err;
+    OSIntEnter();
+    FTM3->SC &= ~FTM_SC_TOF_MASK;                   // read then write 0 clears the overflow flag
+    if(PulseBurst.stopping == TRUE){
+        FTM3->SC = PulseBurst.sc;                   // clock off, holds the idle outputs
+        PulseBurst.stopping = FALSE;
+        PulseBurst.running = FALSE;
+        if(PulseBurst.pending == TRUE){
+            (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+        }else{
+        }
+        (void)OSSemPost(&PulseBurstDone, OS_OPT_POST_1, &os_err);
+    }else if(PulseSync.restart == TRUE){
+        pulseRestart(&PulseSync.pwm);
+        PulseSync.restart = FALSE;
+    }else if(PulseSeq.seq.left > 0){
+        if(WaveSeqAdvance(&PulseSeq.seq, 1) == TRUE){
+            idx = PulseSeq.seq.index;               // num_steps once stopped, the own setting
+            FTM3->MOD = FTM_MOD_MOD(PulseSeq.mod[idx]);
+            FTM3->CONTROLS[3].CnV = FTM_CnV_VAL(PulseSeq.cnv[idx]);
+            pulseBankLoad(PulseSeq.bankcv[idx]);
+            FTM3->SYNC |= FTM_SYNC_SWSYNC(1);
+            if(PulseSeq.seq.left == 0){
+                (void)OSTaskSemPost(&PulsewaveTaskTCB, OS_OPT_POST_NONE, &os_err);
+            }else{
+            }
+        }else{
+        }
+    }else{
+    }
+    if((PulseSync.restart == FALSE) && (PulseSeq.seq.left == 0) && (PulseBurst.stopping == FALSE)){
+        FTM3->SC &= ~FTM_SC_TOIE_MASK;
+    }else{
+    }
+    OSIntExit();
 }
@@ -7,8 +7,55 @@
 #ifndef PULSETRAIN_H_
 #define PULSETRAIN_H_
 
+#include "WavePwm.h"
+#include "WaveSeq.h"
+
+/* Channel bank, pulses on FTM3 channel pairs sharing the pulse train period.
+   Phase and duty in PULSE_BANK_FULL of a period.                          */
+#define PULSE_BANK_MAX_CH   3u          /* pairs 0, 2 and 3, pair 1 has the pulse output */
+#define PULSE_BANK_FULL     WAVE_PWM_EDGE_FULL
+typedef enum {PULSE_BANK_HIGH, PULSE_BANK_LOW, PULSE_BANK_COMP} PULSE_BANK_MODE;
+typedef struct{
+    INT8U  pair;        /* 0 on PTE5/PTE6, 2 on PTE9/PTE10, 3 on PTE11/PTE12  */
+    INT8U  mode;        /* PULSE_BANK_HIGH high pulse on the first pin,
+                           PULSE_BANK_LOW low pulse on the first pin,
+                           PULSE_BANK_COMP high pulse on the first pin and its
+                           complement, with dead time, on the second        */
+    INT16U phase;       /* start of the pulse into the period               */
+    INT16U duty;        /* width, phase + duty at most PULSE_BANK_FULL      */
+} PULSE_BANK_CH;
+
+#define PULSE_BURST_MAX     32767u      /* pulses in a burst, the DMA major loop count */
+
+/* Pattern, one FTM3 MOD and CnV per period streamed by the DMA from a ring
+   of blocks the producer refills. Only the low 16 bits are used, each
+   32-bit word is written to its register as it is.                        */
+#define PULSE_PAT_BLOCKS    4u          /* blocks in the ring                */
+#define PULSE_PAT_BLOCK_LEN 64u         /* periods per block, at most 511    */
+#define PULSE_PAT_MIN_PERIOD 120u       /* bus clocks, time for the DMA in a period */
+typedef struct{
+    INT32U mod;         /* FTM_MOD, period of mod + 1 counts                */
+    INT32U cnv;         /* FTM_CnV, pulse of cnv counts, mod + 1 held high  */
+} PULSE_PAT_ENTRY;
+/* Producer, fills num entries. They come in with the MOD of the pattern
+   frequency and a CnV of 0, counts are at the prescaler in pwm.           */
+typedef void (*PULSE_PAT_FILL)(void *arg, const WAVE_PWM *pwm, PULSE_PAT_ENTRY *entries, INT16U num);
+
 void PulseWaveInit(void);
 void SetPulseFreq(INT32U changefreq);
 void SetPulseDuty(INT32U duty_cycle);
+void SetPulseEnable(INT8U enable);
+void SetPulseSequence(const WAVE_SEQ_STEP *steps, INT8U num_steps, INT8U loop);
+INT8U GetPulseSeqActive(void);
+void SetPulseBank(const PULSE_BANK_CH *chans, INT8U num_ch, INT32U deadtime_ns);
+void SetPulseBurst(INT16U num);
+void PulseBurstArm(void);
+void PulseBurstPend(INT16U tout, OS_ERR *os_err);
+void SetPulsePattern(INT32U freq, PULSE_PAT_FILL fill, void *arg);
+INT32U GetPulsePatOverruns(void);
+void FTM3_IRQHandler(void);
+void DMA3_DMA19_IRQHandler(void);
+void PORTE_IRQHandler(void);
+void DMA4_DMA20_IRQHandler(void);
 
 #endif /* PULSETRAIN_H_ */
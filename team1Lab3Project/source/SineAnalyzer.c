@@ -0,0 +1,135 @@
+/****************************************************************************
+ * SineAnalyzer.c
+ * Optional quality check of the sine output. Once SetSinAnalyzer() gives it
+ * a channel and a period, a task below the processing task captures
+ * WAVE_ANA_SIZE of the channel's DAC codes with GetSinCapture() and runs
+ * the WaveAna.c FFT measurements on them: fundamental frequency error,
+ * THD and SFDR. The capture is a plain copy made by the renderer as it
+ * goes, so the analysis never holds up the DAC path, and all the float
+ * work runs at the lowest application priority. Off until first set.
+ ****************************************************************************/
+/*****************************************************************************
+ * Include header files
+ ****************************************************************************/
+#include "os.h"
+#include "app_cfg.h"
+#include "MCUType.h"
+#include "Sinewave.h"
+#include "WaveAna.h"
+#include "SineAnalyzer.h"
+
+typedef struct{
+    INT8U ch;                   //channel analyzed
+    INT16U period_ms;           //time between analyses, 0 for off
+    WAVE_ANA_RESULT result;     //last analysis
+    INT32U count;               //analyses made
+} SINE_ANA_DATA;
+static SINE_ANA_DATA SineAnaData;
+static INT16U SineAnaCodes[WAVE_ANA_SIZE];
+/*****************************************************************************************
+* Allocate task control blocks
+*****************************************************************************************/
+static OS_TCB SineAnalyzerTaskTCB;
+/*****************************************************************************************
+* Allocate task stack space.
+*****************************************************************************************/
+static CPU_STK SineAnalyzerTaskStk[APP_CFG_ANALYZER_TASK_STK_SIZE];
+/*****************************************************************************************
+* Mutex Key
+*****************************************************************************************/
+static OS_MUTEX SineAnaKey;
+/*****************************************************************************************
+* Task Function and Function Prototypes.
+*****************************************************************************************/
+static void SineAnalyzerTask(void *p_arg);
+/****************************************************************************************
+* SineAnalyzerInit()-Public
+* Creates the analyzer task, which sleeps until SetSinAnalyzer().
+****************************************************************************************/
+void SineAnalyzerInit(void){
+    OS_ERR os_err;
+
+    SineAnaData.ch = SINE_CH_DAC0;
+    SineAnaData.period_ms = 0;
+    SineAnaData.count = 0;
+    OSMutexCreate(&SineAnaKey, "Analyzer Key", &os_err);
+    OSTaskCreate(&SineAnalyzerTaskTCB,
+                 "SineAnalyzerTask",
+                 SineAnalyzerTask,
+                 (void *) 0,
+                 APP_CFG_ANALYZER_TASK_PRIO,
+                 &SineAnalyzerTaskStk[0],
+                 (APP_CFG_ANALYZER_TASK_STK_SIZE/10u),
+                 APP_CFG_ANALYZER_TASK_STK_SIZE,
+                 0,
+                 0,
+                 (void *) 0,
+                 (OS_OPT_TASK_NONE),
+                 &os_err);
+}
+/***********************************************************************************
+ * SineAnalyzerTask()-Private
+ * Every period_ms captures the channel and analyzes it. Sleeps on its
+ * semaphore while off. A capture that fails, with the output idle, is
+ * skipped until the next period.
+ **********************************************************************************/
+static void SineAnalyzerTask(void *p_arg){
+    SINE_CAPTURE_INFO info;
+    WAVE_ANA_RESULT result;
+    INT16U period;
+    INT8U ch;
+    OS_ERR os_err;
+
+    (void)p_arg;
+    while(1){
+        OSMutexPend(&SineAnaKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+        period = SineAnaData.period_ms;
+        ch = SineAnaData.ch;
+        OSMutexPost(&SineAnaKey,OS_OPT_NONE,&os_err);
+        if(period == 0){
+            (void)OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err); /* posted by SetSinAnalyzer() */
+        }else{
+            OSTimeDly(period, OS_OPT_TIME_DLY, &os_err);
+            if(GetSinCapture(ch, &SineAnaCodes[0], WAVE_ANA_SIZE, &info) == TRUE){
+                WaveAnaRun(&SineAnaCodes[0], info.sample_rate, (FP32)info.freq, &result);
+                OSMutexPend(&SineAnaKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+                SineAnaData.result = result;
+                SineAnaData.count++;
+                OSMutexPost(&SineAnaKey,OS_OPT_NONE,&os_err);
+            }else{
+            }
+        }
+    }
+}
+/**************************************************************************************
+* SetSinAnalyzer()-Public function
+* Analyzes channel ch every period_ms, period_ms 0 turns the analyzer off.
+****************************************************************************************/
+void SetSinAnalyzer(INT8U ch, INT16U period_ms){
+    OS_ERR os_err;
+    OSMutexPend(&SineAnaKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    if((SineAnaData.period_ms == 0) && (period_ms != 0)){
+        (void)OSTaskSemPost(&SineAnalyzerTaskTCB, OS_OPT_POST_NONE, &os_err);
+    }else{
+    }
+    SineAnaData.ch = ch;
+    SineAnaData.period_ms = period_ms;
+    OSMutexPost(&SineAnaKey,OS_OPT_NONE,&os_err);
+}
+/**************************************************************************************
+* GetSinAnalysis()-Public function
+* Copies the last analysis into result and returns how many have been made,
+* 0 if none yet, when result is left alone.
+****************************************************************************************/
+INT32U GetSinAnalysis(WAVE_ANA_RESULT *result){
+    INT32U count;
+    OS_ERR os_err;
+    OSMutexPend(&SineAnaKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+    count = SineAnaData.count;
+    if(count > 0){
+        *result = SineAnaData.result;
+    }else{
+    }
+    OSMutexPost(&SineAnaKey,OS_OPT_NONE,&os_err);
+    return count;
+}
@@ -0,0 +1,13 @@
+/****************************************************************************
+ * SineAnalyzer.h
+ * Header file for SineAnalyzer.c
+ * Include WaveAna.h first.
+ ****************************************************************************/
+#ifndef SINEANALYZER_H_
+#define SINEANALYZER_H_
+
+void SineAnalyzerInit(void);
+void SetSinAnalyzer(INT8U ch, INT16U period_ms);
+INT32U GetSinAnalysis(WAVE_ANA_RESULT *result);
+
+#endif /* SINEANALYZER_H_ */
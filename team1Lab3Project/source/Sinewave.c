@@ -1,7 +1,41 @@
 /****************************************************************************
  * Sinewave.c
  * Program uses fixed point math to generate a sinewave. DMA sends samples
- * to the DAC and outputs to DAC0.
+ * to the DACs and outputs to DAC0 and DAC1. Each DAC is a channel with its
+ * own frequency, amplitude and generator selected with SetSinShape(), the
+ * sine from the table-driven DDS engine in WaveDDS.c and the other shapes
+ * from WaveGen.c, the table shapes from band-limited octave tables.
+ * SetSinTones() sets the harmonics summed by the WAVE_SHAPE_TONES generator
+ * in WaveTone.c. The noise shapes come from each channel's own PRNG in
+ * WaveNoise.c. SetSinSweep() chirps a channel's sine from one frequency to
+ * another with WaveSweep.c and the processing task runs the whole sweep on
+ * its own. SetSinMod() adds AM or FM from a block-rate LFO in WaveMod.c.
+ * SetSinUpsample() renders the tones shape at 1/WAVE_INTERP_L of the DAC
+ * rate and raises it to that rate with the WaveInterp.c polyphase FIR.
+ * SetSinFx() runs each channel's block through a WaveFx.c chain of
+ * filters and effects before it is formatted for the DAC.
+ * SetSinSequence() plays a table of shape/frequency/amplitude steps on a
+ * channel with WaveSeq.c, each transition on its exact sample.
+ * GetSinCapture() copies a run of one channel's DAC codes out of the
+ * stream, or out of the cached loop, for analysis by a lower priority task.
+ * One processing task renders both channels per block.
+ * The channels share one sample trigger. With APP_CFG_WAVE_DAC_FIFO each
+ * DAC plays its hardware buffer from a PDB interval trigger and its own DMA
+ * channel refills it a burst at a time at the buffer flags, see
+ * WaveDacBuf.c. Otherwise, or where the block does not fit the bursts,
+ * the PIT triggers one DMA channel whose minor loop writes a DAC0/DAC1
+ * frame, DOFF steps from DAC0 to DAC1 and the minor loop offset steps back.
+ * Either way the two outputs update together.
+ * The DMA plays an N-block ring of TCDs linked by scatter-gather,
+ * WaveRing.c tracks which block is free to refill.
+ * The sample loop itself, generators to DAC frames, is WaveRender.c, which
+ * has no OS or hardware dependencies so the host bench times the same code.
+ * The ISR stamps each finished block with the DWT cycle counter so the task
+ * can measure render time and deadline slack per block, GetSinStats().
+ * Once the settings hold still the output switches to
+ * a cached loop of whole periods that the DMA replays with no CPU at all.
+ * While disabled with SetSinEnable() or with every amplitude at 0 the
+ * trigger and DMA are stopped, the DACs hold mid-scale and the task sleeps.
  * Created by: Karen Aguilar,Rodrick Muya 03/06/2022
  ****************************************************************************/
 /*****************************************************************************
@@ -11,27 +45,136 @@
 #include "app_cfg.h"
 #include "MCUType.h"
 #include "K65TWR_GPIO.h"
+#include "K65TWR_ClkCfg.h"
+#include "WaveRender.h"
 #include "SineWave.h"
-#include "arm_common_tables.h"
-#include "arm_math.h"
+#include "WaveDDS.h"
+#include "WaveDac.h"
+#include "WaveDacBuf.h"
+#include "WaveRing.h"
+#include "WaveStat.h"
 
 typedef struct{
-    INT8U index;
+    WAVE_RING ring;
     OS_SEM flag;
+    INT32U done_cyc[APP_CFG_WAVE_NUM_BLOCKS];   //DWT cycle count when each block finished playing
+    INT32U deadline;    //cycles from a block finishing to the DMA needing it again
 }DMA_BLOCK_RDY;
+/* Block timing, written by the task and ISR in critical sections */
+typedef struct{
+    WAVE_STAT render;   //cycles to render a block
+    WAVE_STAT slack;    //cycles left before the DMA reached the block, <0 late
+    INT32U late;        //blocks rendered after their deadline
+    INT32U overruns;    //blocks the DMA played stale, all streams
+}SINE_STAT_DATA;
+/* eDMA TCD as laid out in the channel registers, loaded from RAM on
+ * scatter-gather. Must be 32 byte aligned.                                 */
+typedef struct{
+    INT32U saddr;
+    INT16U soff;
+    INT16U attr;
+    INT32U nbytes;
+    INT32U slast;
+    INT32U daddr;
+    INT16U doff;
+    INT16U citer;
+    INT32U dlast_sga;
+    INT16U csr;
+    INT16U biter;
+}DMA_TCD;
+/* Sweep request, from freq to SINE_CH_VALUE.freq */
+typedef struct {
+    INT16U  from;       //start frequency, 0 for no sweep
+    INT32U  time_ms;    //sweep duration
+    INT8U   law;        //WAVE_SWEEP_LAW
+} SINE_SWEEP_SET;
+/* Sequence request, the steps are copied from the caller */
+typedef struct {
+    const WAVE_SEQ_STEP *steps;
+    INT8U   num_steps;
+    INT8U   loop;       //TRUE repeats the sequence
+    INT16U  maxfreq;    //highest step frequency
+} SINE_SEQ_SET;
+/* Modulation request */
+typedef struct {
+    INT8U   type;       //WAVE_MOD_TYPE
+    INT16U  rate;       //LFO rate, 0.01 Hz
+    INT16U  depth;      //AM percent or FM deviation Hz
+} SINE_MOD_SET;
+/* Settings of one DAC channel */
 typedef struct {
-    INT16U  sinefreq;   //frequency of sinewave
-    INT8U   sineamp;    //amplitude of sinewave
+    INT16U  freq;       //frequency of the channel, end frequency of a sweep
+    INT8U   amp;        //amplitude of the channel
+    INT8U   shape;      //WAVE_SHAPE to generate
+    INT8U   shapenew;   //TRUE until the processing task picks up shape/usertable/tones
+    INT16S  usertable[WAVE_USER_SIZE]; //one period for WAVE_SHAPE_USER, Q15
+    WAVE_TONE_SET tones[WAVE_TONE_MAX]; //harmonics for WAVE_SHAPE_TONES
+    INT8U   tonenum;    //tones used
+    SINE_SWEEP_SET sweep;   //sweep set with freq
+    INT8U   sweepnew;   //TRUE until the processing task picks up sweep
+    INT8U   sweeping;   //TRUE from SetSinSweep() until the sweep ends
+    SINE_MOD_SET mod;   //LFO modulation
+    INT8U   modnew;     //TRUE until the processing task picks up mod
+    WAVE_FX_SET fx[WAVE_FX_MAX_STAGES]; //effects chain, in order
+    INT8U   fxnum;      //stages used in fx
+    INT8U   fxnew;      //TRUE until the processing task picks up fx
+    WAVE_SEQ_STEP seq[WAVE_SEQ_MAX_STEPS]; //sequence steps, in order
+    INT8U   seqnum;     //steps used in seq, 0 for no sequence
+    INT8U   seqloop;    //TRUE repeats the sequence
+    INT16U  seqfreq;    //highest step frequency, planned with freq
+    INT8U   seqnew;     //TRUE until the processing task picks up seq
+    INT8U   sequencing; //TRUE from SetSinSequence() until the sequence ends
+} SINE_CH_VALUE;
+typedef struct {
+    SINE_CH_VALUE ch[SINE_NUM_CH];
+    WAVE_PLAN plan;     //shared sample rate and block size for the channel freqs
+    INT32U  steps[SINE_NUM_CH];     //phase step per channel at the plan rate
+    INT8U   plannew;    //TRUE until the processing task picks up plan
+    INT8U   upsample;   //TRUE to render at 1/WAVE_INTERP_L rate, set with plan
+    WAVE_LOOP loop;     //whole-period loop for steady-state playback
+    INT32U  loopsteps[SINE_NUM_CH]; //phase step per channel in the loop
+    INT8U   loopok;     //TRUE if loop meets WAVE_LOOP_MAX_PPM
+    INT8U   enabled;    //FALSE parks the engine, SetSinEnable()
+    INT8U   parked;     //TRUE while the task sleeps, cached loop or idle
+    INT16U  cachedlen;  //frames of the loop in DMABuffer while parked on it, else 0
+    INT32U  cachedldval;    //PIT reload the loop plays at
 } WAVE_VALUE;
+/* Capture for GetSinCapture(). The reader arms it and the processing task
+ * fills buf as it renders, then posts done. state alone hands buf over,
+ * so the renderer never waits on the reader.                              */
+typedef struct {
+    INT16U  *buf;
+    INT32U  num;                //codes wanted
+    INT32U  fill;               //codes captured so far
+    INT32U  pit_ldval;          //PIT reload the codes play at
+    INT8U   ch;
+    volatile INT8U state;       //SINE_CAP_STATE
+    OS_SEM  done;
+} SINE_CAP_DATA;
+typedef enum {SINE_CAP_IDLE, SINE_CAP_ARMED} SINE_CAP_STATE;
+typedef enum {SINE_STREAM, SINE_CACHED, SINE_IDLE} SINE_OUT_STATE;
 static WAVE_VALUE SineData;
 
 #define SIZE_CODE_16BIT 001
-#define SAMPLES_PER_BLOCK 128
-#define WAVE_DMA_OUT_CH 0
-#define NUM_BLOCKS                  2
+#define WAVE_DMA_OUT_CH 0           // PIT frames, or the DAC0 buffer
+#define WAVE_DMA_DAC1_CH 1          // DAC1 buffer
+#define SINE_DMA_SRC_DAC0   45      // DMAMUX sources
+#define SINE_DMA_SRC_DAC1   46
+#define SINE_DMA_SRC_ALWAYS 60
+#define NUM_BLOCKS                  APP_CFG_WAVE_NUM_BLOCKS
+#if (NUM_BLOCKS < 2)
+#error "APP_CFG_WAVE_NUM_BLOCKS must be at least 2"
+#endif
+#if (SINE_NUM_CH != WAVE_RENDER_NUM_CH)
+#error "WaveRender.c renders the DAC0/DAC1 frames of SINE_NUM_CH channels"
+#endif
 #define WAVE_BYTES_PER_SAMPLE       2
-#define BYTES_PER_BLOCK             (SAMPLES_PER_BLOCK * WAVE_BYTES_PER_SAMPLE)
-#define BYTES_PER_BUFFER            (NUM_BLOCKS * BYTES_PER_BLOCK)
+#define SINE_FRAME_BYTES            (SINE_NUM_CH * WAVE_BYTES_PER_SAMPLE)
+#define SINE_DAC_STRIDE             (DAC1_BASE - DAC0_BASE)     // DOFF from DAC0 to DAC1
+#define SINE_BUFFER_SAMPLES         (NUM_BLOCKS * WAVE_PLAN_MAX_BLOCK)
+#define SINE_CPU_PER_BUS            (SYSTEM_CLOCK / WAVE_BUS_CLK)  // DWT cycles per PIT clock
+#define SINE_CACHE_SETTLE_BLOCKS    (WAVE_PLAN_BLOCK_RATE / 2)  // ~0.5s unchanged before caching
+#define SINE_CAP_TIMEOUT            1000u   // ticks GetSinCapture() waits for the stream
 
 /*****************************************************************************************
 *  Mutex Key
@@ -49,24 +192,99 @@ static CPU_STK sinewaveProcTaskSTK[APP_CFG_PROC_TASK_STK_SIZE];
 * Functions Declarations
 *******************************************************************************************/
 static void sinewaveProcTask(void *p_arg);
-static INT8U DMAPingPend(OS_TICK tout, OS_ERR *os_err_ptr); // may need to be static
-static INT16U GetSinFreq(void);
-static INT8U GetSinAmp(void);
+static void DMABlockPend(OS_TICK tout, OS_ERR *os_err_ptr);
+static INT8U DMABlockNext(INT16U *index);
+static void DMABlockFilled(INT16U index, INT32U start_cyc);
+static INT8U GetSinPlan(WAVE_PLAN *plan, INT32U *steps);
+static INT8U sineUpdateAmps(void);
+static void sineDmaLoad(INT8U dma_ch, const DMA_TCD *tcd);
+static void sineTrigStart(const INT16U *frames);
+static void sineTcdSet(DMA_TCD *tcd, INT8U dac, INT16U *src, INT32U num_frames, INT32U frame, INT32S slast,
+                       INT32U sga, INT16U csr);
+static void sineDmaStartRing(const WAVE_PLAN *plan);
+static void sineDmaStartLoop(const WAVE_LOOP *loop);
+static void sineDmaStop(void);
+static INT8U sineUpdateShapes(void);
+static void sineStartStream(const WAVE_PLAN *plan, const INT32U *steps);
+static INT8U sineStartCached(void);
+static INT8U sineStartIdle(INT8U busy);
+static void sineResetPhases(void);
+static void sineWake(void);
+static void sineSetFreq(INT8U ch, INT16U changefreq, const SINE_SWEEP_SET *sweep, const SINE_SEQ_SET *seq);
+static INT8U sineSweepsDone(void);
+static INT8U sineUpdateMods(const WAVE_PLAN *plan, INT8U plan_new);
+static INT8U sineUpdateFx(const WAVE_PLAN *plan, INT8U plan_new);
+static INT8U sineUpdateSeqs(const WAVE_PLAN *plan, INT8U plan_new);
+static void sineCaptureFrames(const INT16U *frames, INT32U num_frames, INT32U pit_ldval, INT8U restart);
+static void sineCaptureLoop(const INT16U *frames, INT32U num_frames, INT8U ch, INT16U *codes, INT32U num);
 /*******************************************************************************************
 * Variable Declarations
 *******************************************************************************************/
 static DMA_BLOCK_RDY dmaInBlockRdy;
-static INT16U DMABuffer[NUM_BLOCKS][SAMPLES_PER_BLOCK]; // full double-buffering (ping-pong)
+static INT16U DMABuffer[SINE_NUM_CH * SINE_BUFFER_SAMPLES] __ALIGNED(4); // DAC0/DAC1 frames, ring blocks or the cached loop
+static DMA_TCD SineTcdRing[SINE_NUM_CH][NUM_BLOCKS] __ALIGNED(32);  // one TCD per ring block and DMA channel
+static WAVE_DAC_BUF SineDacBuf;                             // trigger and DMA geometry playing now
+static WAVE_RENDER_CH SineChan[SINE_NUM_CH];               // generator per DAC
+static SINE_STAT_DATA SineStatData;
+static INT8U SineUpsample;                                  // task copy of SineData.upsample
+static SINE_CAP_DATA SineCap;
 /******************************************************************************
-* SineWaveInit() - Initializes the WaveGen module including PIT DMA and DAC
+* SineWaveInit() - Initializes the WaveGen module including PIT DMA and DACs
 * for sinewave.
 * Created by: Karen Aguilar, Rodrick Muya 03/09/2022
 ******************************************************************************/
 void SineWaveInit(void){
     OS_ERR os_err;
+    INT8U ch;
 
-    dmaInBlockRdy.index = 1;
+    WaveRingInit(&dmaInBlockRdy.ring, NUM_BLOCKS);
+    SineStatsReset();
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     // DWT cycle counter for block timing
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    WavePlanForFreq(0, &SineData.plan);      // placeholder until SetSinFreq()
+    SineData.plannew = TRUE;
+    SineData.loopok = FALSE;
+    SineData.parked = FALSE;
+    SineData.enabled = TRUE;
+    SineData.upsample = FALSE;
+    SineData.cachedlen = 0;
+    SineCap.state = SINE_CAP_IDLE;
+    for(ch = 0; ch < SINE_NUM_CH; ch++){
+        SineData.ch[ch].shape = WAVE_SHAPE_SINE;
+        SineData.ch[ch].shapenew = FALSE;
+        SineData.ch[ch].sweep.from = 0;
+        SineData.ch[ch].sweepnew = FALSE;
+        SineData.ch[ch].sweeping = FALSE;
+        SineChan[ch].sweep.remaining = 0;
+        SineData.ch[ch].mod.type = WAVE_MOD_OFF;
+        SineData.ch[ch].mod.rate = 0;
+        SineData.ch[ch].mod.depth = 0;
+        SineData.ch[ch].modnew = FALSE;
+        WaveModStart(&SineChan[ch].mod, WAVE_MOD_OFF, 0, 0, SineData.plan.sample_rate);
+        SineData.ch[ch].fxnum = 0;
+        SineData.ch[ch].fxnew = FALSE;
+        WaveFxChainInit(&SineChan[ch].fx, &SineData.ch[ch].fx[0], 0, SineData.plan.sample_rate);
+        SineData.ch[ch].seqnum = 0;
+        SineData.ch[ch].seqfreq = 0;
+        SineData.ch[ch].seqnew = FALSE;
+        SineData.ch[ch].sequencing = FALSE;
+        WaveSeqStart(&SineChan[ch].seq, 0, FALSE);
+        SineChan[ch].shape = WAVE_SHAPE_SINE;
+        SineData.steps[ch] = 0;
+        SineChan[ch].interpready = FALSE;
+        SineData.ch[ch].tonenum = 0;
+        WaveToneSet(&SineChan[ch].tones, &SineData.ch[ch].tones[0], 0);
+        SineChan[ch].gen.tones = &SineChan[ch].tones;
+        WaveNoiseSeed(&SineChan[ch].noise, ch);                 // uncorrelated channels
+        SineChan[ch].gen.noise = &SineChan[ch].noise;
+        WaveMipBuildUser(&SineChan[ch].usermip, &SineData.ch[ch].usertable[0]);
+        SineChan[ch].gen.user = &SineChan[ch].usermip;
+        WaveGenInit(&SineChan[ch].gen, WAVE_SHAPE_SINE);
+    }
     OSMutexCreate(&SineKey, "Sine Key", &os_err);
+    OSSemCreate(&(dmaInBlockRdy.flag), "DMA Block Ready", 0, &os_err);
+    OSSemCreate(&SineCap.done, "Sine Capture", 0, &os_err);
 
     OSTaskCreate(&SineWaveGenTCB,                  /* Create Sine wave Processing Task              */
                 "ProcessingTask",
@@ -79,160 +297,1297 @@ void SineWaveInit(void){
                 0,
                 0,
                 (void *) 0,
-                (OS_OPT_TASK_NONE),
+                (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),   /* stack use for GetSinStats() */
                 &os_err);
 
     SIM->SCGC6 |= SIM_SCGC6_PIT(1);     // Turn on PIT Clock
+    SIM->SCGC6 |= SIM_SCGC6_PDB(1);     // PDB, DAC buffer triggers
     SIM->SCGC2 |= SIM_SCGC2_DAC0(1);    // Turn on DAC Clock
+    SIM->SCGC2 |= SIM_SCGC2_DAC1(1);
     SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
     SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;   //Turn on DMA Clock
 
-    // DAC initialization
+    // DAC initialization, buffer and DMA requests set per start by sineTrigStart()
     DAC0->C0 |= DAC_C0_DACEN(1);        //Enable DAC throwing a hard fault
-    DAC0->C1 |= DAC_C1_DMAEN(1);        // DMA Request
     DAC0->C0 |= DAC_C0_DACRFS(1);       //sets Vreference to DACREF_1 =1.65V
+    DAC1->C0 |= DAC_C0_DACEN(1);
+    DAC1->C0 |= DAC_C0_DACRFS(1);
     //PIT Initialization
     PIT->MCR = PIT_MCR_MDIS(0);         //Enable PIT clock
-    PIT->CHANNEL[0].LDVAL = 1249 ;      //set to 48khz freq (Buss clock = 60MHz, 1/19200sps)
-    PIT->CHANNEL[0].TCTRL = (PIT_TCTRL_TEN(1)); //Enable PIT
     //DMA Initialization
-    DMAMUX->CHCFG[WAVE_DMA_OUT_CH] &= ~(DMAMUX_CHCFG_ENBL_MASK|DMAMUX_CHCFG_TRIG_MASK);
+    DMA0->CR |= DMA_CR_EMLM(1);         //minor loop offset steps DADDR back to DAC0
 
-    DMA0->TCD[WAVE_DMA_OUT_CH].SADDR = DMA_SADDR_SADDR(&DMABuffer[0][0]);
+    NVIC_EnableIRQ(DMA0_DMA16_IRQn); //Enables Interrupts
+    sineDmaStartRing(&SineData.plan);
+}
+/******************************************************************************
+* sineDmaLoad() - Private
+* Copies tcd into DMA channel dma_ch. CSR is written last with DONE already
+* clear, or the ESG bit would not take.
+******************************************************************************/
+static void sineDmaLoad(INT8U dma_ch, const DMA_TCD *tcd){
 
-    DMA0->TCD[WAVE_DMA_OUT_CH].ATTR = (DMA_ATTR_SMOD(0)|DMA_ATTR_SSIZE(SIZE_CODE_16BIT)|DMA_ATTR_DMOD(0)|DMA_ATTR_DSIZE(SIZE_CODE_16BIT)); //001 this may be different
-    DMA0->TCD[WAVE_DMA_OUT_CH].SOFF = DMA_SOFF_SOFF(WAVE_BYTES_PER_SAMPLE);
-    DMA0->TCD[WAVE_DMA_OUT_CH].NBYTES_MLNO = DMA_NBYTES_MLNO_NBYTES(WAVE_BYTES_PER_SAMPLE);
-    DMA0->TCD[WAVE_DMA_OUT_CH].CITER_ELINKNO = DMA_CITER_ELINKNO_ELINK(0)|DMA_CITER_ELINKNO_CITER(NUM_BLOCKS * SAMPLES_PER_BLOCK); //how long each block is in memory buffer
-    DMA0->TCD[WAVE_DMA_OUT_CH].BITER_ELINKNO = DMA_BITER_ELINKNO_ELINK(0)|DMA_BITER_ELINKNO_BITER(NUM_BLOCKS * SAMPLES_PER_BLOCK); //samples per block needs to be buffer size
-    DMA0->TCD[WAVE_DMA_OUT_CH].SLAST = DMA_SLAST_SLAST(-(BYTES_PER_BUFFER));
-    DMA0->TCD[WAVE_DMA_OUT_CH].DADDR = DMA_DADDR_DADDR(&DAC0->DAT[0].DATL);
-    DMA0->TCD[WAVE_DMA_OUT_CH].DOFF = DMA_DOFF_DOFF(0);
-    DMA0->TCD[WAVE_DMA_OUT_CH].DLAST_SGA = DMA_DLAST_SGA_DLASTSGA(0);
+    DMA0->CDNE = DMA_CDNE_CDNE(dma_ch);
+    DMA0->TCD[dma_ch].SADDR = tcd->saddr;
+    DMA0->TCD[dma_ch].ATTR = tcd->attr;
+    DMA0->TCD[dma_ch].SOFF = tcd->soff;
+    DMA0->TCD[dma_ch].NBYTES_MLOFFYES = tcd->nbytes;
+    DMA0->TCD[dma_ch].CITER_ELINKNO = tcd->citer;
+    DMA0->TCD[dma_ch].BITER_ELINKNO = tcd->biter;
+    DMA0->TCD[dma_ch].SLAST = tcd->slast;
+    DMA0->TCD[dma_ch].DADDR = tcd->daddr;
+    DMA0->TCD[dma_ch].DOFF = tcd->doff;
+    DMA0->TCD[dma_ch].DLAST_SGA = tcd->dlast_sga;
+    DMA0->TCD[dma_ch].CSR = tcd->csr;
+}
+/******************************************************************************
+* sineTrigStart() - Private
+* Sets the DACs and DMAMUX up for SineDacBuf and starts the trigger on the
+* TCDs already loaded. With the DAC buffers every word starts on the first
+* frame, which holds until the first burst plays WAVE_DACBUF_BURST
+* triggers later, and the PDB counts a whole number of intervals so its
+* wrap leaves them even.
+******************************************************************************/
+static void sineTrigStart(const INT16U *frames){
+    INT8U word;
 
-    DMA0->TCD[WAVE_DMA_OUT_CH].CSR = DMA_CSR_ESG(0) | DMA_CSR_MAJORELINK(0) | DMA_CSR_BWC(3) |DMA_CSR_INTHALF(1)|
-                                     DMA_CSR_INTMAJOR(1) ; //this may be wrong
-    DMAMUX->CHCFG[WAVE_DMA_OUT_CH] = DMAMUX_CHCFG_ENBL(1) | DMAMUX_CHCFG_TRIG(1) | DMAMUX_CHCFG_SOURCE(60); // Enables Source to DMA this may be wrong
+    DMAMUX->CHCFG[WAVE_DMA_OUT_CH] = 0;
+    DMAMUX->CHCFG[WAVE_DMA_DAC1_CH] = 0;
+    if(SineDacBuf.fifo == TRUE){
+        for(word = 0; word < WAVE_DACBUF_WORDS; word++){
+            DAC0->DAT[word].DATL = DAC_DATL_DATA0(frames[SINE_CH_DAC0]);
+            DAC0->DAT[word].DATH = DAC_DATH_DATA1(frames[SINE_CH_DAC0] >> 8);
+            DAC1->DAT[word].DATL = DAC_DATL_DATA0(frames[SINE_CH_DAC1]);
+            DAC1->DAT[word].DATH = DAC_DATH_DATA1(frames[SINE_CH_DAC1] >> 8);
+        }
+        DAC0->C2 = DAC_C2_DACBFRP(SineDacBuf.start) | DAC_C2_DACBFUP(SineDacBuf.upper);
+        DAC1->C2 = DAC_C2_DACBFRP(SineDacBuf.start) | DAC_C2_DACBFUP(SineDacBuf.upper);
+        DAC0->C1 = DAC_C1_DMAEN(1) | DAC_C1_DACBFWM(SineDacBuf.watermark) | DAC_C1_DACBFMD(0) | DAC_C1_DACBFEN(1);
+        DAC1->C1 = DAC_C1_DMAEN(1) | DAC_C1_DACBFWM(SineDacBuf.watermark) | DAC_C1_DACBFMD(0) | DAC_C1_DACBFEN(1);
+        DAC0->SR = 0;                   // top flag left from reset or the last run
+        DAC1->SR = 0;
+        DAC0->C0 = DAC_C0_DACEN(1) | DAC_C0_DACRFS(1) | DAC_C0_DACTRGSEL(0) | DAC_C0_DACBTIEN(1) | DAC_C0_DACBWIEN(1);
+        DAC1->C0 = DAC_C0_DACEN(1) | DAC_C0_DACRFS(1) | DAC_C0_DACTRGSEL(0) | DAC_C0_DACBTIEN(1) | DAC_C0_DACBWIEN(1);
+        DMAMUX->CHCFG[WAVE_DMA_OUT_CH] = DMAMUX_CHCFG_ENBL(1) | DMAMUX_CHCFG_SOURCE(SINE_DMA_SRC_DAC0);
+        DMAMUX->CHCFG[WAVE_DMA_DAC1_CH] = DMAMUX_CHCFG_ENBL(1) | DMAMUX_CHCFG_SOURCE(SINE_DMA_SRC_DAC1);
+        DMA0->SERQ = DMA_SERQ_SERQ(WAVE_DMA_OUT_CH);
+        DMA0->SERQ = DMA_SERQ_SERQ(WAVE_DMA_DAC1_CH);
+        PDB0->SC = PDB_SC_PDBEN(1) | PDB_SC_CONT(1) | PDB_SC_TRGSEL(15);  // bus clock, software start
+        PDB0->MOD = SineDacBuf.pdb_mod;
+        PDB0->DAC[0].INT = SineDacBuf.ldval;
+        PDB0->DAC[1].INT = SineDacBuf.ldval;
+        PDB0->DAC[0].INTC = PDB_INTC_TOE(1);
+        PDB0->DAC[1].INTC = PDB_INTC_TOE(1);
+        PDB0->SC |= PDB_SC_LDOK(1);
+        PDB0->SC |= PDB_SC_SWTRIG(1);
+    }else{
+        DAC0->C0 = DAC_C0_DACEN(1) | DAC_C0_DACRFS(1);     // buffer off, DAT[0] converts on write
+        DAC1->C0 = DAC_C0_DACEN(1) | DAC_C0_DACRFS(1);
+        DAC0->C1 = 0;
+        DAC1->C1 = 0;
+        DMAMUX->CHCFG[WAVE_DMA_OUT_CH] = DMAMUX_CHCFG_ENBL(1) | DMAMUX_CHCFG_TRIG(1) | DMAMUX_CHCFG_SOURCE(SINE_DMA_SRC_ALWAYS);
+        DMA0->SERQ = DMA_SERQ_SERQ(WAVE_DMA_OUT_CH);  // enables dma channel
+        PIT->CHANNEL[0].LDVAL = SineDacBuf.ldval;
+        PIT->CHANNEL[0].TCTRL = (PIT_TCTRL_TEN(1)); //Enable PIT
+    }
+}
+/******************************************************************************
+* sineTcdSet() - Private
+* Fills a TCD that moves num_frames DAC0/DAC1 frames from src as SineDacBuf
+* says, frame being where they start in the ring. For PIT frames each minor
+* loop writes DAC0 then DAC1 and returns DADDR to DAC0, dac is ignored. For
+* the DAC buffers each minor loop writes a burst of DAC dac's samples into
+* its buffer, skipping the other channel's samples, and DMOD wraps DADDR.
+******************************************************************************/
+static void sineTcdSet(DMA_TCD *tcd, INT8U dac, INT16U *src, INT32U num_frames, INT32U frame, INT32S slast,
+                       INT32U sga, INT16U csr){
+    DAC_Type *dacs[SINE_NUM_CH] = {DAC0, DAC1};
+    INT32U requests;
 
-    NVIC_EnableIRQ(DMA0_DMA16_IRQn); //Enables Interrupts
-    //NVIC_EnableIRQ(0); //
-    DMA0->SERQ = DMA_SERQ_SERQ(0);  // enables dma channel
+    if(SineDacBuf.fifo == TRUE){
+        requests = num_frames / SineDacBuf.burst;
+        tcd->saddr = DMA_SADDR_SADDR(&src[dac]);
+        tcd->soff = DMA_SOFF_SOFF(SINE_FRAME_BYTES);
+        tcd->attr = (DMA_ATTR_SMOD(0)|DMA_ATTR_SSIZE(SIZE_CODE_16BIT)|DMA_ATTR_DMOD(SineDacBuf.dmod)|DMA_ATTR_DSIZE(SIZE_CODE_16BIT));
+        tcd->nbytes = DMA_NBYTES_MLOFFYES_SMLOE(0) | DMA_NBYTES_MLOFFYES_DMLOE(0) |
+                      DMA_NBYTES_MLOFFYES_NBYTES(SineDacBuf.burst * WAVE_BYTES_PER_SAMPLE);
+        tcd->daddr = DMA_DADDR_DADDR(&dacs[dac]->DAT[WaveDacBufWord(&SineDacBuf, frame)].DATL);
+        tcd->doff = DMA_DOFF_DOFF(WAVE_BYTES_PER_SAMPLE);
+    }else{
+        requests = num_frames;
+        tcd->saddr = DMA_SADDR_SADDR(src);
+        tcd->soff = DMA_SOFF_SOFF(WAVE_BYTES_PER_SAMPLE);
+        tcd->attr = (DMA_ATTR_SMOD(0)|DMA_ATTR_SSIZE(SIZE_CODE_16BIT)|DMA_ATTR_DMOD(0)|DMA_ATTR_DSIZE(SIZE_CODE_16BIT));
+        tcd->nbytes = DMA_NBYTES_MLOFFYES_SMLOE(0) | DMA_NBYTES_MLOFFYES_DMLOE(1) |
+                      DMA_NBYTES_MLOFFYES_MLOFF(-(INT32S)(SINE_NUM_CH * SINE_DAC_STRIDE)) |
+                      DMA_NBYTES_MLOFFYES_NBYTES(SINE_FRAME_BYTES);
+        tcd->daddr = DMA_DADDR_DADDR(&DAC0->DAT[0].DATL);
+        tcd->doff = DMA_DOFF_DOFF(SINE_DAC_STRIDE);
+    }
+    tcd->slast = DMA_SLAST_SLAST(slast);
+    tcd->citer = DMA_CITER_ELINKNO_ELINK(0)|DMA_CITER_ELINKNO_CITER(requests);
+    tcd->dlast_sga = DMA_DLAST_SGA_DLASTSGA(sga);
+    tcd->csr = csr;
+    tcd->biter = DMA_BITER_ELINKNO_ELINK(0)|DMA_BITER_ELINKNO_BITER(requests);
+}
+/******************************************************************************
+* sineDmaStartRing() - Private
+* Links one TCD per block of plan into a circle with scatter-gather and
+* starts the DMA on block 0, the first DMABuffer frame already rendered.
+* Every block raises a major loop interrupt, which hands the finished block
+* back to the processing task. With the DAC buffers DAC1 has its own ring
+* on its own channel in step with DAC0's, only DAC0's interrupts. A
+* finished block is played again NUM_BLOCKS-1 blocks later, its render
+* deadline.
+******************************************************************************/
+static void sineDmaStartRing(const WAVE_PLAN *plan){
+    INT16U blk;
+    INT16U next;
+    INT8U dac;
+    INT8U num_dma;
+    dmaInBlockRdy.deadline = (NUM_BLOCKS - 1) * plan->block_samples * (plan->pit_ldval + 1) * SINE_CPU_PER_BUS;
+    num_dma = (WaveDacBufPlan(plan->pit_ldval, plan->block_samples, NUM_BLOCKS, APP_CFG_WAVE_DAC_FIFO,
+                              &SineDacBuf) == TRUE) ? SINE_NUM_CH : 1;
+    for(dac = 0; dac < num_dma; dac++){
+        for(blk = 0; blk < NUM_BLOCKS; blk++){
+            next = blk + 1;
+            if(next >= NUM_BLOCKS){
+                next = 0;
+            }else{
+            }
+            sineTcdSet(&SineTcdRing[dac][blk], dac, &DMABuffer[blk * plan->block_samples * SINE_NUM_CH], plan->block_samples,
+                       blk * plan->block_samples, 0, (INT32U)&SineTcdRing[dac][next],
+                       DMA_CSR_ESG(1) | DMA_CSR_MAJORELINK(0) | DMA_CSR_BWC(3) | DMA_CSR_INTHALF(0) |
+                       DMA_CSR_INTMAJOR((dac == 0) ? 1 : 0));
+        }
+        sineDmaLoad((dac == 0) ? WAVE_DMA_OUT_CH : WAVE_DMA_DAC1_CH, &SineTcdRing[dac][0]);
+    }
+    sineTrigStart(&DMABuffer[0]);
+}
+/******************************************************************************
+* sineDmaStartLoop() - Private
+* Plays the first loop->length frames of DMABuffer over and over with a
+* single TCD per DMA channel and no interrupts. A loop of whole buffers
+* ends each pass with DADDR back on its first word.
+******************************************************************************/
+static void sineDmaStartLoop(const WAVE_LOOP *loop){
+    DMA_TCD tcd;
+    INT8U dac;
+    INT8U num_dma;
+    num_dma = (WaveDacBufPlan(loop->pit_ldval, loop->length, 1, APP_CFG_WAVE_DAC_FIFO, &SineDacBuf) == TRUE) ?
+              SINE_NUM_CH : 1;
+    for(dac = 0; dac < num_dma; dac++){
+        sineTcdSet(&tcd, dac, &DMABuffer[0], loop->length, 0, -(INT32S)(loop->length * SINE_FRAME_BYTES), 0,
+                   DMA_CSR_ESG(0) | DMA_CSR_MAJORELINK(0) | DMA_CSR_BWC(3) | DMA_CSR_INTHALF(0) | DMA_CSR_INTMAJOR(0));
+        sineDmaLoad((dac == 0) ? WAVE_DMA_OUT_CH : WAVE_DMA_DAC1_CH, &tcd);
+    }
+    sineTrigStart(&DMABuffer[0]);
+}
+/******************************************************************************
+* sineDmaStop() - Private
+* Stops the PIT and PDB triggers and the DMA channels so the TCDs can be
+* rewritten.
+******************************************************************************/
+static void sineDmaStop(void){
+    PIT->CHANNEL[0].TCTRL = 0;
+    PDB0->SC = 0;
+    DMA0->CERQ = DMA_CERQ_CERQ(WAVE_DMA_OUT_CH);
+    DMA0->CERQ = DMA_CERQ_CERQ(WAVE_DMA_DAC1_CH);
+    while((DMA0->TCD[WAVE_DMA_OUT_CH].CSR & DMA_CSR_ACTIVE_MASK) != 0){} // let a minor loop finish
+    while((DMA0->TCD[WAVE_DMA_DAC1_CH].CSR & DMA_CSR_ACTIVE_MASK) != 0){}
+    DMA0->CINT = DMA_CINT_CINT(WAVE_DMA_OUT_CH);
+    NVIC_ClearPendingIRQ(DMA0_DMA16_IRQn);  // no stale block done after a restart
 }
 /*******************************************************************************
  * sinewaveProcTask()- Public
- * Convert raw samples to q31 positive numbers and processing block.
- * Writes to a single Ping-Pong buffer register, and the DMA will
- * read from the other Ping-Pong buffer register.
+ * Renders a block of Q15 samples for each channel with its generator, then
+ * scales and interleaves them into DAC0/DAC1 frames with the packed
+ * WaveDacFormatPair() kernel, WaveRenderBlock(). Each wakeup refills every ring block the DMA
+ * has finished with, so it can fall up to NUM_BLOCKS-1 blocks behind before
+ * the DACs repeat old samples.
+ * When SetSinFreq() posts a new plan the DMA and PIT are stopped, all
+ * blocks are refilled at the new rate and the output restarts.
+ * A new shape switches generator from the next block on. A sweeping
+ * channel renders its chirp in place of the generator until it ends.
+ * A modulated channel runs its LFO once per block, so neither a sweep nor
+ * modulation ever lets the output settle into the cached loop.
+ * A new effects chain takes over at the next block boundary, the filters
+ * start from rest. A sequence starts at the next block boundary and steps
+ * inside the blocks, a new plan restarts it from its first step.
+ * After SINE_CACHE_SETTLE_BLOCKS blocks with no change a loop of whole
+ * periods is rendered once and replayed by the DMA with its interrupts off.
+ * The task then sleeps until a setter changes something.
+ * When the engine goes idle the output is stopped at mid-scale and the task
+ * sleeps the same way. It resumes every generator at phase 0, where each
+ * shape crosses mid-scale, so the output restarts without a step.
  *
  * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
  * *****************************************************************************/
 void sinewaveProcTask(void *p_arg){
 
-    INT8U buffer_index;
-    INT32U i;
-    INT16U dac_data;
-    INT8U sin_amp;
-    INT16U sin_freq;
-    q31_t sin_step;
-    q31_t sin_arg = 0;
-    q31_t sin_value;
-    q31_t sin_amp_value;      //intermediate sin term
+    INT16U buffer_index;
+    INT32U start_cyc;
+    INT8U amp_new;
+    INT8U plan_new;
+    INT8U shape_new;
+    INT8U sweep_on;
+    INT8U mod_on;
+    INT8U fx_new;
+    INT8U seq_on;
+    WAVE_PLAN plan;
+    INT32U steps[SINE_NUM_CH];
+    INT32U stable_blocks = 0;
+    SINE_OUT_STATE out_state = SINE_STREAM;
 
 	OS_ERR os_err;
 
 	(void)p_arg;
 
+	(void)GetSinPlan(&plan, &steps[0]);
+	(void)sineUpdateShapes();
+	(void)sineUpdateAmps();
+	(void)sineUpdateMods(&plan, TRUE);
+	(void)sineUpdateFx(&plan, TRUE);
+	(void)sineUpdateSeqs(&plan, TRUE);
 	while(1){
-		DB3_TURN_OFF();                             // Disable debug bit 3 while waiting
-		buffer_index = DMAPingPend(0, &os_err);     //wait for flag from dma
-		DB3_TURN_ON();                              // Enable debug bit 3 while ready/running
-		sin_amp = GetSinAmp();;
-		sin_freq = GetSinFreq();
-		sin_step = (q31_t)(sin_freq * 44739);  //promote to q31_t and get to match sps
-		for(i=0; i<SAMPLES_PER_BLOCK;i++){
-			sin_arg = ((sin_arg + sin_step)& 0x7FFFFFFF); // force it to be positive
-			sin_value = arm_sin_q31(sin_arg);
-			sin_amp_value =  sin_amp * (sin_value/22); // 22 to prevent overflow
-			dac_data = ((sin_amp_value>>20)+0x7FF);
-			DMABuffer[buffer_index][i] = dac_data;
-        }
+		if(out_state != SINE_STREAM){
+			DB3_TURN_OFF();                                             // Disable debug bit 3 while waiting
+			(void)OSTaskSemPend(0, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &os_err); // posted on a setting change
+			DB3_TURN_ON();                                              // Enable debug bit 3 while ready/running
+			(void)GetSinPlan(&plan, &steps[0]);
+			(void)sineUpdateShapes();
+			(void)sineUpdateAmps();
+			(void)sineUpdateMods(&plan, TRUE);
+			(void)sineUpdateFx(&plan, TRUE);
+			seq_on = sineUpdateSeqs(&plan, TRUE);
+			sweep_on = sineSweepsDone();
+			if(sineStartIdle((sweep_on == TRUE) || (seq_on == TRUE)) == TRUE){        // still idle, e.g. a setting changed in PULSE mode
+				out_state = SINE_IDLE;
+			}else{
+				if(out_state == SINE_IDLE){
+					sineResetPhases();
+				}else{
+				}
+				sineStartStream(&plan, &steps[0]);
+				stable_blocks = 0;
+				out_state = SINE_STREAM;
+			}
+		}else{
+			DB3_TURN_OFF();                             // Disable debug bit 3 while waiting
+			DMABlockPend(0, &os_err);                   //wait for flag from dma
+			DB3_TURN_ON();                              // Enable debug bit 3 while ready/running
+			amp_new = sineUpdateAmps();
+			plan_new = GetSinPlan(&plan, &steps[0]);
+			shape_new = sineUpdateShapes();
+			sweep_on = sineSweepsDone();
+			mod_on = sineUpdateMods(&plan, plan_new);
+			fx_new = sineUpdateFx(&plan, plan_new);
+			seq_on = sineUpdateSeqs(&plan, plan_new);
+			if((plan_new == TRUE) || (shape_new == TRUE) || (amp_new == TRUE) || (sweep_on == TRUE) ||
+			   (mod_on == TRUE) || (fx_new == TRUE) || (seq_on == TRUE)){
+				stable_blocks = 0;
+			}else{
+				stable_blocks++;
+			}
+			if(sineStartIdle((sweep_on == TRUE) || (seq_on == TRUE)) == TRUE){
+				out_state = SINE_IDLE;
+			}else if(plan_new == TRUE){                 // new frequency, retime the DAC path
+				sineStartStream(&plan, &steps[0]);
+			}else if((stable_blocks >= SINE_CACHE_SETTLE_BLOCKS) && (sineStartCached() == TRUE)){
+				out_state = SINE_CACHED;
+			}else{
+				while(DMABlockNext(&buffer_index) == TRUE){
+					start_cyc = DWT->CYCCNT;
+					WaveRenderBlock(&SineChan[0], &DMABuffer[buffer_index * plan.block_samples * SINE_NUM_CH],
+					                plan.block_samples, SineUpsample);
+					DMABlockFilled(buffer_index, start_cyc);
+					sineCaptureFrames(&DMABuffer[buffer_index * plan.block_samples * SINE_NUM_CH], plan.block_samples,
+					                  plan.pit_ldval, FALSE);
+				}
+			}
+		}
+	}
+}
+/*******************************************************************************
+ * sineStartStream()- Private
+ * Stops the output, refills every ring block for plan and restarts the
+ * PIT and DMA with block interrupts.
+ * *****************************************************************************/
+static void sineStartStream(const WAVE_PLAN *plan, const INT32U *steps){
+	OS_ERR os_err;
+	INT8U ch;
+	sineDmaStop();
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		SineChan[ch].step = steps[ch];
+		if(SineChan[ch].seq.left > 0){
+			SineChan[ch].gen.step = SineChan[ch].seqsteps[SineChan[ch].seq.index];
+		}else{
+			SineChan[ch].gen.step = steps[ch];
+		}
+		SineChan[ch].interpready = FALSE;       // FIR history at the new step
+	}
+	WaveRenderBlock(&SineChan[0], &DMABuffer[0], NUM_BLOCKS * plan->block_samples, SineUpsample);
+	WaveRingInit(&dmaInBlockRdy.ring, NUM_BLOCKS);
+	OSSemSet(&(dmaInBlockRdy.flag), 0, &os_err);
+	sineDmaStartRing(plan);
+	sineCaptureFrames(&DMABuffer[0], NUM_BLOCKS * plan->block_samples, plan->pit_ldval, TRUE);   // output jumped
+}
+/*******************************************************************************
+ * sineStartCached()- Private
+ * Renders the loop of whole periods fitted by SetSinFreq() into DMABuffer
+ * once and lets the DMA replay it with no interrupts. Marks the output
+ * cached so the setters wake the task on the next change. Returns FALSE,
+ * leaving the stream running, if there is no loop within WAVE_LOOP_MAX_PPM,
+ * a channel plays noise or a sequence, or the settings moved on since the
+ * task last read them.
+ * *****************************************************************************/
+static INT8U sineStartCached(void){
+	WAVE_LOOP loop;
+	INT32U loopsteps[SINE_NUM_CH];
+	INT8U start;
+	INT8U ch;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	start = (SineData.loopok == TRUE) && (SineData.plannew == FALSE);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((SineData.ch[ch].shapenew == TRUE) || (SineData.ch[ch].amp != SineChan[ch].amp) ||
+		   (WaveGenIsPeriodic(&SineChan[ch].gen) == FALSE) || (SineData.ch[ch].seqnew == TRUE) ||
+		   (SineChan[ch].seq.left > 0)){
+			start = FALSE;
+		}else{
+		}
+	}
+	if(start == TRUE){
+		loop = SineData.loop;
+		for(ch = 0; ch < SINE_NUM_CH; ch++){
+			loopsteps[ch] = SineData.loopsteps[ch];
+		}
+		SineData.parked = TRUE;
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	if(start == TRUE){
+		sineDmaStop();
+		for(ch = 0; ch < SINE_NUM_CH; ch++){
+			SineChan[ch].gen.step = loopsteps[ch];
+		}
+		WaveRenderBlock(&SineChan[0], &DMABuffer[0], loop.length, FALSE);     // rendered once, direct for the cleanest loop
+		sineDmaStartLoop(&loop);
+		OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+		if(SineData.parked == TRUE){                // not woken meanwhile, readers may copy the loop
+			SineData.cachedlen = loop.length;
+			SineData.cachedldval = loop.pit_ldval;
+		}else{
+		}
+		OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+		if(SineCap.state == SINE_CAP_ARMED){          // armed while streaming, finish it from the loop
+			sineCaptureLoop(&DMABuffer[0], loop.length, SineCap.ch, SineCap.buf, SineCap.num);
+			SineCap.pit_ldval = loop.pit_ldval;
+			SineCap.state = SINE_CAP_IDLE;
+			(void)OSSemPost(&SineCap.done, OS_OPT_POST_1, &os_err);
+		}else{
+		}
+	}else{
+	}
+	return start;
+}
+/*******************************************************************************
+ * sineStartIdle()- Private
+ * Parks the engine if it is disabled, or if every channel has amplitude 0
+ * and no sweep or sequence is running (busy). Stops the PIT and DMA and leaves
+ * both DACs at mid-scale. Marks the task parked so the setters wake it.
+ * Returns TRUE if parked.
+ * *****************************************************************************/
+static INT8U sineStartIdle(INT8U busy){
+	INT8U idle;
+	INT8U ch;
+	INT8U word;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	idle = (busy == FALSE);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if(SineData.ch[ch].amp != 0){
+			idle = FALSE;
+		}else{
+		}
+	}
+	if(SineData.enabled == FALSE){
+		idle = TRUE;
+	}else{
+	}
+	if(idle == TRUE){
+		SineData.parked = TRUE;
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	if(idle == TRUE){
+		sineDmaStop();
+		for(word = 0; word < WAVE_DACBUF_WORDS; word++){   // whichever word the buffer's read pointer stopped on
+			DAC0->DAT[word].DATL = DAC_DATL_DATA0(WAVE_DAC_OFFSET);
+			DAC0->DAT[word].DATH = DAC_DATH_DATA1(WAVE_DAC_OFFSET >> 8);
+			DAC1->DAT[word].DATL = DAC_DATL_DATA0(WAVE_DAC_OFFSET);
+			DAC1->DAT[word].DATH = DAC_DATH_DATA1(WAVE_DAC_OFFSET >> 8);
+		}
+	}else{
+	}
+	return idle;
+}
+/*******************************************************************************
+ * sineResetPhases()- Private
+ * Puts every generator and LFO back at phase 0 to leave idle at mid-scale.
+ * *****************************************************************************/
+static void sineResetPhases(void){
+	INT8U ch;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		SineChan[ch].gen.phase = 0;
+		SineChan[ch].mod.lfo_phase = 0;
+		SineChan[ch].mod.lfo_last = 0;
 	}
 }
  /*****************************************************************************************
- * GetSinFreq()-Private
- * Gets the sine frequency from the mutex.
- * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
+ * GetSinPlan()-Private
+ * Copies the current sample plan and channel steps from the mutex. Returns
+ * TRUE if they changed since the last call. Sweeps are set together with
+ * the plan, so they are picked up here and started at the new rate.
  *****************************************************************************************/
-static INT16U GetSinFreq(void){
-	INT16U returnfreq;
+static INT8U GetSinPlan(WAVE_PLAN *plan, INT32U *steps){
+	INT8U plannew;
+	INT8U sweepnew[SINE_NUM_CH];
+	SINE_SWEEP_SET sweep[SINE_NUM_CH];
+	INT16U freq[SINE_NUM_CH];
+	INT8U ch;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	*plan = SineData.plan;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		steps[ch] = SineData.steps[ch];
+		sweepnew[ch] = SineData.ch[ch].sweepnew;
+		sweep[ch] = SineData.ch[ch].sweep;
+		freq[ch] = SineData.ch[ch].freq;
+		SineData.ch[ch].sweepnew = FALSE;
+	}
+	plannew = SineData.plannew;
+	SineData.plannew = FALSE;
+	SineUpsample = SineData.upsample;
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if(sweepnew[ch] == FALSE){
+		}else if(sweep[ch].from != 0){
+			WaveSweepStart(&SineChan[ch].sweep, sweep[ch].from, freq[ch], sweep[ch].time_ms, plan->sample_rate,
+			               (WAVE_SWEEP_LAW)sweep[ch].law);
+		}else{
+			SineChan[ch].sweep.remaining = 0;     // plain SetSinFreq() cancels a sweep
+		}
+	}
+	return plannew;
+}
+/*****************************************************************************************
+* sineSweepsDone()-Private
+* Returns TRUE while any channel is sweeping. Clears the sweeping flag of a
+* channel whose sweep has ended, unless a new sweep is already queued.
+*****************************************************************************************/
+static INT8U sineSweepsDone(void){
+	INT8U sweep_on = FALSE;
+	INT8U ch;
 	OS_ERR os_err;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if(SineChan[ch].sweep.remaining > 0){
+			sweep_on = TRUE;
+		}else{
+		}
+	}
 	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-	returnfreq = SineData.sinefreq;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((SineChan[ch].sweep.remaining == 0) && (SineData.ch[ch].sweepnew == FALSE)){
+			SineData.ch[ch].sweeping = FALSE;
+		}else{
+		}
+	}
 	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
-	return returnfreq;
+	return sweep_on;
 }
 /*****************************************************************************************
 * SetSinFreq()- Public
-* Sets the sine frequency in mutex.
+* Sets the frequency of channel ch in mutex and ends any sweep on it.
 * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
 *****************************************************************************************/
-void SetSinFreq(INT16U changefreq){
+void SetSinFreq(INT8U ch, INT16U changefreq){
+	sineSetFreq(ch, changefreq, (const SINE_SWEEP_SET *)0, (const SINE_SEQ_SET *)0);
+}
+/*****************************************************************************************
+* SetSinSweep()- Public
+* Sweeps the sine on channel ch from startfreq to stopfreq over time_ms,
+* linear or logarithmic (WAVE_SWEEP_LAW in WaveSweep.h), then holds
+* stopfreq. The sample rate is planned for the higher end of the sweep.
+*****************************************************************************************/
+void SetSinSweep(INT8U ch, INT16U startfreq, INT16U stopfreq, INT32U time_ms, INT8U law){
+	SINE_SWEEP_SET sweep;
+	sweep.from = startfreq;
+	sweep.time_ms = time_ms;
+	sweep.law = law;
+	sineSetFreq(ch, stopfreq, &sweep, (const SINE_SEQ_SET *)0);
+}
+/*****************************************************************************************
+* GetSinSweepActive()- Public
+* Returns TRUE while a sweep set on channel ch is still running.
+*****************************************************************************************/
+INT8U GetSinSweepActive(INT8U ch){
+	INT8U sweeping;
 	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return FALSE;
+	}else{
+	}
 	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-	SineData.sinefreq = changefreq;
+	sweeping = SineData.ch[ch].sweeping;
 	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	return sweeping;
 }
 /*****************************************************************************************
-* GetsinAmp()-Public
-* Gets the sine amplitude from mutex.
-* Created by: Karen Aguilar,Rodrick Muya 03/09/2022
+* sineSetFreq()-Private
+* Sets channel ch to changefreq, sweeping to it if sweep is not null, and
+* replaces its sequence if seq is not null. The channels share a sample
+* rate, so this replans the rate/block size for the highest channel, sweep
+* start or sequence step frequency, every channel's step and the cached
+* loop fit. The planning runs outside the mutex and is redone if another
+* channel changed meanwhile.
+*****************************************************************************************/
+static void sineSetFreq(INT8U ch, INT16U changefreq, const SINE_SWEEP_SET *sweep, const SINE_SEQ_SET *seq){
+	OS_ERR os_err;
+	WAVE_PLAN plan;
+	WAVE_LOOP loop;
+	INT32U freqs[3 * SINE_NUM_CH];      // channel freqs, sweep start freqs, then sequence freqs
+	INT32U steps[3 * SINE_NUM_CH];
+	INT32U loopsteps[SINE_NUM_CH];
+	INT8U loopok;
+	INT8U done = FALSE;
+	INT8U i;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	while(done == FALSE){
+		OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+		for(i = 0; i < SINE_NUM_CH; i++){
+			freqs[i] = SineData.ch[i].freq;
+			freqs[SINE_NUM_CH + i] = SineData.ch[i].sweep.from;
+			freqs[(2 * SINE_NUM_CH) + i] = SineData.ch[i].seqfreq;
+		}
+		OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+		if((sweep == (const SINE_SWEEP_SET *)0) && (seq == (const SINE_SEQ_SET *)0) && (freqs[ch] == changefreq) &&
+		   (freqs[SINE_NUM_CH + ch] == 0)){
+			done = TRUE;
+		}else{
+			freqs[ch] = changefreq;
+			freqs[SINE_NUM_CH + ch] = (sweep != (const SINE_SWEEP_SET *)0) ? sweep->from : 0;
+			if(seq != (const SINE_SEQ_SET *)0){
+				freqs[(2 * SINE_NUM_CH) + ch] = seq->maxfreq;
+			}else{
+			}
+			WavePlanForChannels(&freqs[0], 3 * SINE_NUM_CH, &plan, &steps[0]);     // outside the mutex, 64-bit divides
+			loopok = WavePlanFitChannelLoop(&plan, &freqs[0], SINE_NUM_CH, SINE_BUFFER_SAMPLES, &loop, &loopsteps[0]);
+			OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+			done = TRUE;
+			for(i = 0; i < SINE_NUM_CH; i++){
+				if((i != ch) && ((SineData.ch[i].freq != freqs[i]) || (SineData.ch[i].sweep.from != freqs[SINE_NUM_CH + i]) ||
+				                 (SineData.ch[i].seqfreq != freqs[(2 * SINE_NUM_CH) + i]))){
+					done = FALSE;
+				}else{
+				}
+			}
+			if(done == TRUE){
+				SineData.ch[ch].freq = changefreq;
+				if(sweep != (const SINE_SWEEP_SET *)0){
+					SineData.ch[ch].sweep = *sweep;
+					SineData.ch[ch].sweeping = TRUE;
+				}else{
+					SineData.ch[ch].sweep.from = 0;
+					SineData.ch[ch].sweeping = FALSE;
+				}
+				SineData.ch[ch].sweepnew = TRUE;
+				if(seq != (const SINE_SEQ_SET *)0){
+					for(i = 0; i < seq->num_steps; i++){
+						SineData.ch[ch].seq[i] = seq->steps[i];
+					}
+					SineData.ch[ch].seqnum = seq->num_steps;
+					SineData.ch[ch].seqloop = seq->loop;
+					SineData.ch[ch].seqfreq = seq->maxfreq;
+					SineData.ch[ch].seqnew = TRUE;
+					SineData.ch[ch].sequencing = (seq->num_steps > 0);
+				}else{
+				}
+				SineData.plan = plan;
+				SineData.loop = loop;
+				SineData.loopok = loopok;
+				for(i = 0; i < SINE_NUM_CH; i++){
+					SineData.steps[i] = steps[i];
+					SineData.loopsteps[i] = loopsteps[i];
+				}
+				SineData.plannew = TRUE;
+				sineWake();
+			}else{
+			}
+			OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+		}
+	}
+}
+/*****************************************************************************************
+* sineUpdateAmps()-Private
+* Copies each channel's amplitude from the mutex into its generator gain,
+* which a running sequence overrides with its step's. Returns TRUE if any
+* changed.
 *****************************************************************************************/
-static INT8U GetSinAmp(void){
-	INT16U returnamp;
+static INT8U sineUpdateAmps(void){
+	INT8U amps[SINE_NUM_CH];
+	INT8U ampnew = FALSE;
+	INT8U ch;
 	OS_ERR os_err;
 	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-	returnamp = SineData.sineamp;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		amps[ch] = SineData.ch[ch].amp;
+	}
 	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
-	return returnamp;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if(amps[ch] != SineChan[ch].amp){
+			SineChan[ch].amp = amps[ch];
+			ampnew = TRUE;
+		}else{
+		}
+		if(SineChan[ch].seq.left == 0){
+			SineChan[ch].gain = (INT16S)(amps[ch] * WAVE_RENDER_AMP_SCALE);
+		}else{
+		}
+	}
+	return ampnew;
 }
 /*****************************************************************************************
 * SetSinAmp()-Public
-* Sets the sine amplitude in mutex.
+* Sets the amplitude of channel ch in mutex.
 * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
 *****************************************************************************************/
-void SetSinAmp(INT8U changeamp){
+void SetSinAmp(INT8U ch, INT8U changeamp){
+	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	if(changeamp != SineData.ch[ch].amp){
+		SineData.ch[ch].amp = changeamp;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* sineUpdateShapes()-Private
+* Picks up new shapes or user tables from the mutex and switches each
+* changed channel's generator to it. Tables are copied so the setters never
+* write under the renderer. A user table is split into its band-limited
+* octave tables here, once per new table. A channel running a sequence
+* keeps its step's generator and takes the new shape when the sequence
+* ends. Returns TRUE if any generator changed.
+*****************************************************************************************/
+static INT8U sineUpdateShapes(void){
+	INT8U shapenew[SINE_NUM_CH];
+	INT8U shape[SINE_NUM_CH];
+	INT8U anynew = FALSE;
+	INT8U ch;
+	INT32U i;
 	OS_ERR os_err;
 	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
-	SineData.sineamp = changeamp;
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		shapenew[ch] = SineData.ch[ch].shapenew;
+		shape[ch] = SineData.ch[ch].shape;
+		if(shapenew[ch] == TRUE){
+			for(i = 0; i < WAVE_USER_SIZE; i++){
+				SineChan[ch].usermip.base[i] = SineData.ch[ch].usertable[i];
+			}
+			WaveToneSet(&SineChan[ch].tones, &SineData.ch[ch].tones[0], SineData.ch[ch].tonenum);
+			SineData.ch[ch].shapenew = FALSE;
+		}else{
+		}
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if(shapenew[ch] == TRUE){
+			if(shape[ch] == WAVE_SHAPE_USER){         // DFT work, kept outside the mutex
+				WaveMipBuildUser(&SineChan[ch].usermip, &SineChan[ch].usermip.base[0]);
+			}else{
+			}
+			SineChan[ch].shape = shape[ch];
+			if(SineChan[ch].seq.left == 0){
+				WaveGenInit(&SineChan[ch].gen, (WAVE_SHAPE)shape[ch]);
+			}else{
+			}
+			anynew = TRUE;
+		}else{
+		}
+	}
+	return anynew;
+}
+/*****************************************************************************************
+* sineUpdateMods()-Private
+* Picks up new modulation settings from the mutex and restarts the LFO of
+* each changed channel, or of every channel when plan_new says the sample
+* rate moved. Returns TRUE while any channel is modulated.
+*****************************************************************************************/
+static INT8U sineUpdateMods(const WAVE_PLAN *plan, INT8U plan_new){
+	INT8U modnew[SINE_NUM_CH];
+	SINE_MOD_SET mod[SINE_NUM_CH];
+	INT8U mod_on = FALSE;
+	INT8U ch;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		modnew[ch] = SineData.ch[ch].modnew;
+		mod[ch] = SineData.ch[ch].mod;
+		SineData.ch[ch].modnew = FALSE;
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((modnew[ch] == TRUE) || (plan_new == TRUE)){
+			WaveModStart(&SineChan[ch].mod, (WAVE_MOD_TYPE)mod[ch].type, mod[ch].rate, mod[ch].depth,
+			             plan->sample_rate);
+		}else{
+		}
+		if(SineChan[ch].mod.type != WAVE_MOD_OFF){
+			mod_on = TRUE;
+		}else{
+		}
+	}
+	return mod_on;
+}
+/*****************************************************************************************
+* SetSinMod()-Public
+* Modulates channel ch with a sine LFO of rate 0.01 Hz units. type is one of
+* WAVE_MOD_TYPE in WaveMod.h. depth is percent for WAVE_MOD_AM and the peak
+* deviation in Hz for WAVE_MOD_FM. WAVE_MOD_OFF stops the modulation.
+*****************************************************************************************/
+void SetSinMod(INT8U ch, INT8U type, INT16U rate, INT16U depth){
+	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	if((type != SineData.ch[ch].mod.type) || (rate != SineData.ch[ch].mod.rate) ||
+	   (depth != SineData.ch[ch].mod.depth)){
+		SineData.ch[ch].mod.type = type;
+		SineData.ch[ch].mod.rate = rate;
+		SineData.ch[ch].mod.depth = depth;
+		SineData.ch[ch].modnew = TRUE;
+		sineWake();
+	}else{
+	}
 	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
 }
+/*****************************************************************************************
+* sineUpdateFx()-Private
+* Picks up new effects chains from the mutex and rebuilds each changed
+* chain, or every chain when plan_new says the sample rate moved, since the
+* filter coefficients depend on it. Returns TRUE if any chain was rebuilt.
+*****************************************************************************************/
+static INT8U sineUpdateFx(const WAVE_PLAN *plan, INT8U plan_new){
+	INT8U fxnew[SINE_NUM_CH];
+	WAVE_FX_SET fx[SINE_NUM_CH][WAVE_FX_MAX_STAGES];
+	INT8U fxnum[SINE_NUM_CH];
+	INT8U anynew = FALSE;
+	INT8U ch;
+	INT8U i;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		fxnew[ch] = SineData.ch[ch].fxnew;
+		fxnum[ch] = SineData.ch[ch].fxnum;
+		for(i = 0; i < fxnum[ch]; i++){
+			fx[ch][i] = SineData.ch[ch].fx[i];
+		}
+		SineData.ch[ch].fxnew = FALSE;
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((fxnew[ch] == TRUE) || (plan_new == TRUE)){
+			WaveFxChainInit(&SineChan[ch].fx, &fx[ch][0], fxnum[ch], plan->sample_rate);
+			anynew = TRUE;
+		}else{
+		}
+	}
+	return anynew;
+}
+/*****************************************************************************************
+* SetSinFx()-Public
+* Sets the effects chain of channel ch to num_stages stages from stages, run
+* in order on each block, see WAVE_FX_SET in WaveFx.h. Stages past
+* WAVE_FX_MAX_STAGES are dropped, num_stages 0 removes the chain.
+*****************************************************************************************/
+void SetSinFx(INT8U ch, const WAVE_FX_SET *stages, INT8U num_stages){
+	OS_ERR os_err;
+	INT8U i;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	if(num_stages > WAVE_FX_MAX_STAGES){
+		num_stages = WAVE_FX_MAX_STAGES;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(i = 0; i < num_stages; i++){
+		SineData.ch[ch].fx[i] = stages[i];
+	}
+	SineData.ch[ch].fxnum = num_stages;
+	SineData.ch[ch].fxnew = TRUE;
+	sineWake();
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* sineUpdateSeqs()-Private
+* Picks up new sequences from the mutex and starts each at its first step,
+* with the step lengths and phase steps worked out at the plan rate. A
+* running sequence restarts when plan_new says the rate moved. Steps that
+* play the user table or the tones get the channel's current ones. Clears
+* the sequencing flag of a channel whose sequence has ended. Returns TRUE
+* while any channel runs a sequence.
+*****************************************************************************************/
+static INT8U sineUpdateSeqs(const WAVE_PLAN *plan, INT8U plan_new){
+	INT8U seqnew[SINE_NUM_CH];
+	INT8U usernew[SINE_NUM_CH];
+	INT8U seq_on = FALSE;
+	INT8U ch;
+	INT32U i;
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		seqnew[ch] = SineData.ch[ch].seqnew;
+		usernew[ch] = FALSE;
+		if(seqnew[ch] == TRUE){
+			for(i = 0; i < SineData.ch[ch].seqnum; i++){
+				SineChan[ch].seqset[i] = SineData.ch[ch].seq[i];
+				if(SineData.ch[ch].seq[i].shape == WAVE_SHAPE_USER){
+					usernew[ch] = TRUE;
+				}else if(SineData.ch[ch].seq[i].shape == WAVE_SHAPE_TONES){
+					WaveToneSet(&SineChan[ch].tones, &SineData.ch[ch].tones[0], SineData.ch[ch].tonenum);
+				}else{
+				}
+			}
+			if(usernew[ch] == TRUE){
+				for(i = 0; i < WAVE_USER_SIZE; i++){
+					SineChan[ch].usermip.base[i] = SineData.ch[ch].usertable[i];
+				}
+			}else{
+			}
+			SineChan[ch].seq.num_steps = SineData.ch[ch].seqnum;
+			SineChan[ch].seq.loop = SineData.ch[ch].seqloop;
+			SineData.ch[ch].seqnew = FALSE;
+		}else{
+		}
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((seqnew[ch] == TRUE) || ((plan_new == TRUE) && (SineChan[ch].seq.left > 0))){
+			if(usernew[ch] == TRUE){                  // DFT work, kept outside the mutex
+				WaveMipBuildUser(&SineChan[ch].usermip, &SineChan[ch].usermip.base[0]);
+			}else{
+			}
+			for(i = 0; i < SineChan[ch].seq.num_steps; i++){
+				SineChan[ch].seq.length[i] = WaveSeqTicks(SineChan[ch].seqset[i].time_ms, plan->sample_rate, 1);
+				SineChan[ch].seqsteps[i] = WavePlanStep(plan, SineChan[ch].seqset[i].freq);
+			}
+			WaveSeqStart(&SineChan[ch].seq, SineChan[ch].seq.num_steps, SineChan[ch].seq.loop);
+			WaveRenderSeqApply(&SineChan[ch]);
+		}else{
+		}
+		if(SineChan[ch].seq.left > 0){
+			seq_on = TRUE;
+		}else{
+		}
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(ch = 0; ch < SINE_NUM_CH; ch++){
+		if((SineChan[ch].seq.left == 0) && (SineData.ch[ch].seqnew == FALSE)){
+			SineData.ch[ch].sequencing = FALSE;
+		}else{
+		}
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	return seq_on;
+}
+/*****************************************************************************************
+* SetSinSequence()-Public
+* Plays num_steps steps from steps on channel ch, each a shape, frequency,
+* amplitude and time, see WAVE_SEQ_STEP in WaveSeq.h. Each step starts on
+* the sample its time rounds to at the sample rate, which is planned for the
+* highest step frequency, so the transitions need no replanning. loop TRUE
+* repeats the steps until replaced, otherwise the channel goes back to its
+* own shape, frequency and amplitude after the last step. Steps past
+* WAVE_SEQ_MAX_STEPS are dropped, num_steps 0 stops the sequence. The steps
+* are copied. Ends any sweep on ch.
+*****************************************************************************************/
+void SetSinSequence(INT8U ch, const WAVE_SEQ_STEP *steps, INT8U num_steps, INT8U loop){
+	SINE_SEQ_SET seq;
+	INT16U freq;
+	INT8U i;
+	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	if(num_steps > WAVE_SEQ_MAX_STEPS){
+		num_steps = WAVE_SEQ_MAX_STEPS;
+	}else{
+	}
+	seq.steps = steps;
+	seq.num_steps = num_steps;
+	seq.loop = loop;
+	seq.maxfreq = 0;
+	for(i = 0; i < num_steps; i++){
+		if(steps[i].freq > seq.maxfreq){
+			seq.maxfreq = steps[i].freq;
+		}else{
+		}
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	freq = SineData.ch[ch].freq;
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	sineSetFreq(ch, freq, (const SINE_SWEEP_SET *)0, &seq);
+}
+/*****************************************************************************************
+* GetSinSeqActive()- Public
+* Returns TRUE while a sequence set on channel ch is still running.
+*****************************************************************************************/
+INT8U GetSinSeqActive(INT8U ch){
+	INT8U sequencing;
+	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return FALSE;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	sequencing = SineData.ch[ch].sequencing;
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	return sequencing;
+}
+/*******************************************************************************
+ * sineCaptureFrames()- Private
+ * Appends the armed channel's codes from num_frames frames just rendered
+ * to the capture, starting it over when restart says the output jumped,
+ * and posts the reader once it is full. One test per block when nothing
+ * is armed.
+ * *****************************************************************************/
+static void sineCaptureFrames(const INT16U *frames, INT32U num_frames, INT32U pit_ldval, INT8U restart){
+	INT32U i;
+	OS_ERR os_err;
+	if(SineCap.state != SINE_CAP_ARMED){
+		return;
+	}else{
+	}
+	if(restart == TRUE){
+		SineCap.fill = 0;
+	}else{
+	}
+	if(SineCap.fill == 0){
+		SineCap.pit_ldval = pit_ldval;
+	}else{
+	}
+	for(i = 0; (i < num_frames) && (SineCap.fill < SineCap.num); i++){
+		SineCap.buf[SineCap.fill] = frames[(i * SINE_NUM_CH) + SineCap.ch];
+		SineCap.fill++;
+	}
+	if(SineCap.fill >= SineCap.num){
+		SineCap.state = SINE_CAP_IDLE;
+		(void)OSSemPost(&SineCap.done, OS_OPT_POST_1, &os_err);
+	}else{
+	}
+}
+/*******************************************************************************
+ * sineCaptureLoop()- Private
+ * Fills num codes of channel ch from a loop of num_frames frames played
+ * over and over.
+ * *****************************************************************************/
+static void sineCaptureLoop(const INT16U *frames, INT32U num_frames, INT8U ch, INT16U *codes, INT32U num){
+	INT32U i;
+	INT32U j = 0;
+	for(i = 0; i < num; i++){
+		codes[i] = frames[(j * SINE_NUM_CH) + ch];
+		j++;
+		if(j >= num_frames){
+			j = 0;
+		}else{
+		}
+	}
+}
+/*****************************************************************************************
+* GetSinCapture()- Public
+* Copies num DAC codes, 0 to 4095, that channel ch plays back to back into
+* codes, and the sample rate and the channel's set frequency into info.
+* While the output streams the codes come from the next blocks rendered and
+* the caller pends for them, up to SINE_CAP_TIMEOUT ticks. The renderer
+* only copies, it never waits on the caller. On the cached loop the loop
+* itself is copied over and over. Returns FALSE if the output is idle or
+* keeps restarting. For one task at a lower priority than the processing
+* task.
+*****************************************************************************************/
+INT8U GetSinCapture(INT8U ch, INT16U *codes, INT32U num, SINE_CAPTURE_INFO *info){
+	INT8U cached;
+	OS_ERR os_err;
+	if((ch >= SINE_NUM_CH) || (num == 0)){
+		return FALSE;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	info->freq = SineData.ch[ch].freq;
+	cached = (SineData.cachedlen > 0);
+	if(cached == TRUE){                     // the task cannot rewrite the loop until it gets the mutex
+		sineCaptureLoop(&DMABuffer[0], SineData.cachedlen, ch, codes, num);
+		info->sample_rate = (FP32)WAVE_BUS_CLK / (FP32)(SineData.cachedldval + 1);
+	}else{
+		SineCap.buf = codes;
+		SineCap.num = num;
+		SineCap.ch = ch;
+		SineCap.fill = 0;
+		OSSemSet(&SineCap.done, 0, &os_err);
+		SineCap.state = SINE_CAP_ARMED;
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+	if(cached == FALSE){
+		(void)OSSemPend(&SineCap.done, SINE_CAP_TIMEOUT, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err);
+		SineCap.state = SINE_CAP_IDLE;      // the renderer runs above us, so it is not mid-copy
+		if(os_err != OS_ERR_NONE){
+			return FALSE;
+		}else{
+		}
+		info->sample_rate = (FP32)WAVE_BUS_CLK / (FP32)(SineCap.pit_ldval + 1);
+	}else{
+	}
+	return TRUE;
+}
+/*****************************************************************************************
+* SetSinShape()-Public
+* Selects the waveform of channel ch, one of WAVE_SHAPE in WaveGen.h. Out of
+* range shapes play as a sine.
+*****************************************************************************************/
+void SetSinShape(INT8U ch, INT8U changeshape){
+	OS_ERR os_err;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	if(changeshape != SineData.ch[ch].shape){
+		SineData.ch[ch].shape = changeshape;
+		SineData.ch[ch].shapenew = TRUE;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* SetSinTones()-Public
+* Sets the num_tones harmonics channel ch sums in WAVE_SHAPE_TONES, see
+* WAVE_TONE_SET in WaveTone.h. Harmonics are multiples of the channel
+* frequency, those at or above half the sample rate are silent. Tones past
+* WAVE_TONE_MAX are dropped. Takes effect when the shape is WAVE_SHAPE_TONES.
+*****************************************************************************************/
+void SetSinTones(INT8U ch, const WAVE_TONE_SET *tones, INT8U num_tones){
+	OS_ERR os_err;
+	INT8U i;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	if(num_tones > WAVE_TONE_MAX){
+		num_tones = WAVE_TONE_MAX;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(i = 0; i < num_tones; i++){
+		SineData.ch[ch].tones[i] = tones[i];
+	}
+	SineData.ch[ch].tonenum = num_tones;
+	if(SineData.ch[ch].shape == WAVE_SHAPE_TONES){
+		SineData.ch[ch].shapenew = TRUE;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* SetSinUserTable()-Public
+* Loads one period of WAVE_USER_SIZE Q15 samples for WAVE_SHAPE_USER on
+* channel ch. The table is copied, table can be reused on return.
+*****************************************************************************************/
+void SetSinUserTable(INT8U ch, const INT16S *table){
+	OS_ERR os_err;
+	INT32U i;
+	if(ch >= SINE_NUM_CH){
+		return;
+	}else{
+	}
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	for(i = 0; i < WAVE_USER_SIZE; i++){
+		SineData.ch[ch].usertable[i] = table[i];
+	}
+	if(SineData.ch[ch].shape == WAVE_SHAPE_USER){
+		SineData.ch[ch].shapenew = TRUE;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* SetSinUpsample()-Public
+* TRUE renders the tones shape at 1/WAVE_INTERP_L of the DAC rate and
+* upsamples it, the other shapes are cheaper direct. Applied like a new
+* plan, the output restarts.
+*****************************************************************************************/
+void SetSinUpsample(INT8U enable){
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	if(enable != SineData.upsample){
+		SineData.upsample = enable;
+		SineData.plannew = TRUE;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* SetSinEnable()-Public
+* Enables or parks the whole sine engine, both channels. Settings made while
+* parked are kept and take effect when it is enabled again.
+*****************************************************************************************/
+void SetSinEnable(INT8U enable){
+	OS_ERR os_err;
+	OSMutexPend(&SineKey, 0, OS_OPT_PEND_BLOCKING, (CPU_TS*)0, &os_err );
+	if(enable != SineData.enabled){
+		SineData.enabled = enable;
+		sineWake();
+	}else{
+	}
+	OSMutexPost(&SineKey,OS_OPT_NONE,&os_err);
+}
+/*****************************************************************************************
+* sineWake()-Private
+* Called with SineKey held. If the task is parked, on the cached loop or idle,
+* wakes it so it goes back to block generation. Posts at most once per
+* parked period. The loop in DMABuffer is no longer safe to copy.
+*****************************************************************************************/
+static void sineWake(void){
+	OS_ERR os_err;
+	if(SineData.parked == TRUE){
+		SineData.parked = FALSE;
+		SineData.cachedlen = 0;
+		(void)OSTaskSemPost(&SineWaveGenTCB, OS_OPT_POST_NONE, &os_err);
+	}else{
+	}
+}
 /***************************************************************************************
  * DMA0_DMA16_IRQHandler()-Public
  * Parameters: none
  * Return: none
- * Interrupt service routine for DAC0 channel 0
+ * Interrupt service routine for DAC0 channel 0. A ring block finished and
+ * scatter-gather already loaded the next TCD.
  * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
  ***************************************************************************************/
 void DMA0_DMA16_IRQHandler(void){
 	OS_ERR os_err;
+	INT32U overruns;
+	INT16U done;
 	OSIntEnter();
 	DB4_TURN_ON();                     // Enable debug bit 4
 	DMA0->CINT = DMA_CINT_CINT(0);     // clears  flag
-	if((DMA0->TCD[0].CSR & DMA_CSR_DONE_MASK) != 0){
-		dmaInBlockRdy.index = 1;       //set buffer index to opposite of DMA
+	overruns = dmaInBlockRdy.ring.overruns;
+	done = WaveRingBlockDone(&dmaInBlockRdy.ring);
+	dmaInBlockRdy.done_cyc[done] = DWT->CYCCNT;
+	if(dmaInBlockRdy.ring.overruns != overruns){
+		SineStatData.overruns++;
 	}else{
-		dmaInBlockRdy.index = 0;
 	}
 	OSSemPost(&(dmaInBlockRdy.flag),OS_OPT_POST_1,&os_err); // maybe void before
 	DB4_TURN_OFF();                    // Disable debug bit 4
 	OSIntExit();
 }
 /****************************************************************************************
- * DMAPingPend()- DMA Interrupt Handler for pending on the flag
+ * DMABlockPend()- DMA Interrupt Handler for pending on the flag
  * Private.
  * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
  ***************************************************************************************/
-static INT8U DMAPingPend(OS_TICK tout, OS_ERR *os_err_ptr){
+static void DMABlockPend(OS_TICK tout, OS_ERR *os_err_ptr){
 	OSSemPend(&(dmaInBlockRdy.flag), tout, OS_OPT_PEND_BLOCKING,(void *)0, os_err_ptr);
-	return dmaInBlockRdy.index;
+}
+/****************************************************************************************
+ * DMABlockNext()- Private
+ * Returns TRUE and the next ring block to refill in *index, FALSE if all
+ * blocks are already ahead of the DMA.
+ ***************************************************************************************/
+static INT8U DMABlockNext(INT16U *index){
+	INT8U ready;
+	CPU_SR_ALLOC();
+	CPU_CRITICAL_ENTER();
+	ready = WaveRingNextFill(&dmaInBlockRdy.ring, index);
+	CPU_CRITICAL_EXIT();
+	return ready;
+}
+/****************************************************************************************
+ * DMABlockFilled()- Private
+ * Hands ring block index back to the DMA once it is rendered and records
+ * the render time since start_cyc and the slack left to its deadline.
+ ***************************************************************************************/
+static void DMABlockFilled(INT16U index, INT32U start_cyc){
+	INT32U end_cyc;
+	INT32S slack;
+	CPU_SR_ALLOC();
+	CPU_CRITICAL_ENTER();
+	end_cyc = DWT->CYCCNT;
+	slack = (INT32S)(dmaInBlockRdy.done_cyc[index] + dmaInBlockRdy.deadline - end_cyc);
+	WaveStatAdd(&SineStatData.render, (INT32S)(end_cyc - start_cyc));
+	WaveStatAdd(&SineStatData.slack, slack);
+	if(slack < 0){
+		SineStatData.late++;
+	}else{
+	}
+	WaveRingFilled(&dmaInBlockRdy.ring, index);
+	CPU_CRITICAL_EXIT();
+}
+/****************************************************************************************
+ * GetSinStats()- Public
+ * Copies the block timing since the last SineStatsReset() into stats.
+ * Times are CPU cycles at SYSTEM_CLOCK. Blocks are only timed while
+ * streaming, the cached loop has no blocks. stk_used is the processing
+ * task's stack high-water mark since start, not cleared by a reset.
+ ***************************************************************************************/
+void GetSinStats(SINE_STATS *stats){
+	SINE_STAT_DATA data;
+	CPU_STK_SIZE stk_free;
+	CPU_STK_SIZE stk_used;
+	OS_ERR os_err;
+	CPU_SR_ALLOC();
+	CPU_CRITICAL_ENTER();
+	data = SineStatData;
+	CPU_CRITICAL_EXIT();
+	stats->blocks = data.render.count;
+	stats->overruns = data.overruns;
+	stats->late = data.late;
+	stats->render_min = data.render.min;
+	stats->render_avg = WaveStatAvg(&data.render);
+	stats->render_max = data.render.max;
+	stats->slack_min = data.slack.min;
+	stats->slack_avg = WaveStatAvg(&data.slack);
+	stats->slack_max = data.slack.max;
+	OSTaskStkChk(&SineWaveGenTCB, &stk_free, &stk_used, &os_err);
+	stats->stk_used = (os_err == OS_ERR_NONE) ? (INT32U)stk_used : 0;
+}
+/****************************************************************************************
+ * SineStatsReset()- Public
+ * Clears the block timing and overrun counts.
+ ***************************************************************************************/
+void SineStatsReset(void){
+	CPU_SR_ALLOC();
+	CPU_CRITICAL_ENTER();
+	WaveStatReset(&SineStatData.render);
+	WaveStatReset(&SineStatData.slack);
+	SineStatData.late = 0;
+	SineStatData.overruns = 0;
+	CPU_CRITICAL_EXIT();
 }
@@ -1,14 +1,58 @@
 /****************************************************
  * Sinewave.h
  * Header file for Sinewave.c
+ * Include MCUType.h first.
  * Created by: Karen Aguilar,Rodrick Muya 03/09/2022
  ****************************************************/
 #ifndef SINEWAVE_H_
 #define SINEWAVE_H_
 
+#include "WaveFx.h"
+#include "WaveTone.h"
+#include "WaveSeq.h"
+
+/* Output channels, one per DAC */
+#define SINE_CH_DAC0    0u
+#define SINE_CH_DAC1    1u
+#define SINE_NUM_CH     2u
+
+/* Block timing from GetSinStats(), CPU cycles */
+typedef struct {
+    INT32U  blocks;         //blocks rendered
+    INT32U  overruns;       //blocks the DMA played before they were rendered
+    INT32U  late;           //blocks rendered after the DMA needed them
+    INT32S  render_min;     //render time per block
+    INT32S  render_avg;
+    INT32S  render_max;
+    INT32S  slack_min;      //time left before the DMA needed the block
+    INT32S  slack_avg;
+    INT32S  slack_max;
+    INT32U  stk_used;       //processing task stack high-water mark, CPU_STK words
+} SINE_STATS;
+
+/* Where the codes from GetSinCapture() came from */
+typedef struct {
+    FP32    sample_rate;    //DAC sample rate, Hz
+    INT16U  freq;           //frequency set on the channel
+} SINE_CAPTURE_INFO;
+
 void SineWaveInit(void);
-void SetSinFreq(INT16U changefreq);
-void SetSinAmp(INT8U changeamp);
+void SetSinFreq(INT8U ch, INT16U changefreq);
+void SetSinAmp(INT8U ch, INT8U changeamp);
+void SetSinShape(INT8U ch, INT8U changeshape);
+void SetSinUserTable(INT8U ch, const INT16S *table);
+void SetSinTones(INT8U ch, const WAVE_TONE_SET *tones, INT8U num_tones);
+void SetSinSweep(INT8U ch, INT16U startfreq, INT16U stopfreq, INT32U time_ms, INT8U law);
+INT8U GetSinSweepActive(INT8U ch);
+void SetSinMod(INT8U ch, INT8U type, INT16U rate, INT16U depth);
+void SetSinEnable(INT8U enable);
+void SetSinUpsample(INT8U enable);
+void SetSinFx(INT8U ch, const WAVE_FX_SET *stages, INT8U num_stages);
+void SetSinSequence(INT8U ch, const WAVE_SEQ_STEP *steps, INT8U num_steps, INT8U loop);
+INT8U GetSinSeqActive(INT8U ch);
+void GetSinStats(SINE_STATS *stats);
+INT8U GetSinCapture(INT8U ch, INT16U *codes, INT32U num, SINE_CAPTURE_INFO *info);
+void SineStatsReset(void);
 void DMA0_DMA16_IRQHandler(void);
 
 #endif /* SINEWAVE_H_ */
@@ -0,0 +1,137 @@
+/****************************************************************************
+ * WaveAna.c
+ * Measures WAVE_ANA_SIZE 12-bit DAC codes of one channel. The codes lose
+ * their mean, get a 4-term Blackman-Harris window, whose sidelobes sit
+ * 92 dB down, and go through the WaveFft.c real FFT. Each line is taken
+ * as the power in its main lobe, WAVE_ANA_LOBE bins either side. Summed
+ * over the lobe the power and its centroid do not depend on where the
+ * line falls between bins, so the fundamental frequency comes from the
+ * centroid with no interpolation bias.
+ *  - THD sums harmonics 2 to WAVE_ANA_HARM, folded back below half the
+ *    sample rate as the DAC aliases them. Harmonics that fold onto the
+ *    fundamental or DC are left out.
+ *  - SFDR is the strongest lobe anywhere outside DC and the fundamental,
+ *    harmonic or not.
+ * Plain C and single precision float, so the host and the target report
+ * the same figures. Uses static buffers, so only one task may call it.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveFft.h"
+#include "WaveAna.h"
+
+#if (WAVE_ANA_SIZE > WAVE_FFT_MAX_SIZE)
+#error "WAVE_ANA_SIZE is larger than the FFT"
+#endif
+
+#define WAVE_ANA_BINS       (WAVE_ANA_SIZE / 2u)
+#define WAVE_ANA_FS_CODES   2048.0f     /* peak of a full-scale 12-bit sine */
+#define WAVE_ANA_FLOOR      1.0e-20f    /* keeps log10f() finite          */
+
+static FP32 waveAnaBuf[WAVE_ANA_SIZE];  /* windowed samples, then power per bin */
+
+static FP32 waveAnaLobe(INT32U center, FP32 *moment);
+static FP32 waveAnaDb(FP32 ratio);
+
+/****************************************************************************
+ * WaveAnaRun() - Public
+ * Analyzes WAVE_ANA_SIZE codes played at sample_rate, set_freq the
+ * frequency the channel is set to. The fundamental is the strongest lobe
+ * above DC.
+ ****************************************************************************/
+void WaveAnaRun(const INT16U *codes, FP32 sample_rate, FP32 set_freq, WAVE_ANA_RESULT *result){
+    FP32 mean = 0.0f;
+    FP32 wsum = 0.0f;
+    FP32 w;
+    FP32 x;
+    FP32 p1;
+    FP32 moment;
+    FP32 ph;
+    FP32 pmax;
+    FP32 bin_hz = sample_rate / (FP32)WAVE_ANA_SIZE;
+    FP32 fh;
+    INT32U k;
+    INT32U k1 = WAVE_ANA_LOBE + 1u;
+    INT32U kh;
+    INT32U i;
+
+    for(i = 0; i < WAVE_ANA_SIZE; i++){
+        mean += (FP32)codes[i];
+    }
+    mean /= (FP32)WAVE_ANA_SIZE;
+    for(i = 0; i < WAVE_ANA_SIZE; i++){
+        x = (6.28318531f * (FP32)i) / (FP32)WAVE_ANA_SIZE;
+        w = 0.35875f - (0.48829f * cosf(x)) + (0.14128f * cosf(2.0f * x)) - (0.01168f * cosf(3.0f * x));
+        wsum += w * w;
+        waveAnaBuf[i] = ((FP32)codes[i] - mean) * w;
+    }
+    WaveFftReal(&waveAnaBuf[0], WAVE_ANA_SIZE);
+    /* power per bin in place, bin k only reads entries 2k and up */
+    for(k = 1; k < WAVE_ANA_BINS; k++){
+        waveAnaBuf[k] = (waveAnaBuf[2u * k] * waveAnaBuf[2u * k]) + (waveAnaBuf[(2u * k) + 1u] * waveAnaBuf[(2u * k) + 1u]);
+    }
+    waveAnaBuf[0] = 0.0f;                  /* DC is excluded anyway, Nyquist dropped */
+    for(k = WAVE_ANA_LOBE + 1u; k < (WAVE_ANA_BINS - WAVE_ANA_LOBE); k++){
+        if(waveAnaBuf[k] > waveAnaBuf[k1]){
+            k1 = k;
+        }else{
+        }
+    }
+    p1 = waveAnaLobe(k1, &moment);
+    if(p1 < WAVE_ANA_FLOOR){                /* silent channel */
+        p1 = WAVE_ANA_FLOOR;
+    }else{
+    }
+    result->freq = (moment / p1) * bin_hz;
+    result->freq_err_ppm = (set_freq > 0.0f) ? (((result->freq - set_freq) / set_freq) * 1.0e6f) : 0.0f;
+    /* one-sided lobe power of a sine of peak A is A^2 * n * sum(w^2) / 4 */
+    result->level_db = waveAnaDb((4.0f * p1) / ((FP32)WAVE_ANA_SIZE * wsum * WAVE_ANA_FS_CODES * WAVE_ANA_FS_CODES));
+    ph = 0.0f;
+    for(i = 2; i <= WAVE_ANA_HARM; i++){
+        fh = fmodf((FP32)i * result->freq, sample_rate);
+        if(fh > (0.5f * sample_rate)){
+            fh = sample_rate - fh;
+        }else{
+        }
+        kh = (INT32U)((fh / bin_hz) + 0.5f);
+        if((kh > (2u * WAVE_ANA_LOBE)) && (kh < (WAVE_ANA_BINS - WAVE_ANA_LOBE)) &&
+           (((kh + (2u * WAVE_ANA_LOBE)) < k1) || (kh > (k1 + (2u * WAVE_ANA_LOBE))))){
+            ph += waveAnaLobe(kh, &moment);
+        }else{
+        }
+    }
+    result->thd_db = waveAnaDb(ph / p1);
+    pmax = 0.0f;
+    for(k = 2u * WAVE_ANA_LOBE + 1u; k < (WAVE_ANA_BINS - WAVE_ANA_LOBE); k++){
+        if(((k + (2u * WAVE_ANA_LOBE)) < k1) || (k > (k1 + (2u * WAVE_ANA_LOBE)))){
+            ph = waveAnaLobe(k, &moment);
+            if(ph > pmax){
+                pmax = ph;
+            }else{
+            }
+        }else{
+        }
+    }
+    result->sfdr_db = -waveAnaDb(pmax / p1);
+}
+/****************************************************************************
+ * waveAnaLobe() - Private
+ * Power in the WAVE_ANA_LOBE bins either side of center, and in *moment
+ * the same weighted by bin number.
+ ****************************************************************************/
+static FP32 waveAnaLobe(INT32U center, FP32 *moment){
+    FP32 p = 0.0f;
+    INT32U k;
+    *moment = 0.0f;
+    for(k = center - WAVE_ANA_LOBE; k <= (center + WAVE_ANA_LOBE); k++){
+        p += waveAnaBuf[k];
+        *moment += (FP32)k * waveAnaBuf[k];
+    }
+    return p;
+}
+/****************************************************************************
+ * waveAnaDb() - Private
+ ****************************************************************************/
+static FP32 waveAnaDb(FP32 ratio){
+    return 10.0f * log10f(ratio + WAVE_ANA_FLOOR);
+}
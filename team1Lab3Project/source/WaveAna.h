@@ -0,0 +1,23 @@
+/****************************************************************************
+ * WaveAna.h
+ * Header file for WaveAna.c
+ * Spectral quality of a captured output: frequency error, THD and SFDR.
+ ****************************************************************************/
+#ifndef WAVEANA_H_
+#define WAVEANA_H_
+
+#define WAVE_ANA_SIZE   2048u   /* samples per analysis, power of 2 <= WAVE_FFT_MAX_SIZE */
+#define WAVE_ANA_HARM   10u     /* highest harmonic counted in THD                  */
+#define WAVE_ANA_LOBE   4u      /* bins each side of a line, the window main lobe   */
+
+typedef struct {
+    FP32 freq;          /* measured fundamental, Hz                         */
+    FP32 freq_err_ppm;  /* freq against the set frequency                   */
+    FP32 level_db;      /* fundamental, dB against a full-scale DAC sine    */
+    FP32 thd_db;        /* harmonics 2 to WAVE_ANA_HARM against it, dBc     */
+    FP32 sfdr_db;       /* fundamental over the largest other line, dB      */
+} WAVE_ANA_RESULT;
+
+void WaveAnaRun(const INT16U *codes, FP32 sample_rate, FP32 set_freq, WAVE_ANA_RESULT *result);
+
+#endif /* WAVEANA_H_ */
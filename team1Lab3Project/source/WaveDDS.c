@@ -0,0 +1,113 @@
+/****************************************************************************
+ * WaveDDS.c
+ * Direct digital synthesis (DDS) sine engine. A 32-bit phase accumulator
+ * covers one full period over 2^32 counts. The top two bits select the
+ * quadrant, the next DDS_QTR_BITS index the quarter-wave table and the
+ * remaining bits linearly interpolate between table entries.
+ * Output samples are Q15.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveDDS.h"
+
+#define DDS_QTR_MASK    0x3FFFFFFFu                 /* phase within quadrant */
+#define DDS_FRAC_BITS   (30 - DDS_QTR_BITS)         /* bits below the index  */
+
+static INT16S ddsSineAt(INT32U ph);
+
+/****************************************************************************
+ * DDSPhaseStep() - Public
+ * Returns the phase increment for freq (Hz) at sample_rate (samples/s).
+ * Uses a 64-bit divide so only call it when the frequency changes.
+ ****************************************************************************/
+INT32U DDSPhaseStep(INT32U freq, INT32U sample_rate){
+    INT64U step;
+    step = (((INT64U)freq << 32) + (sample_rate >> 1)) / sample_rate;
+    return (INT32U)step;
+}
+/****************************************************************************
+ * ddsSineAt() - Private
+ * One Q15 sine sample at phase ph. Small enough for the compiler to inline
+ * into the block loops.
+ ****************************************************************************/
+static INT16S ddsSineAt(INT32U ph){
+    INT32U qtr_ph;
+    INT32U idx;
+    INT32S frac;
+    INT32S a;
+    INT32S y;
+
+    qtr_ph = ph & DDS_QTR_MASK;
+    if((ph & 0x40000000u) != 0){            /* 2nd/4th quadrant, mirror  */
+        qtr_ph ^= DDS_QTR_MASK;
+    }else{
+    }
+    idx = qtr_ph >> DDS_FRAC_BITS;
+    frac = (INT32S)((qtr_ph >> (DDS_FRAC_BITS - 16)) & 0xFFFFu);
+    a = DDSQtrSineTable[idx];
+    y = a + ((((DDSQtrSineTable[idx + 1] - a) * frac) + 0x8000) >> 16);
+    if((ph & 0x80000000u) != 0){            /* 3rd/4th quadrant, negate  */
+        y = -y;
+    }else{
+    }
+    return (INT16S)y;
+}
+/****************************************************************************
+ * DDSSineSample() - Public
+ * One Q15 sine sample at phase, for callers that need a single value per
+ * block rather than a block of samples.
+ ****************************************************************************/
+INT16S DDSSineSample(INT32U phase){
+    return ddsSineAt(phase);
+}
+/****************************************************************************
+ * DDSSineBlock() - Public
+ * Renders num_samples Q15 sine samples into out, advancing *phase by step
+ * each sample. The phase wraps naturally at 2^32.
+ ****************************************************************************/
+void DDSSineBlock(INT32U *phase, INT32U step, INT16S *out, INT32U num_samples){
+    INT32U ph = *phase;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        out[i] = ddsSineAt(ph);
+        ph += step;
+    }
+    *phase = ph;
+}
+/****************************************************************************
+ * DDSSineSweepLin() - Public
+ * As DDSSineBlock() with *step in Q32.32 growing by delta every sample, a
+ * linear chirp. One 64-bit add per sample on top of the sine.
+ ****************************************************************************/
+void DDSSineSweepLin(INT32U *phase, INT64U *step, INT64S delta, INT16S *out, INT32U num_samples){
+    INT32U ph = *phase;
+    INT64U st = *step;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        out[i] = ddsSineAt(ph);
+        ph += (INT32U)(st >> 32);
+        st += (INT64U)delta;
+    }
+    *phase = ph;
+    *step = st;
+}
+/****************************************************************************
+ * DDSSineSweepLog() - Public
+ * As DDSSineBlock() with *step in Q32.32 scaled by (1 + ratio/2^32) every
+ * sample, an exponential chirp. One 32x32 multiply per sample, the integer
+ * part of the step is accurate enough for the product.
+ ****************************************************************************/
+void DDSSineSweepLog(INT32U *phase, INT64U *step, INT32S ratio, INT16S *out, INT32U num_samples){
+    INT32U ph = *phase;
+    INT64U st = *step;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        out[i] = ddsSineAt(ph);
+        ph += (INT32U)(st >> 32);
+        st += (INT64U)((INT64S)(INT32S)(st >> 32) * ratio);
+    }
+    *phase = ph;
+    *step = st;
+}
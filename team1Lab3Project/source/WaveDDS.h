@@ -0,0 +1,24 @@
+/****************************************************************************
+ * WaveDDS.h
+ * Header file for WaveDDS.c
+ * Direct digital synthesis of a sinewave from a quarter-wave table.
+ ****************************************************************************/
+#ifndef WAVEDDS_H_
+#define WAVEDDS_H_
+
+/* Quarter-wave table holds 2^DDS_QTR_BITS entries plus one guard entry.
+ * SineTable.c must be regenerated with tools/GenSineTable.py if changed.  */
+#ifndef DDS_QTR_BITS
+#define DDS_QTR_BITS    8
+#endif
+#define DDS_QTR_SIZE    (1u << DDS_QTR_BITS)
+
+extern const INT16S DDSQtrSineTable[DDS_QTR_SIZE + 1];
+
+INT32U DDSPhaseStep(INT32U freq, INT32U sample_rate);
+INT16S DDSSineSample(INT32U phase);
+void DDSSineBlock(INT32U *phase, INT32U step, INT16S *out, INT32U num_samples);
+void DDSSineSweepLin(INT32U *phase, INT64U *step, INT64S delta, INT16S *out, INT32U num_samples);
+void DDSSineSweepLog(INT32U *phase, INT64U *step, INT32S ratio, INT16S *out, INT32U num_samples);
+
+#endif /* WAVEDDS_H_ */
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * WaveDac.c
+ * Scales a block of Q15 samples and formats them as offset-binary 12-bit
+ * DAC words with saturation.
+ * WaveDacFormat() uses the Cortex-M4 packed halfword instructions to do two
+ * samples per pass: SMLAD/SMLADX for the two rounded products, PKHTB to
+ * pack the high halves, QADD16 for the mid-scale offset and USAT16 to clamp
+ * both words to 12 bits. WaveDacFormatRef() is the portable C version and
+ * produces identical output. Without the DSP extension WaveDacFormat()
+ * falls back to the reference.
+ * WaveDacFormatPair() does the same for two channels with separate gains
+ * and interleaves them, one DAC0/DAC1 frame per 32-bit word.
+ ****************************************************************************/
+#include <string.h>
+#include "MCUType.h"
+#include "WaveDac.h"
+
+#define WAVE_DAC_ROUND          0x8000u
+#define WAVE_DAC_OFFSET_PAIR    ((WAVE_DAC_OFFSET << 16) | WAVE_DAC_OFFSET)
+
+/****************************************************************************
+ * WaveDacFormatRef() - Public
+ * Portable reference, one sample at a time.
+ ****************************************************************************/
+void WaveDacFormatRef(const INT16S *src, INT16U *dst, INT32U num_samples, INT16S gain){
+    INT32S dac;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        dac = (((INT32S)src[i] * gain + (INT32S)WAVE_DAC_ROUND) >> 16) + WAVE_DAC_OFFSET;
+        if(dac < 0){
+            dac = 0;
+        }else if(dac > WAVE_DAC_MAX){
+            dac = WAVE_DAC_MAX;
+        }else{
+        }
+        dst[i] = (INT16U)dac;
+    }
+}
+/****************************************************************************
+ * WaveDacFormatPairRef() - Public
+ * Portable reference for WaveDacFormatPair().
+ ****************************************************************************/
+void WaveDacFormatPairRef(const INT16S *src0, const INT16S *src1, INT16U *dst, INT32U num_samples,
+                          INT16S gain0, INT16S gain1){
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        WaveDacFormatRef(&src0[i], &dst[2 * i], 1, gain0);
+        WaveDacFormatRef(&src1[i], &dst[(2 * i) + 1], 1, gain1);
+    }
+}
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+/****************************************************************************
+ * WaveDacFormat() - Public
+ * Packed kernel, two samples per pass. An odd trailing sample goes through
+ * the reference.
+ ****************************************************************************/
+void WaveDacFormat(const INT16S *src, INT16U *dst, INT32U num_samples, INT16S gain){
+    INT32U gain_pair = (INT16U)gain;      /* gain in the bottom half only */
+    INT32U in_pair;
+    INT32U lo;
+    INT32U hi;
+    INT32U out_pair;
+    INT32U i;
+
+    for(i = 0; i < (num_samples & ~1u); i += 2){
+        memcpy(&in_pair, &src[i], sizeof(in_pair));
+        lo = __SMLAD(in_pair, gain_pair, WAVE_DAC_ROUND);     /* src[i]*gain   */
+        hi = __SMLADX(in_pair, gain_pair, WAVE_DAC_ROUND);    /* src[i+1]*gain */
+        out_pair = __PKHTB(hi, lo, 16);
+        out_pair = __USAT16(__QADD16(out_pair, WAVE_DAC_OFFSET_PAIR), 12);
+        memcpy(&dst[i], &out_pair, sizeof(out_pair));
+    }
+    if((num_samples & 1u) != 0){
+        WaveDacFormatRef(&src[i], &dst[i], 1, gain);
+    }else{
+    }
+}
+/****************************************************************************
+ * WaveDacFormatPair() - Public
+ * Packed kernel, two frames per pass. PKHBT/PKHTB regroup the two channel
+ * pairs into frames, then each half gets its own gain by zeroing the other
+ * half of the gain word in SMLAD.
+ ****************************************************************************/
+void WaveDacFormatPair(const INT16S *src0, const INT16S *src1, INT16U *dst, INT32U num_samples,
+                       INT16S gain0, INT16S gain1){
+    INT32U gain_lo = (INT16U)gain0;                 /* multiplies the ch0 half */
+    INT32U gain_hi = (INT32U)(INT16U)gain1 << 16;   /* multiplies the ch1 half */
+    INT32U in0;
+    INT32U in1;
+    INT32U frame;
+    INT32U out[2];
+    INT32U i;
+
+    for(i = 0; i < (num_samples & ~1u); i += 2){
+        memcpy(&in0, &src0[i], sizeof(in0));
+        memcpy(&in1, &src1[i], sizeof(in1));
+        frame = __PKHBT(in0, in1, 16);              /* src0[i],   src1[i]   */
+        out[0] = __PKHTB(__SMLAD(frame, gain_hi, WAVE_DAC_ROUND), __SMLAD(frame, gain_lo, WAVE_DAC_ROUND), 16);
+        frame = __PKHTB(in1, in0, 16);              /* src0[i+1], src1[i+1] */
+        out[1] = __PKHTB(__SMLAD(frame, gain_hi, WAVE_DAC_ROUND), __SMLAD(frame, gain_lo, WAVE_DAC_ROUND), 16);
+        out[0] = __USAT16(__QADD16(out[0], WAVE_DAC_OFFSET_PAIR), 12);
+        out[1] = __USAT16(__QADD16(out[1], WAVE_DAC_OFFSET_PAIR), 12);
+        memcpy(&dst[2 * i], &out[0], sizeof(out));
+    }
+    if((num_samples & 1u) != 0){
+        WaveDacFormatPairRef(&src0[i], &src1[i], &dst[2 * i], 1, gain0, gain1);
+    }else{
+    }
+}
+#else
+void WaveDacFormat(const INT16S *src, INT16U *dst, INT32U num_samples, INT16S gain){
+    WaveDacFormatRef(src, dst, num_samples, gain);
+}
+void WaveDacFormatPair(const INT16S *src0, const INT16S *src1, INT16U *dst, INT32U num_samples,
+                       INT16S gain0, INT16S gain1){
+    WaveDacFormatPairRef(src0, src1, dst, num_samples, gain0, gain1);
+}
+#endif
@@ -0,0 +1,25 @@
+/****************************************************************************
+ * WaveDac.h
+ * Header file for WaveDac.c
+ * Block conversion of Q15 samples to 12-bit DAC words.
+ ****************************************************************************/
+#ifndef WAVEDAC_H_
+#define WAVEDAC_H_
+
+#define WAVE_DAC_OFFSET     0x7FF       /* DAC mid-scale                     */
+#define WAVE_DAC_MAX        0xFFF       /* 12-bit DAC full-scale             */
+
+/* dst[i] = sat12(((src[i] * gain) >> 16) + WAVE_DAC_OFFSET), rounded.
+ * gain is the peak DAC swing per Q15 full-scale times 65536/32768.
+ * src and dst must be 32-bit aligned for the packed kernel.              */
+void WaveDacFormat(const INT16S *src, INT16U *dst, INT32U num_samples, INT16S gain);
+void WaveDacFormatRef(const INT16S *src, INT16U *dst, INT32U num_samples, INT16S gain);
+
+/* As above for two channels, dst[2i] from src0[i] and gain0, dst[2i+1]
+ * from src1[i] and gain1. dst holds 2*num_samples words.                  */
+void WaveDacFormatPair(const INT16S *src0, const INT16S *src1, INT16U *dst, INT32U num_samples,
+                       INT16S gain0, INT16S gain1);
+void WaveDacFormatPairRef(const INT16S *src0, const INT16S *src1, INT16U *dst, INT32U num_samples,
+                          INT16S gain0, INT16S gain1);
+
+#endif /* WAVEDAC_H_ */
@@ -0,0 +1,80 @@
+/****************************************************************************
+ * WaveDacBuf.c
+ * Works out the trigger, DAC buffer and DMA settings that play a ring of
+ * blocks, or a cached loop, at a PIT reload. The DAC buffer path cuts the
+ * DMA requests from one per frame to one per WAVE_DACBUF_BURST samples of
+ * each DAC. It plays the same samples at the same rate, WAVE_DACBUF_BURST
+ * triggers later. Blocks that do not split into whole bursts, or rates too
+ * slow for the PDB interval, fall back to a PIT request per frame.
+ *
+ * The buffer runs in normal mode over WAVE_DACBUF_WORDS words. The
+ * watermark flag is set when the read pointer reaches word
+ * WAVE_DACBUF_BURST. By then the first half of the buffer has played, and
+ * the top flag at word 0 marks the second half played. Each flag asks the
+ * DMA for one burst into the half just played. DMOD wraps the destination
+ * over the buffer. The read pointer starts on the last word, so the first
+ * trigger moves it to the top and the first burst lands in the second half.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveDacBuf.h"
+
+#if ((WAVE_DACBUF_WORDS & (WAVE_DACBUF_WORDS - 1u)) != 0) || (WAVE_DACBUF_WORDS > 16u)
+#error "WAVE_DACBUF_WORDS must be a power of 2 that fits the 16 word DAC buffer"
+#endif
+#if (WAVE_DACBUF_WORDS != (2u * WAVE_DACBUF_BURST))
+#error "Each flag refills half the DAC buffer"
+#endif
+#if ((WAVE_DACBUF_WORDS - 1u - WAVE_DACBUF_BURST) < 1u) || ((WAVE_DACBUF_WORDS - 1u - WAVE_DACBUF_BURST) > 4u)
+#error "The DAC watermark is 1 to 4 words below the upper limit"
+#endif
+
+/****************************************************************************
+ * WaveDacBufPlan() - Public
+ * Settings for num_blocks blocks of block_frames frames each, played at
+ * pit_ldval. The buffer path needs fifo TRUE, blocks of whole bursts, a
+ * ring that ends on the word it started on and an interval the PDB can
+ * count. Returns buf->fifo.
+ ****************************************************************************/
+INT8U WaveDacBufPlan(INT32U pit_ldval, INT32U block_frames, INT32U num_blocks, INT8U fifo,
+                     WAVE_DAC_BUF *buf){
+    INT32U period = pit_ldval + 1u;
+    INT32U bytes;
+
+    buf->ldval = pit_ldval;
+    if((fifo == TRUE) && (block_frames > 0) && ((block_frames % WAVE_DACBUF_BURST) == 0) &&
+       (((block_frames * num_blocks) % WAVE_DACBUF_WORDS) == 0) && (period <= WAVE_DACBUF_MAX_INT)){
+        buf->fifo = TRUE;
+        buf->upper = (INT8U)(WAVE_DACBUF_WORDS - 1u);
+        buf->start = buf->upper;
+        buf->watermark = (INT8U)(WAVE_DACBUF_WORDS - 2u - WAVE_DACBUF_BURST);
+        buf->dmod = 0;
+        for(bytes = WAVE_DACBUF_WORDS * 2u; bytes > 1u; bytes >>= 1){
+            buf->dmod++;
+        }
+        buf->burst = (INT8U)WAVE_DACBUF_BURST;
+        buf->requests = block_frames / WAVE_DACBUF_BURST;
+        buf->pdb_mod = ((WAVE_DACBUF_MAX_INT / period) * period) - 1u;
+    }else{
+        buf->fifo = FALSE;
+        buf->upper = 0;
+        buf->start = 0;
+        buf->watermark = 0;
+        buf->dmod = 0;
+        buf->burst = 1;
+        buf->requests = block_frames;
+        buf->pdb_mod = 0;
+    }
+    return buf->fifo;
+}
+/****************************************************************************
+ * WaveDacBufWord() - Public
+ * Buffer word the DMA writes frame of the ring to, WAVE_DACBUF_BURST
+ * words behind the read pointer. Always 0 without the buffer.
+ ****************************************************************************/
+INT8U WaveDacBufWord(const WAVE_DAC_BUF *buf, INT32U frame){
+    if(buf->fifo == TRUE){
+        return (INT8U)((frame + WAVE_DACBUF_BURST) % WAVE_DACBUF_WORDS);
+    }else{
+        return 0;
+    }
+}
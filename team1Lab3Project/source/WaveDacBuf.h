@@ -0,0 +1,34 @@
+/****************************************************************************
+ * WaveDacBuf.h
+ * Header file for WaveDacBuf.c
+ * Trigger, DAC buffer and DMA geometry of the DAC output path.
+ ****************************************************************************/
+#ifndef WAVEDACBUF_H_
+#define WAVEDACBUF_H_
+
+#define WAVE_DACBUF_WORDS   8u          /* DAC buffer words in use, 2^n    */
+#define WAVE_DACBUF_BURST   4u          /* samples per DMA request per DAC */
+#define WAVE_DACBUF_MAX_INT 0x10000u    /* longest PDB interval, clocks    */
+
+/* How the DMA feeds the DACs for one ring of blocks or one cached loop.
+ * With fifo TRUE each DAC runs its buffer in normal mode from its PDB
+ * interval trigger and asks its own DMA channel for burst words at the
+ * watermark and again at the top of the buffer. With fifo FALSE the PIT
+ * asks one DMA channel for one DAC0/DAC1 frame per sample.                */
+typedef struct {
+    INT8U  fifo;        /* TRUE: DAC buffer and PDB, FALSE: PIT per frame  */
+    INT8U  upper;       /* C2 DACBFUP, last buffer word                    */
+    INT8U  start;       /* C2 DACBFRP before the first trigger             */
+    INT8U  watermark;   /* C1 DACBFWM, flag at upper-watermark-1 words     */
+    INT8U  dmod;        /* DMA DMOD, the buffer as a 2^dmod byte ring      */
+    INT8U  burst;       /* samples per DMA request per DAC                 */
+    INT32U requests;    /* DMA requests per block per DAC                  */
+    INT32U ldval;       /* PIT LDVAL or PDB DAC interval, ldval+1 clocks   */
+    INT32U pdb_mod;     /* PDB MOD, a whole number of intervals            */
+} WAVE_DAC_BUF;
+
+INT8U WaveDacBufPlan(INT32U pit_ldval, INT32U block_frames, INT32U num_blocks, INT8U fifo,
+                     WAVE_DAC_BUF *buf);
+INT8U WaveDacBufWord(const WAVE_DAC_BUF *buf, INT32U frame);
+
+#endif /* WAVEDACBUF_H_ */
@@ -0,0 +1,129 @@
+/****************************************************************************
+ * WaveFft.c
+ * Real FFT for the output analyzer. The n real samples are transformed as
+ * n/2 complex points with an iterative radix-2 FFT, then split into the
+ * spectrum of the real signal. The output uses the arm_rfft_fast_f32()
+ * layout: buf[0] is bin 0, buf[1] bin n/2, both real, then the real and
+ * imaginary parts of bins 1 to n/2-1. The twiddles come from one cosine
+ * table for WAVE_FFT_MAX_SIZE, filled on first use, which every smaller
+ * size strides through. Uses a static table, so only one task may call it
+ * the first time.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveFft.h"
+
+#define WAVE_FFT_QUARTER    (WAVE_FFT_MAX_SIZE / 4u)
+
+static FP32 waveFftCos[WAVE_FFT_MAX_SIZE / 2u];    /* cos(2*pi*j/WAVE_FFT_MAX_SIZE) */
+static INT8U waveFftCosReady = FALSE;
+
+static void waveFftComplex(FP32 *buf, INT32U h);
+static void waveFftTwiddle(INT32U j, FP32 *c, FP32 *s);
+
+/****************************************************************************
+ * WaveFftReal() - Public
+ * Transforms n real samples in buf in place, n a power of 2 from 4 to
+ * WAVE_FFT_MAX_SIZE. Unscaled, a full-scale sine of amplitude A gives
+ * about A*n/2 in its bin.
+ ****************************************************************************/
+void WaveFftReal(FP32 *buf, INT32U n){
+    INT32U h = n / 2u;
+    INT32U stride = WAVE_FFT_MAX_SIZE / n;
+    INT32U k;
+    INT32U i;
+    FP32 evr;
+    FP32 evi;
+    FP32 odr;
+    FP32 odi;
+    FP32 c;
+    FP32 s;
+    FP32 t;
+
+    if(waveFftCosReady == FALSE){
+        for(i = 0; i < (WAVE_FFT_MAX_SIZE / 2u); i++){
+            waveFftCos[i] = cosf((6.28318531f * (FP32)i) / (FP32)WAVE_FFT_MAX_SIZE);
+        }
+        waveFftCosReady = TRUE;
+    }else{
+    }
+    waveFftComplex(buf, h);
+    /* X[k] = E[k] + W^k O[k], E and O the spectra of the even and odd samples */
+    for(k = 1; k <= (h / 2u); k++){
+        evr = 0.5f * (buf[2u * k] + buf[2u * (h - k)]);
+        evi = 0.5f * (buf[(2u * k) + 1u] - buf[(2u * (h - k)) + 1u]);
+        odr = 0.5f * (buf[(2u * k) + 1u] + buf[(2u * (h - k)) + 1u]);
+        odi = 0.5f * (buf[2u * (h - k)] - buf[2u * k]);
+        waveFftTwiddle(k * stride, &c, &s);
+        buf[2u * (h - k)] = evr - (c * odr) - (s * odi);
+        buf[(2u * (h - k)) + 1u] = -evi + (c * odi) - (s * odr);
+        buf[2u * k] = evr + (c * odr) + (s * odi);
+        buf[(2u * k) + 1u] = evi + (c * odi) - (s * odr);
+    }
+    t = buf[0];
+    buf[0] = t + buf[1];
+    buf[1] = t - buf[1];
+}
+/****************************************************************************
+ * waveFftComplex() - Private
+ * In-place radix-2 decimation in time FFT of h interleaved complex points.
+ ****************************************************************************/
+static void waveFftComplex(FP32 *buf, INT32U h){
+    INT32U stride = WAVE_FFT_MAX_SIZE / h;
+    INT32U len;
+    INT32U half;
+    INT32U i;
+    INT32U j;
+    INT32U m;
+    INT32U bit;
+    FP32 c;
+    FP32 s;
+    FP32 tr;
+    FP32 ti;
+    FP32 *a;
+    FP32 *b;
+
+    j = 0;
+    for(i = 0; i < (h - 1u); i++){
+        if(i < j){
+            tr = buf[2u * i];
+            ti = buf[(2u * i) + 1u];
+            buf[2u * i] = buf[2u * j];
+            buf[(2u * i) + 1u] = buf[(2u * j) + 1u];
+            buf[2u * j] = tr;
+            buf[(2u * j) + 1u] = ti;
+        }else{
+        }
+        bit = h >> 1;
+        while((j & bit) != 0){
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+    for(len = 2; len <= h; len <<= 1){
+        half = len >> 1;
+        for(m = 0; m < half; m++){
+            waveFftTwiddle(m * (stride * h / len), &c, &s);
+            for(i = m; i < h; i += len){
+                a = &buf[2u * i];
+                b = &buf[2u * (i + half)];
+                tr = (b[0] * c) + (b[1] * s);       /* b * e^(-i*angle) */
+                ti = (b[1] * c) - (b[0] * s);
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+/****************************************************************************
+ * waveFftTwiddle() - Private
+ * cos and sin of 2*pi*j/WAVE_FFT_MAX_SIZE for j up to half the table,
+ * sin from the cosine a quarter turn back.
+ ****************************************************************************/
+static void waveFftTwiddle(INT32U j, FP32 *c, FP32 *s){
+    *c = waveFftCos[j];
+    *s = waveFftCos[(j >= WAVE_FFT_QUARTER) ? (j - WAVE_FFT_QUARTER) : (WAVE_FFT_QUARTER - j)];
+}
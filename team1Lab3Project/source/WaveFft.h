@@ -0,0 +1,13 @@
+/****************************************************************************
+ * WaveFft.h
+ * Header file for WaveFft.c
+ * In-place single precision real FFT.
+ ****************************************************************************/
+#ifndef WAVEFFT_H_
+#define WAVEFFT_H_
+
+#define WAVE_FFT_MAX_SIZE   2048u   /* largest transform, power of 2         */
+
+void WaveFftReal(FP32 *buf, INT32U n);
+
+#endif /* WAVEFFT_H_ */
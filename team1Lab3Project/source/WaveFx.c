@@ -0,0 +1,220 @@
+/****************************************************************************
+ * WaveFx.c
+ * Effects chain run on each channel's Q15 block in place, after the
+ * generator and before WaveDacFormatPair(). Every stage processes the
+ * whole block through its own function, so the stage type costs one
+ * indirect call per block and nothing per sample.
+ *  - Low-pass/high-pass: direct form I biquad, Q30 coefficients with a
+ *    64-bit accumulator and the output history kept in Q27, so low cutoffs
+ *    do not lose their poles to rounding and overshoot has headroom. The
+ *    part of each output truncated away is added to the next one
+ *  - DC: saturating offset
+ *  - Gain: Q16 gain with saturation
+ *  - Clip: symmetric hard limit
+ * Filter coefficients are worked out in float once, in WaveFxChainInit().
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveFx.h"
+
+#define WAVE_FX_COEF_ONE    1073741824.0f   /* 1.0 in Q30                */
+#define WAVE_FX_Y_SHIFT     12              /* Q15 sample to Q27 history */
+#define WAVE_FX_BUTTER_Q    0.70710678f
+
+static void waveFxBiquadInit(WAVE_FX_STAGE *stage, WAVE_FX_TYPE type, INT32S cutoff, INT32U sample_rate);
+static void waveFxBiquad(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples);
+static void waveFxDc(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples);
+static void waveFxGain(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples);
+static void waveFxClip(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples);
+static INT16S waveFxSat(INT32S value);
+
+/****************************************************************************
+ * WaveFxChainInit() - Public
+ * Builds chain from num_stages settings in set, run in that order, for
+ * sample_rate. Unknown types and stages past WAVE_FX_MAX_STAGES are
+ * dropped. Filter state starts at rest.
+ ****************************************************************************/
+void WaveFxChainInit(WAVE_FX_CHAIN *chain, const WAVE_FX_SET *set, INT8U num_stages, INT32U sample_rate){
+    WAVE_FX_STAGE *stage;
+    INT8U i;
+    INT8U s;
+
+    chain->num_stages = 0;
+    for(i = 0; (i < num_stages) && (chain->num_stages < WAVE_FX_MAX_STAGES); i++){
+        stage = &chain->stage[chain->num_stages];
+        for(s = 0; s < 5u; s++){
+            stage->state[s] = 0;
+        }
+        stage->coef[0] = set[i].param;
+        switch(set[i].type){
+        case WAVE_FX_LOWPASS:
+        case WAVE_FX_HIGHPASS:
+            waveFxBiquadInit(stage, (WAVE_FX_TYPE)set[i].type, set[i].param, sample_rate);
+            stage->process = waveFxBiquad;
+            chain->num_stages++;
+            break;
+        case WAVE_FX_DC:
+            stage->process = waveFxDc;
+            chain->num_stages++;
+            break;
+        case WAVE_FX_GAIN:
+            stage->process = waveFxGain;
+            chain->num_stages++;
+            break;
+        case WAVE_FX_CLIP:
+            if(stage->coef[0] < 0){
+                stage->coef[0] = 0;
+            }else if(stage->coef[0] > 32767){
+                stage->coef[0] = 32767;
+            }else{
+            }
+            stage->process = waveFxClip;
+            chain->num_stages++;
+            break;
+        default:
+            break;
+        }
+    }
+}
+/****************************************************************************
+ * WaveFxChainRun() - Public
+ * Runs every stage over num_samples Q15 samples of blk in place.
+ ****************************************************************************/
+void WaveFxChainRun(WAVE_FX_CHAIN *chain, INT16S *blk, INT32U num_samples){
+    INT8U i;
+    for(i = 0; i < chain->num_stages; i++){
+        chain->stage[i].process(&chain->stage[i], blk, num_samples);
+    }
+}
+/****************************************************************************
+ * waveFxBiquadInit() - Private
+ * Butterworth low-pass or high-pass at cutoff Hz, bilinear transform. The
+ * cutoff is held inside (0, sample_rate/2). 1 - cos(w0) is taken as
+ * 2*sin^2(w0/2), single precision cancels it to nothing at low cutoffs.
+ ****************************************************************************/
+static void waveFxBiquadInit(WAVE_FX_STAGE *stage, WAVE_FX_TYPE type, INT32S cutoff, INT32U sample_rate){
+    FP32 w0;
+    FP32 alpha;
+    FP32 s2;
+    FP32 a0;
+    FP32 b0;
+
+    if(cutoff < 1){
+        cutoff = 1;
+    }else if((INT32U)cutoff >= (sample_rate / 2u)){
+        cutoff = (INT32S)(sample_rate / 2u) - 1;
+    }else{
+    }
+    w0 = (2.0f * 3.14159265f * (FP32)cutoff) / (FP32)sample_rate;
+    s2 = sinf(w0 / 2.0f);
+    s2 = s2 * s2;
+    alpha = sinf(w0) / (2.0f * WAVE_FX_BUTTER_Q);
+    a0 = 1.0f + alpha;
+    if(type == WAVE_FX_LOWPASS){
+        b0 = s2;                                /* (1 - cos(w0))/2 */
+    }else{
+        b0 = 1.0f - s2;                         /* (1 + cos(w0))/2 */
+    }
+    stage->coef[0] = (INT32S)lroundf((b0 / a0) * WAVE_FX_COEF_ONE);
+    stage->coef[2] = stage->coef[0];
+    /* 1 + a1 + a2 = 4*s2/a0 is about w0^2, under the single precision
+     * rounding of a1 at low cutoffs. It and a2 = 1 - 2*alpha/a0 are
+     * worked out from their small parts and a1 takes up the rest, or the
+     * poles land on the unit circle */
+    stage->coef[4] = 0x40000000 - (INT32S)lroundf(((2.0f * alpha) / a0) * WAVE_FX_COEF_ONE);
+    stage->coef[3] = ((INT32S)lroundf(((4.0f * s2) / a0) * WAVE_FX_COEF_ONE) - 0x40000000) - stage->coef[4];
+    /* b0 is only a few counts at low cutoffs, b1 takes up its rounding so
+     * the low-pass DC gain is exactly 1 and the high-pass DC gain exactly 0 */
+    if(type == WAVE_FX_LOWPASS){
+        stage->coef[1] = (0x40000000 + stage->coef[3] + stage->coef[4]) - (2 * stage->coef[0]);
+    }else{
+        stage->coef[1] = -2 * stage->coef[0];
+    }
+}
+/****************************************************************************
+ * waveFxBiquad() - Private
+ * y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2, accumulated in Q57. The
+ * remainder of truncating y to Q27 goes into the next sample. Left out, it
+ * is amplified by 1/(1 + a1 + a2), about 1/w0^2, and a 1 Hz low-pass at
+ * 8 kS/s settled a DC input 372 LSB low. Fed back, the truncation error
+ * has a zero at DC and the exact DC gain of the coefficients holds.
+ ****************************************************************************/
+static void waveFxBiquad(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples){
+    INT32S x1 = stage->state[0];
+    INT32S x2 = stage->state[1];
+    INT32S y1 = stage->state[2];
+    INT32S y2 = stage->state[3];
+    INT32S rem = stage->state[4];
+    INT32S x0;
+    INT32S y0;
+    INT64S acc;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        x0 = blk[i];
+        acc = ((INT64S)stage->coef[0] * x0) + ((INT64S)stage->coef[1] * x1) + ((INT64S)stage->coef[2] * x2);
+        acc <<= WAVE_FX_Y_SHIFT;
+        acc -= ((INT64S)stage->coef[3] * y1) + ((INT64S)stage->coef[4] * y2);
+        acc += rem;
+        y0 = (INT32S)(acc >> 30);
+        rem = (INT32S)acc & 0x3FFFFFFF;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = y0;
+        blk[i] = waveFxSat(y0 >> WAVE_FX_Y_SHIFT);
+    }
+    stage->state[0] = x1;
+    stage->state[1] = x2;
+    stage->state[2] = y1;
+    stage->state[3] = y2;
+    stage->state[4] = rem;
+}
+/****************************************************************************
+ * waveFxDc() - Private
+ ****************************************************************************/
+static void waveFxDc(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples){
+    INT32S offset = stage->coef[0];
+    INT32U i;
+    for(i = 0; i < num_samples; i++){
+        blk[i] = waveFxSat(blk[i] + offset);
+    }
+}
+/****************************************************************************
+ * waveFxGain() - Private
+ ****************************************************************************/
+static void waveFxGain(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples){
+    INT64S gain = stage->coef[0];
+    INT32U i;
+    for(i = 0; i < num_samples; i++){
+        blk[i] = waveFxSat((INT32S)((blk[i] * gain) >> 16));
+    }
+}
+/****************************************************************************
+ * waveFxClip() - Private
+ ****************************************************************************/
+static void waveFxClip(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples){
+    INT32S limit = stage->coef[0];
+    INT32U i;
+    for(i = 0; i < num_samples; i++){
+        if(blk[i] > limit){
+            blk[i] = (INT16S)limit;
+        }else if(blk[i] < -limit){
+            blk[i] = (INT16S)-limit;
+        }else{
+        }
+    }
+}
+/****************************************************************************
+ * waveFxSat() - Private
+ * Clamps value to the Q15 range.
+ ****************************************************************************/
+static INT16S waveFxSat(INT32S value){
+    if(value > 32767){
+        value = 32767;
+    }else if(value < -32768){
+        value = -32768;
+    }else{
+    }
+    return (INT16S)value;
+}
@@ -0,0 +1,41 @@
+/****************************************************************************
+ * WaveFx.h
+ * Header file for WaveFx.c
+ * Per-block effects chain between a generator and the DAC formatter.
+ ****************************************************************************/
+#ifndef WAVEFX_H_
+#define WAVEFX_H_
+
+#define WAVE_FX_MAX_STAGES  4u
+
+typedef enum {WAVE_FX_LOWPASS, WAVE_FX_HIGHPASS, WAVE_FX_DC, WAVE_FX_GAIN, WAVE_FX_CLIP,
+              WAVE_FX_COUNT} WAVE_FX_TYPE;
+
+/* One stage as configured. param is the cutoff in Hz for the filters
+ * (2nd order Butterworth), the offset in Q15 for WAVE_FX_DC, the gain in
+ * Q16 (65536 = 1.0) for WAVE_FX_GAIN and the limit in Q15 for WAVE_FX_CLIP. */
+typedef struct {
+    INT8U  type;        /* WAVE_FX_TYPE                                     */
+    INT32S param;
+} WAVE_FX_SET;
+
+typedef struct WAVE_FX_STAGE_S WAVE_FX_STAGE;
+
+/* Stage at run time. The biquad keeps b0 b1 b2 a1 a2 in Q30, x1 x2 y1 y2
+ * with y in Q27 and the Q57 remainder y1 was truncated by. The other stages
+ * only use coef[0].                                                        */
+struct WAVE_FX_STAGE_S {
+    void (*process)(WAVE_FX_STAGE *stage, INT16S *blk, INT32U num_samples);
+    INT32S coef[5];
+    INT32S state[5];
+};
+
+typedef struct {
+    WAVE_FX_STAGE stage[WAVE_FX_MAX_STAGES];
+    INT8U num_stages;
+} WAVE_FX_CHAIN;
+
+void WaveFxChainInit(WAVE_FX_CHAIN *chain, const WAVE_FX_SET *set, INT8U num_stages, INT32U sample_rate);
+void WaveFxChainRun(WAVE_FX_CHAIN *chain, INT16S *blk, INT32U num_samples);
+
+#endif /* WAVEFX_H_ */
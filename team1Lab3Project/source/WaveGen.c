@@ -0,0 +1,242 @@
+/****************************************************************************
+ * WaveGen.c
+ * Waveform generators for the DAC pipeline. Each generator renders a whole
+ * block of Q15 samples from the shared 32-bit phase accumulator, so the
+ * only indirect call is one per block.
+ *  - Sine:     quarter-wave table DDS in WaveDDS.c
+ *  - Triangle, sawtooth, square and user: band-limited octave tables from
+ *              WaveMip.c, linearly interpolated. The triangle peaks at the
+ *              same phase as the sine, the sawtooth rises through zero and
+ *              the square has its rising edge at phase 0.
+ *  - Tones:    sum of harmonics from the resonators in WaveTone.c
+ *  - Noise:    white or pink noise from WaveNoise.c, ignores phase and step
+ * The table shapes pick their octave once per block from the phase step,
+ * the richest one with nothing above half the sample rate, so the per
+ * sample cost is one interpolated lookup. A block where the octave changes
+ * crossfades from the old table to the new one.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveGen.h"
+#include "WaveTone.h"
+#include "WaveNoise.h"
+#include "WaveMip.h"
+
+static void waveGenPhaseInit(WAVE_GEN *gen);
+static void waveGenTriInit(WAVE_GEN *gen);
+static void waveGenSawInit(WAVE_GEN *gen);
+static void waveGenSquareInit(WAVE_GEN *gen);
+static void waveGenUserInit(WAVE_GEN *gen);
+static void waveGenSineRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+static void waveGenMipRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+static void waveGenMipFade(WAVE_GEN *gen, INT8U level, INT16S *out, INT32U num_samples);
+static void waveGenTonesRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+static void waveGenNoiseRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+static void waveGenPinkRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+
+const WAVE_GEN_OPS WaveGenSine     = {waveGenPhaseInit, waveGenSineRender};
+const WAVE_GEN_OPS WaveGenTriangle = {waveGenTriInit, waveGenMipRender};
+const WAVE_GEN_OPS WaveGenSawtooth = {waveGenSawInit, waveGenMipRender};
+const WAVE_GEN_OPS WaveGenSquare   = {waveGenSquareInit, waveGenMipRender};
+const WAVE_GEN_OPS WaveGenUser     = {waveGenUserInit, waveGenMipRender};
+const WAVE_GEN_OPS WaveGenTones    = {waveGenPhaseInit, waveGenTonesRender};
+const WAVE_GEN_OPS WaveGenNoise    = {waveGenPhaseInit, waveGenNoiseRender};
+const WAVE_GEN_OPS WaveGenPink     = {waveGenPhaseInit, waveGenPinkRender};
+
+static const WAVE_GEN_OPS * const waveGenShapeOps[WAVE_SHAPE_COUNT] = {
+    &WaveGenSine, &WaveGenTriangle, &WaveGenSawtooth, &WaveGenUser, &WaveGenTones, &WaveGenNoise,
+    &WaveGenPink, &WaveGenSquare
+};
+
+/****************************************************************************
+ * WaveGenInit() - Public
+ * Selects the generator for shape and runs its init. WAVE_SHAPE_USER plays
+ * the octave tables the caller built in gen->user with WaveMipBuildUser(),
+ * WAVE_SHAPE_TONES the tone set in gen->tones and the noise shapes the
+ * generator in gen->noise. An out of range shape, or a shape with nothing
+ * to play, falls back to sine. The step is left for the caller to set.
+ ****************************************************************************/
+void WaveGenInit(WAVE_GEN *gen, WAVE_SHAPE shape){
+    if((shape >= WAVE_SHAPE_COUNT) || ((shape == WAVE_SHAPE_USER) && (gen->user == (WAVE_MIP_USER *)0)) ||
+       ((shape == WAVE_SHAPE_TONES) && (gen->tones == (WAVE_TONES *)0)) ||
+       (((shape == WAVE_SHAPE_NOISE) || (shape == WAVE_SHAPE_PINK)) && (gen->noise == (WAVE_NOISE *)0))){
+        shape = WAVE_SHAPE_SINE;
+    }else{
+    }
+    gen->ops = waveGenShapeOps[shape];
+    gen->ops->init(gen);
+}
+/****************************************************************************
+ * WaveGenRender() - Public
+ * Renders num_samples Q15 samples into out with the selected generator.
+ ****************************************************************************/
+void WaveGenRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    gen->ops->render(gen, out, num_samples);
+}
+/****************************************************************************
+ * WaveGenIsPeriodic() - Public
+ * FALSE for the noise shapes, which never repeat and are white up to half
+ * the rate they are rendered at, so they can be neither cached as a loop
+ * of periods nor rendered at a lower rate and upsampled.
+ ****************************************************************************/
+INT8U WaveGenIsPeriodic(const WAVE_GEN *gen){
+    return (INT8U)((gen->ops != &WaveGenNoise) && (gen->ops != &WaveGenPink));
+}
+/****************************************************************************
+ * WaveGenUpsampleWins() - Public
+ * TRUE if gen is cheaper rendered at 1/WAVE_INTERP_L of the rate and
+ * upsampled than rendered direct, with every component at or below
+ * max_step, the top of the FIR passband. Only the tones shape, a
+ * resonator per harmonic, can cost more per sample than the FIR, from
+ * WAVE_GEN_UP_TONES tones on. The table shapes render about three times
+ * faster direct, see the upsample cases in tools/bench.
+ ****************************************************************************/
+INT8U WaveGenUpsampleWins(const WAVE_GEN *gen, INT32U max_step){
+    INT8U wins = (INT8U)((gen->ops == &WaveGenTones) && (gen->tones->num_tones >= WAVE_GEN_UP_TONES));
+    INT8U i;
+
+    for(i = 0; (wins == TRUE) && (i < gen->tones->num_tones); i++){
+        if(((INT64U)gen->step * gen->tones->harmonic[i]) > max_step){
+            wins = FALSE;
+        }else{
+        }
+    }
+    return wins;
+}
+/****************************************************************************
+ * waveGenPhaseInit() - Private
+ * Starts the period at phase zero, where every shape crosses zero rising.
+ ****************************************************************************/
+static void waveGenPhaseInit(WAVE_GEN *gen){
+    gen->phase = 0;
+}
+/****************************************************************************
+ * waveGenSineRender() - Private
+ ****************************************************************************/
+static void waveGenSineRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    DDSSineBlock(&gen->phase, gen->step, out, num_samples);
+}
+/****************************************************************************
+ * waveGenTriInit(), waveGenSawInit(), waveGenSquareInit(),
+ * waveGenUserInit() - Private
+ * Phase zero and the shape's octave tables. No level has played yet, so
+ * the first block does not crossfade.
+ ****************************************************************************/
+static void waveGenTriInit(WAVE_GEN *gen){
+    gen->phase = 0;
+    gen->mip = &WaveMipTriangle;
+    gen->level = WAVE_MIP_LEVELS;
+}
+static void waveGenSawInit(WAVE_GEN *gen){
+    gen->phase = 0;
+    gen->mip = &WaveMipSawtooth;
+    gen->level = WAVE_MIP_LEVELS;
+}
+static void waveGenSquareInit(WAVE_GEN *gen){
+    gen->phase = 0;
+    gen->mip = &WaveMipSquare;
+    gen->level = WAVE_MIP_LEVELS;
+}
+static void waveGenUserInit(WAVE_GEN *gen){
+    gen->phase = 0;
+    gen->mip = &gen->user->map;
+    gen->level = WAVE_MIP_LEVELS;
+}
+/****************************************************************************
+ * waveGenMipRender() - Private
+ * The top bits of the phase index the level's table, the next 16 bits
+ * interpolate toward the following entry, wrapping at the end of the period.
+ ****************************************************************************/
+static void waveGenMipRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    INT8U level;
+    const INT16S *table;
+    INT32U frac_bits;
+    INT32U mask;
+    INT32U ph = gen->phase;
+    INT32U step = gen->step;
+    INT32U idx;
+    INT32S frac;
+    INT32S a;
+    INT32U i;
+
+    level = WaveMipSelect(step);
+    if((level != gen->level) && (gen->level < WAVE_MIP_LEVELS)){
+        waveGenMipFade(gen, level, out, num_samples);
+    }else{
+        table = gen->mip->table[level];
+        frac_bits = 32u - gen->mip->bits[level];
+        mask = (1u << gen->mip->bits[level]) - 1u;
+        for(i = 0; i < num_samples; i++){
+            idx = ph >> frac_bits;
+            frac = (INT32S)((ph >> (frac_bits - 16u)) & 0xFFFFu);
+            a = table[idx];
+            out[i] = (INT16S)(a + ((((table[(idx + 1u) & mask] - a) * frac) + 0x8000) >> 16));
+            ph += step;
+        }
+        gen->phase = ph;
+    }
+    gen->level = level;
+}
+/****************************************************************************
+ * waveGenMipFade() - Private
+ * As waveGenMipRender() from the table of gen->level to the table of level,
+ * with a linear crossfade over the block. Two lookups per sample, only on
+ * the block where the octave changes.
+ ****************************************************************************/
+static void waveGenMipFade(WAVE_GEN *gen, INT8U level, INT16S *out, INT32U num_samples){
+    const INT16S *t0 = gen->mip->table[gen->level];
+    const INT16S *t1 = gen->mip->table[level];
+    INT32U fb0 = 32u - gen->mip->bits[gen->level];
+    INT32U fb1 = 32u - gen->mip->bits[level];
+    INT32U m0 = (1u << gen->mip->bits[gen->level]) - 1u;
+    INT32U m1 = (1u << gen->mip->bits[level]) - 1u;
+    INT32U ph = gen->phase;
+    INT32U step = gen->step;
+    INT32U mix = 0;
+    INT32U dmix;
+    INT32U idx;
+    INT32S frac;
+    INT32S a;
+    INT32S y0;
+    INT32S y1;
+    INT32U i;
+
+    if(num_samples == 0){
+        return;
+    }else{
+    }
+    dmix = 0x10000u / num_samples;
+    for(i = 0; i < num_samples; i++){
+        idx = ph >> fb0;
+        frac = (INT32S)((ph >> (fb0 - 16u)) & 0xFFFFu);
+        a = t0[idx];
+        y0 = a + ((((t0[(idx + 1u) & m0] - a) * frac) + 0x8000) >> 16);
+        idx = ph >> fb1;
+        frac = (INT32S)((ph >> (fb1 - 16u)) & 0xFFFFu);
+        a = t1[idx];
+        y1 = a + ((((t1[(idx + 1u) & m1] - a) * frac) + 0x8000) >> 16);
+        out[i] = (INT16S)(y0 + (((y1 - y0) * (INT32S)mix) >> 16));
+        mix += dmix;
+        ph += step;
+    }
+    gen->phase = ph;
+}
+/****************************************************************************
+ * waveGenTonesRender() - Private
+ ****************************************************************************/
+static void waveGenTonesRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    WaveToneRender(gen->tones, gen->phase, gen->step, out, num_samples);
+    gen->phase += gen->step * num_samples;
+}
+/****************************************************************************
+ * waveGenNoiseRender() - Private
+ ****************************************************************************/
+static void waveGenNoiseRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    WaveNoiseWhite(gen->noise, out, num_samples);
+}
+/****************************************************************************
+ * waveGenPinkRender() - Private
+ ****************************************************************************/
+static void waveGenPinkRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    WaveNoisePink(gen->noise, out, num_samples);
+}
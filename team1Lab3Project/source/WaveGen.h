@@ -0,0 +1,53 @@
+/****************************************************************************
+ * WaveGen.h
+ * Header file for WaveGen.c
+ * Block waveform generators behind one render interface.
+ ****************************************************************************/
+#ifndef WAVEGEN_H_
+#define WAVEGEN_H_
+
+typedef enum {WAVE_SHAPE_SINE, WAVE_SHAPE_TRIANGLE, WAVE_SHAPE_SAWTOOTH, WAVE_SHAPE_USER,
+              WAVE_SHAPE_TONES, WAVE_SHAPE_NOISE, WAVE_SHAPE_PINK, WAVE_SHAPE_SQUARE,
+              WAVE_SHAPE_COUNT} WAVE_SHAPE;
+
+/* Fewest tones for which the tones shape renders faster upsampled */
+#define WAVE_GEN_UP_TONES   6u
+
+/* User wavetable holds one period in 2^WAVE_USER_BITS Q15 entries */
+#define WAVE_USER_BITS  8
+#define WAVE_USER_SIZE  (1u << WAVE_USER_BITS)
+
+typedef struct WAVE_GEN_S WAVE_GEN;
+
+typedef struct {
+    void (*init)(WAVE_GEN *gen);
+    void (*render)(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+} WAVE_GEN_OPS;
+
+/* Per-generator state. phase and step follow WaveDDS.c, 2^32 per period. */
+struct WAVE_GEN_S {
+    const WAVE_GEN_OPS *ops;
+    INT32U phase;
+    INT32U step;
+    const struct WAVE_MIPMAP_S *mip;    /* octave tables of the table shapes  */
+    INT8U level;                        /* octave last played, WAVE_MIP_LEVELS for none */
+    struct WAVE_MIP_USER_S *user;       /* WAVE_SHAPE_USER only, see WaveMip.h */
+    struct WAVE_TONES_S *tones;         /* WAVE_SHAPE_TONES only, see WaveTone.h */
+    struct WAVE_NOISE_S *noise;         /* WAVE_SHAPE_NOISE/PINK only, see WaveNoise.h */
+};
+
+extern const WAVE_GEN_OPS WaveGenSine;
+extern const WAVE_GEN_OPS WaveGenTriangle;
+extern const WAVE_GEN_OPS WaveGenSawtooth;
+extern const WAVE_GEN_OPS WaveGenSquare;
+extern const WAVE_GEN_OPS WaveGenUser;
+extern const WAVE_GEN_OPS WaveGenTones;
+extern const WAVE_GEN_OPS WaveGenNoise;
+extern const WAVE_GEN_OPS WaveGenPink;
+
+void WaveGenInit(WAVE_GEN *gen, WAVE_SHAPE shape);
+void WaveGenRender(WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+INT8U WaveGenIsPeriodic(const WAVE_GEN *gen);
+INT8U WaveGenUpsampleWins(const WAVE_GEN *gen, INT32U max_step);
+
+#endif /* WAVEGEN_H_ */
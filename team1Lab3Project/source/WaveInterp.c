@@ -0,0 +1,96 @@
+/****************************************************************************
+ * WaveInterp.c
+ * Interpolating upsampler. A generator renders at 1/WAVE_INTERP_L of the
+ * DAC rate and this raises it to the DAC rate with a WAVE_INTERP_L phase
+ * polyphase FIR from InterpTable.c, WAVE_INTERP_TAPS multiplies per output.
+ * WaveInterpBlock() uses SMLAD for two taps per multiply, one 32-bit load
+ * of adjacent input samples per pair. WaveInterpBlockRef() is the portable
+ * C version and produces identical output. Without the DSP extension
+ * WaveInterpBlock() falls back to the reference.
+ ****************************************************************************/
+#include <string.h>
+#include "MCUType.h"
+#include "WaveInterp.h"
+
+#define WAVE_INTERP_ROUND   0x4000
+
+static void waveInterpShift(INT16S *in, INT32U num_in);
+
+/****************************************************************************
+ * WaveInterpReset() - Public
+ * Clears the history so the next block starts from silence.
+ ****************************************************************************/
+void WaveInterpReset(INT16S *in){
+    INT32U i;
+    for(i = 0; i < WAVE_INTERP_HIST; i++){
+        in[i] = 0;
+    }
+}
+/****************************************************************************
+ * waveInterpShift() - Private
+ * Keeps the last WAVE_INTERP_HIST inputs as history for the next block.
+ ****************************************************************************/
+static void waveInterpShift(INT16S *in, INT32U num_in){
+    memmove(&in[0], &in[num_in], WAVE_INTERP_HIST * sizeof(in[0]));
+}
+/****************************************************************************
+ * WaveInterpBlockRef() - Public
+ * Portable reference, one tap at a time.
+ ****************************************************************************/
+void WaveInterpBlockRef(INT16S *in, INT32U num_in, INT16S *out){
+    INT32S acc;
+    INT32U k;
+    INT32U p;
+    INT32U m;
+
+    for(k = 0; k < num_in; k++){
+        for(p = 0; p < WAVE_INTERP_L; p++){
+            acc = WAVE_INTERP_ROUND;
+            for(m = 0; m < WAVE_INTERP_TAPS; m++){
+                acc += (INT32S)WaveInterpTable[p][m] * in[k + m];
+            }
+            acc >>= 15;
+            if(acc > 32767){
+                acc = 32767;
+            }else if(acc < -32768){
+                acc = -32768;
+            }else{
+            }
+            *out++ = (INT16S)acc;
+        }
+    }
+    waveInterpShift(in, num_in);
+}
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+/****************************************************************************
+ * WaveInterpBlock() - Public
+ * Packed kernel. The input pairs are loaded once per rendered sample and
+ * reused by every phase.
+ ****************************************************************************/
+void WaveInterpBlock(INT16S *in, INT32U num_in, INT16S *out){
+    INT32U x[WAVE_INTERP_TAPS / 2];
+    INT32U h[WAVE_INTERP_TAPS / 2];
+    INT32U acc;
+    INT32U k;
+    INT32U p;
+    INT32U m;
+
+    for(k = 0; k < num_in; k++){
+        memcpy(&x[0], &in[k], sizeof(x));
+        for(p = 0; p < WAVE_INTERP_L; p++){
+            memcpy(&h[0], &WaveInterpTable[p][0], sizeof(h));
+            acc = WAVE_INTERP_ROUND;
+            for(m = 0; m < (WAVE_INTERP_TAPS / 2); m++){
+                acc = __SMLAD(x[m], h[m], acc);
+            }
+            *out++ = (INT16S)__SSAT((INT32S)acc >> 15, 16);
+        }
+    }
+    waveInterpShift(in, num_in);
+}
+#else
+void WaveInterpBlock(INT16S *in, INT32U num_in, INT16S *out){
+    WaveInterpBlockRef(in, num_in, out);
+}
+#endif
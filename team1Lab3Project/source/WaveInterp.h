@@ -0,0 +1,27 @@
+/****************************************************************************
+ * WaveInterp.h
+ * Header file for WaveInterp.c
+ * Polyphase FIR upsampler from the render rate to the DAC rate.
+ ****************************************************************************/
+#ifndef WAVEINTERP_H_
+#define WAVEINTERP_H_
+
+/* InterpTable.c must be regenerated with tools/GenInterpTable.py if changed */
+#define WAVE_INTERP_L       4u      /* DAC samples per rendered sample      */
+#define WAVE_INTERP_TAPS    8u      /* taps per phase, even                 */
+#define WAVE_INTERP_HIST    (WAVE_INTERP_TAPS - 1u) /* history ahead of the input */
+/* Highest DAC-rate phase step worth upsampling, 0.2 of the render rate.
+ * Above it the tone leaves the FIR passband.                              */
+#define WAVE_INTERP_MAX_STEP    (0x33333333u / WAVE_INTERP_L)
+
+extern const INT16S WaveInterpTable[WAVE_INTERP_L][WAVE_INTERP_TAPS];
+
+/* in[] holds WAVE_INTERP_HIST samples of history followed by num_in new
+ * render-rate samples, out[] gets num_in*WAVE_INTERP_L DAC-rate samples.
+ * The last WAVE_INTERP_HIST inputs are moved to the front for the next
+ * block.                                                                   */
+void WaveInterpReset(INT16S *in);
+void WaveInterpBlock(INT16S *in, INT32U num_in, INT16S *out);
+void WaveInterpBlockRef(INT16S *in, INT32U num_in, INT16S *out);
+
+#endif /* WAVEINTERP_H_ */
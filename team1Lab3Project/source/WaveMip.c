@@ -0,0 +1,107 @@
+/****************************************************************************
+ * WaveMip.c
+ * Band-limited octave tables for the sawtooth, square, triangle and user
+ * generators. The fixed shapes come from WaveMipTables.c, generated by
+ * tools/GenWaveMip.py. A user table is split into octaves here, once per
+ * new table, with a 256 point DFT in float and resynthesis of each level
+ * from its harmonics.
+ * WaveMipSelect() picks the level for a phase step, the renderers in
+ * WaveGen.c call it once per block.
+ * WaveMipBuildUser() keeps its work in static buffers, so only one task
+ * may call it.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+
+#if ((WAVE_MIP_TOP_HARM >> WAVE_MIP_USER_FIRST) >= (WAVE_USER_SIZE / 2u)) || \
+    ((WAVE_MIP_TOP_HARM >> (WAVE_MIP_USER_FIRST - 1u)) < (WAVE_USER_SIZE / 2u))
+#error "WAVE_MIP_USER_FIRST must be the first level below WAVE_USER_SIZE/2 harmonics"
+#endif
+
+#define WAVE_MIP_USER_HARM  (WAVE_MIP_TOP_HARM >> WAVE_MIP_USER_FIRST)
+
+static FP32 waveMipCos[WAVE_USER_SIZE];         /* cos(2*pi*k/WAVE_USER_SIZE), filled once */
+static FP32 waveMipRe[WAVE_MIP_USER_HARM + 1u]; /* cosine part of each harmonic            */
+static FP32 waveMipIm[WAVE_MIP_USER_HARM + 1u]; /* sine part of each harmonic              */
+static INT8U waveMipCosReady = FALSE;
+
+/****************************************************************************
+ * WaveMipSelect() - Public
+ * Returns the richest level whose top harmonic stays below half the sample
+ * rate at step, the last level if none does.
+ ****************************************************************************/
+INT8U WaveMipSelect(INT32U step){
+    INT8U level = 0;
+    while((level < (WAVE_MIP_LEVELS - 1u)) &&
+          (((INT64U)(WAVE_MIP_TOP_HARM >> level) * step) >= 0x80000000u)){
+        level++;
+    }
+    return level;
+}
+/****************************************************************************
+ * WaveMipBuildUser() - Public
+ * Copies table into user and fills its octave levels. Levels before
+ * WAVE_MIP_USER_FIRST play the copy. A level that comes out above full
+ * scale, the Gibbs overshoot of a table with edges, is clipped.
+ ****************************************************************************/
+void WaveMipBuildUser(WAVE_MIP_USER *user, const INT16S *table){
+    FP32 re;
+    FP32 im;
+    FP32 y;
+    INT32U harm;
+    INT32U h;
+    INT32U n;
+    INT32U k;
+    INT8U level;
+
+    if(waveMipCosReady == FALSE){
+        for(n = 0; n < WAVE_USER_SIZE; n++){
+            waveMipCos[n] = cosf((6.28318531f * (FP32)n) / (FP32)WAVE_USER_SIZE);
+        }
+        waveMipCosReady = TRUE;
+    }else{
+    }
+    for(n = 0; n < WAVE_USER_SIZE; n++){
+        user->base[n] = table[n];
+    }
+    for(h = 0; h <= WAVE_MIP_USER_HARM; h++){
+        re = 0.0f;
+        im = 0.0f;
+        k = 0;
+        for(n = 0; n < WAVE_USER_SIZE; n++){
+            re += (FP32)table[n] * waveMipCos[k];
+            im += (FP32)table[n] * waveMipCos[(k - (WAVE_USER_SIZE / 4u)) & (WAVE_USER_SIZE - 1u)];
+            k = (k + h) & (WAVE_USER_SIZE - 1u);
+        }
+        waveMipRe[h] = (re * 2.0f) / (FP32)WAVE_USER_SIZE;
+        waveMipIm[h] = (im * 2.0f) / (FP32)WAVE_USER_SIZE;
+    }
+    waveMipRe[0] /= 2.0f;
+    for(level = 0; level < WAVE_MIP_LEVELS; level++){
+        user->map.bits[level] = WAVE_USER_BITS;
+        if(level < WAVE_MIP_USER_FIRST){
+            user->map.table[level] = &user->base[0];
+        }else{
+            harm = WAVE_MIP_TOP_HARM >> level;
+            for(n = 0; n < WAVE_USER_SIZE; n++){
+                y = waveMipRe[0];
+                k = n;
+                for(h = 1; h <= harm; h++){
+                    y += (waveMipRe[h] * waveMipCos[k]) +
+                         (waveMipIm[h] * waveMipCos[(k - (WAVE_USER_SIZE / 4u)) & (WAVE_USER_SIZE - 1u)]);
+                    k = (k + n) & (WAVE_USER_SIZE - 1u);
+                }
+                if(y > 32767.0f){
+                    y = 32767.0f;
+                }else if(y < -32768.0f){
+                    y = -32768.0f;
+                }else{
+                }
+                user->band[level - WAVE_MIP_USER_FIRST][n] = (INT16S)lroundf(y);
+            }
+            user->map.table[level] = &user->band[level - WAVE_MIP_USER_FIRST][0];
+        }
+    }
+}
@@ -0,0 +1,39 @@
+/****************************************************************************
+ * WaveMip.h
+ * Header file for WaveMip.c
+ * Band-limited octave tables (mipmaps) for the table-driven generators.
+ ****************************************************************************/
+#ifndef WAVEMIP_H_
+#define WAVEMIP_H_
+
+/* Level j holds harmonics 1..WAVE_MIP_TOP_HARM>>j. WaveMipTables.c must be
+ * regenerated with tools/GenWaveMip.py if changed.                         */
+#define WAVE_MIP_LEVELS     9u
+#define WAVE_MIP_TOP_HARM   256u
+/* A WAVE_USER_SIZE user table holds up to WAVE_USER_SIZE/2 harmonics, its
+ * levels from here on are filtered, the ones before play the table as is. */
+#define WAVE_MIP_USER_FIRST 2u
+
+/* One period per level in 2^bits entries, level 0 the richest */
+struct WAVE_MIPMAP_S {
+    const INT16S *table[WAVE_MIP_LEVELS];
+    INT8U bits[WAVE_MIP_LEVELS];
+};
+typedef struct WAVE_MIPMAP_S WAVE_MIPMAP;
+
+/* Octave tables of a WAVE_SHAPE_USER table, built at run time */
+struct WAVE_MIP_USER_S {
+    WAVE_MIPMAP map;
+    INT16S base[WAVE_USER_SIZE];
+    INT16S band[WAVE_MIP_LEVELS - WAVE_MIP_USER_FIRST][WAVE_USER_SIZE];
+};
+typedef struct WAVE_MIP_USER_S WAVE_MIP_USER;
+
+extern const WAVE_MIPMAP WaveMipSawtooth;
+extern const WAVE_MIPMAP WaveMipSquare;
+extern const WAVE_MIPMAP WaveMipTriangle;
+
+INT8U WaveMipSelect(INT32U step);
+void WaveMipBuildUser(WAVE_MIP_USER *user, const INT16S *table);
+
+#endif /* WAVEMIP_H_ */
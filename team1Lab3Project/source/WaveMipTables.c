@@ -0,0 +1,2069 @@
+/****************************************************************************
+ * WaveMipTables.c
+ * Band-limited octave tables, Q15, for the WaveGen.c sawtooth, square and
+ * triangle generators. See WaveMip.h.
+ * GENERATED FILE - do not edit. Regenerate with:
+ *     python3 tools/GenWaveMip.py 9 256 > source/WaveMipTables.c
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+
+#if (WAVE_MIP_LEVELS != 9) || (WAVE_MIP_TOP_HARM != 256)
+#error "WaveMipTables.c does not match WaveMip.h, regenerate it"
+#endif
+
+/* Sawtooth, harmonics 1..256 */
+static const INT16S waveMipSawtooth0[2048] = {
+         0,      3,     20,     57,    109,    161,    198,    215,
+       217,    220,    238,    275,    327,    379,    416,    432,
+       435,    438,    456,    494,    546,    597,    634,    650,
+       652,    655,    673,    712,    764,    815,    852,    867,
+       870,    873,    891,    930,    982,   1033,   1069,   1085,
+      1087,   1090,   1109,   1148,   1201,   1252,   1287,   1303,
+      1305,   1308,   1327,   1366,   1419,   1470,   1505,   1520,
+      1522,   1526,   1545,   1584,   1637,   1688,   1723,   1738,
+      1739,   1743,   1763,   1803,   1855,   1906,   1941,   1955,
+      1957,   1961,   1981,   2021,   2074,   2124,   2159,   2173,
+      2174,   2178,   2198,   2239,   2292,   2342,   2377,   2390,
+      2392,   2396,   2416,   2457,   2510,   2561,   2594,   2608,
+      2609,   2613,   2634,   2675,   2729,   2779,   2812,   2825,
+      2827,   2831,   2852,   2893,   2947,   2997,   3030,   3043,
+      3044,   3048,   3070,   3112,   3165,   3215,   3248,   3260,
+      3261,   3266,   3288,   3330,   3383,   3433,   3466,   3478,
+      3479,   3483,   3506,   3548,   3602,   3651,   3684,   3696,
+      3696,   3701,   3723,   3766,   3820,   3870,   3901,   3913,
+      3914,   3919,   3941,   3984,   4038,   4088,   4119,   4131,
+      4131,   4136,   4159,   4202,   4257,   4306,   4337,   4348,
+      4348,   4354,   4377,   4421,   4475,   4524,   4555,   4566,
+      4566,   4571,   4595,   4639,   4693,   4742,   4773,   4783,
+      4783,   4789,   4813,   4857,   4912,   4960,   4991,   5001,
+      5001,   5006,   5030,   5075,   5130,   5179,   5209,   5218,
+      5218,   5224,   5248,   5293,   5348,   5397,   5426,   5436,
+      5435,   5441,   5466,   5511,   5566,   5615,   5644,   5653,
+      5653,   5659,   5684,   5730,   5785,   5833,   5862,   5871,
+      5870,   5876,   5902,   5948,   6003,   6051,   6080,   6088,
+      6087,   6094,   6120,   6166,   6221,   6269,   6298,   6306,
+      6305,   6311,   6338,   6384,   6440,   6488,   6516,   6523,
+      6522,   6529,   6555,   6602,   6658,   6706,   6734,   6741,
+      6740,   6746,   6773,   6821,   6876,   6924,   6951,   6958,
+      6957,   6964,   6991,   7039,   7095,   7142,   7169,   7176,
+      7174,   7181,   7209,   7257,   7313,   7360,   7387,   7393,
+      7392,   7399,   7427,   7475,   7532,   7579,   7605,   7611,
+      7609,   7616,   7645,   7693,   7750,   7797,   7823,   7828,
+      7826,   7834,   7863,   7912,   7968,   8015,   8041,   8046,
+      8044,   8051,   8080,   8130,   8187,   8233,   8259,   8263,
+      8261,   8269,   8298,   8348,   8405,   8452,   8476,   8481,
+      8478,   8486,   8516,   8566,   8623,   8670,   8694,   8698,
+      8696,   8704,   8734,   8785,   8842,   8888,   8912,   8916,
+      8913,   8921,   8952,   9003,   9060,   9106,   9130,   9133,
+      9130,   9139,   9170,   9221,   9279,   9325,   9348,   9351,
+      9347,   9356,   9388,   9439,   9497,   9543,   9566,   9568,
+      9565,   9574,   9605,   9658,   9716,   9761,   9783,   9786,
+      9782,   9791,   9823,   9876,   9934,   9979,  10001,  10003,
+      9999,  10008,  10041,  10094,  10152,  10198,  10219,  10220,
+     10217,  10226,  10259,  10312,  10371,  10416,  10437,  10438,
+     10434,  10443,  10477,  10531,  10589,  10634,  10655,  10655,
+     10651,  10661,  10695,  10749,  10808,  10852,  10873,  10873,
+     10868,  10878,  10913,  10967,  11026,  11071,  11091,  11090,
+     11085,  11095,  11130,  11186,  11245,  11289,  11308,  11307,
+     11303,  11313,  11348,  11404,  11463,  11507,  11526,  11525,
+     11520,  11530,  11566,  11622,  11682,  11726,  11744,  11742,
+     11737,  11748,  11784,  11841,  11900,  11944,  11962,  11960,
+     11954,  11965,  12002,  12059,  12119,  12162,  12180,  12177,
+     12171,  12182,  12220,  12277,  12337,  12381,  12398,  12394,
+     12388,  12400,  12438,  12496,  12556,  12599,  12616,  12612,
+     12606,  12617,  12655,  12714,  12775,  12818,  12833,  12829,
+     12823,  12834,  12873,  12932,  12993,  13036,  13051,  13046,
+     13040,  13052,  13091,  13151,  13212,  13254,  13269,  13263,
+     13257,  13269,  13309,  13369,  13431,  13473,  13487,  13481,
+     13474,  13486,  13527,  13588,  13649,  13691,  13705,  13698,
+     13691,  13704,  13745,  13806,  13868,  13910,  13923,  13915,
+     13908,  13921,  13962,  14025,  14087,  14128,  14140,  14133,
+     14125,  14138,  14180,  14243,  14305,  14347,  14358,  14350,
+     14342,  14355,  14398,  14462,  14524,  14565,  14576,  14567,
+     14559,  14572,  14616,  14680,  14743,  14783,  14794,  14784,
+     14776,  14790,  14834,  14899,  14962,  15002,  15012,  15001,
+     14993,  15007,  15052,  15117,  15180,  15221,  15230,  15219,
+     15209,  15224,  15270,  15336,  15399,  15439,  15448,  15436,
+     15426,  15441,  15487,  15554,  15618,  15658,  15665,  15653,
+     15643,  15658,  15705,  15773,  15837,  15876,  15883,  15870,
+     15860,  15875,  15923,  15991,  16056,  16095,  16101,  16087,
+     16077,  16092,  16141,  16210,  16275,  16314,  16319,  16304,
+     16293,  16309,  16359,  16429,  16494,  16532,  16537,  16521,
+     16510,  16526,  16577,  16647,  16713,  16751,  16755,  16738,
+     16727,  16743,  16795,  16866,  16932,  16970,  16973,  16955,
+     16943,  16960,  17012,  17085,  17151,  17188,  17190,  17172,
+     17160,  17177,  17230,  17304,  17370,  17407,  17408,  17389,
+     17376,  17394,  17448,  17523,  17590,  17626,  17626,  17606,
+     17593,  17611,  17666,  17741,  17809,  17845,  17844,  17822,
+     17809,  17828,  17884,  17960,  18028,  18064,  18062,  18039,
+     18025,  18045,  18102,  18179,  18248,  18283,  18280,  18256,
+     18242,  18261,  18320,  18398,  18467,  18502,  18497,  18473,
+     18458,  18478,  18538,  18617,  18687,  18721,  18715,  18689,
+     18674,  18695,  18755,  18836,  18906,  18940,  18933,  18906,
+     18890,  18911,  18973,  19056,  19126,  19159,  19151,  19122,
+     19106,  19128,  19191,  19275,  19346,  19378,  19369,  19339,
+     19322,  19344,  19409,  19494,  19566,  19597,  19587,  19555,
+     19538,  19561,  19627,  19713,  19786,  19817,  19804,  19772,
+     19754,  19777,  19845,  19933,  20006,  20036,  20022,  19988,
+     19969,  19993,  20063,  20152,  20226,  20256,  20240,  20204,
+     20185,  20210,  20280,  20372,  20446,  20475,  20458,  20420,
+     20400,  20426,  20498,  20592,  20667,  20695,  20676,  20636,
+     20615,  20642,  20716,  20811,  20887,  20915,  20894,  20852,
+     20830,  20857,  20934,  21031,  21108,  21135,  21111,  21068,
+     21045,  21073,  21152,  21251,  21329,  21355,  21329,  21283,
+     21260,  21289,  21370,  21472,  21550,  21575,  21547,  21499,
+     21474,  21504,  21588,  21692,  21771,  21795,  21765,  21714,
+     21688,  21720,  21806,  21912,  21993,  22016,  21983,  21929,
+     21902,  21935,  22024,  22133,  22215,  22236,  22200,  22144,
+     22116,  22150,  22241,  22354,  22437,  22457,  22418,  22359,
+     22329,  22364,  22459,  22575,  22660,  22678,  22636,  22573,
+     22542,  22579,  22677,  22797,  22882,  22900,  22854,  22787,
+     22755,  22793,  22895,  23018,  23106,  23122,  23072,  23001,
+     22967,  23007,  23113,  23240,  23330,  23344,  23289,  23214,
+     23179,  23220,  23331,  23463,  23554,  23566,  23507,  23427,
+     23390,  23433,  23549,  23686,  23779,  23789,  23725,  23640,
+     23600,  23646,  23767,  23909,  24005,  24013,  23943,  23852,
+     23809,  23858,  23985,  24134,  24232,  24237,  24160,  24063,
+     24018,  24069,  24203,  24358,  24459,  24461,  24378,  24273,
+     24225,  24279,  24421,  24584,  24688,  24687,  24596,  24483,
+     24431,  24489,  24639,  24811,  24919,  24914,  24813,  24691,
+     24635,  24697,  24857,  25039,  25151,  25142,  25031,  24898,
+     24838,  24904,  25076,  25269,  25386,  25372,  25248,  25103,
+     25037,  25109,  25294,  25501,  25624,  25604,  25465,  25305,
+     25234,  25312,  25512,  25736,  25865,  25838,  25683,  25505,
+     25426,  25511,  25731,  25974,  26111,  26076,  25899,  25700,
+     25612,  25707,  25950,  26217,  26364,  26318,  26116,  25890,
+     25791,  25897,  26170,  26466,  26627,  26567,  26332,  26072,
+     25958,  26080,  26390,  26725,  26902,  26825,  26547,  26242,
+     26109,  26251,  26611,  26999,  27199,  27098,  26760,  26393,
+     26233,  26403,  26835,  27298,  27530,  27395,  26969,  26510,
+     26310,  26524,  27065,  27644,  27926,  27736,  27170,  26561,
+     26295,  26582,  27310,  28089,  28462,  28171,  27343,  26448,
+     26054,  26488,  27610,  28829,  29404,  28872,  27382,  25720,
+     24958,  25863,  28354,  31291,  32767,  30827,  24314,  13471,
+         0, -13471, -24314, -30827, -32767, -31291, -28354, -25863,
+    -24958, -25720, -27382, -28872, -29404, -28829, -27610, -26488,
+    -26054, -26448, -27343, -28171, -28462, -28089, -27310, -26582,
+    -26295, -26561, -27170, -27736, -27926, -27644, -27065, -26524,
+    -26310, -26510, -26969, -27395, -27530, -27298, -26835, -26403,
+    -26233, -26393, -26760, -27098, -27199, -26999, -26611, -26251,
+    -26109, -26242, -26547, -26825, -26902, -26725, -26390, -26080,
+    -25958, -26072, -26332, -26567, -26627, -26466, -26170, -25897,
+    -25791, -25890, -26116, -26318, -26364, -26217, -25950, -25707,
+    -25612, -25700, -25899, -26076, -26111, -25974, -25731, -25511,
+    -25426, -25505, -25683, -25838, -25865, -25736, -25512, -25312,
+    -25234, -25305, -25465, -25604, -25624, -25501, -25294, -25109,
+    -25037, -25103, -25248, -25372, -25386, -25269, -25076, -24904,
+    -24838, -24898, -25031, -25142, -25151, -25039, -24857, -24697,
+    -24635, -24691, -24813, -24914, -24919, -24811, -24639, -24489,
+    -24431, -24483, -24596, -24687, -24688, -24584, -24421, -24279,
+    -24225, -24273, -24378, -24461, -24459, -24358, -24203, -24069,
+    -24018, -24063, -24160, -24237, -24232, -24134, -23985, -23858,
+    -23809, -23852, -23943, -24013, -24005, -23909, -23767, -23646,
+    -23600, -23640, -23725, -23789, -23779, -23686, -23549, -23433,
+    -23390, -23427, -23507, -23566, -23554, -23463, -23331, -23220,
+    -23179, -23214, -23289, -23344, -23330, -23240, -23113, -23007,
+    -22967, -23001, -23072, -23122, -23106, -23018, -22895, -22793,
+    -22755, -22787, -22854, -22900, -22882, -22797, -22677, -22579,
+    -22542, -22573, -22636, -22678, -22660, -22575, -22459, -22364,
+    -22329, -22359, -22418, -22457, -22437, -22354, -22241, -22150,
+    -22116, -22144, -22200, -22236, -22215, -22133, -22024, -21935,
+    -21902, -21929, -21983, -22016, -21993, -21912, -21806, -21720,
+    -21688, -21714, -21765, -21795, -21771, -21692, -21588, -21504,
+    -21474, -21499, -21547, -21575, -21550, -21472, -21370, -21289,
+    -21260, -21283, -21329, -21355, -21329, -21251, -21152, -21073,
+    -21045, -21068, -21111, -21135, -21108, -21031, -20934, -20857,
+    -20830, -20852, -20894, -20915, -20887, -20811, -20716, -20642,
+    -20615, -20636, -20676, -20695, -20667, -20592, -20498, -20426,
+    -20400, -20420, -20458, -20475, -20446, -20372, -20280, -20210,
+    -20185, -20204, -20240, -20256, -20226, -20152, -20063, -19993,
+    -19969, -19988, -20022, -20036, -20006, -19933, -19845, -19777,
+    -19754, -19772, -19804, -19817, -19786, -19713, -19627, -19561,
+    -19538, -19555, -19587, -19597, -19566, -19494, -19409, -19344,
+    -19322, -19339, -19369, -19378, -19346, -19275, -19191, -19128,
+    -19106, -19122, -19151, -19159, -19126, -19056, -18973, -18911,
+    -18890, -18906, -18933, -18940, -18906, -18836, -18755, -18695,
+    -18674, -18689, -18715, -18721, -18687, -18617, -18538, -18478,
+    -18458, -18473, -18497, -18502, -18467, -18398, -18320, -18261,
+    -18242, -18256, -18280, -18283, -18248, -18179, -18102, -18045,
+    -18025, -18039, -18062, -18064, -18028, -17960, -17884, -17828,
+    -17809, -17822, -17844, -17845, -17809, -17741, -17666, -17611,
+    -17593, -17606, -17626, -17626, -17590, -17523, -17448, -17394,
+    -17376, -17389, -17408, -17407, -17370, -17304, -17230, -17177,
+    -17160, -17172, -17190, -17188, -17151, -17085, -17012, -16960,
+    -16943, -16955, -16973, -16970, -16932, -16866, -16795, -16743,
+    -16727, -16738, -16755, -16751, -16713, -16647, -16577, -16526,
+    -16510, -16521, -16537, -16532, -16494, -16429, -16359, -16309,
+    -16293, -16304, -16319, -16314, -16275, -16210, -16141, -16092,
+    -16077, -16087, -16101, -16095, -16056, -15991, -15923, -15875,
+    -15860, -15870, -15883, -15876, -15837, -15773, -15705, -15658,
+    -15643, -15653, -15665, -15658, -15618, -15554, -15487, -15441,
+    -15426, -15436, -15448, -15439, -15399, -15336, -15270, -15224,
+    -15209, -15219, -15230, -15221, -15180, -15117, -15052, -15007,
+    -14993, -15001, -15012, -15002, -14962, -14899, -14834, -14790,
+    -14776, -14784, -14794, -14783, -14743, -14680, -14616, -14572,
+    -14559, -14567, -14576, -14565, -14524, -14462, -14398, -14355,
+    -14342, -14350, -14358, -14347, -14305, -14243, -14180, -14138,
+    -14125, -14133, -14140, -14128, -14087, -14025, -13962, -13921,
+    -13908, -13915, -13923, -13910, -13868, -13806, -13745, -13704,
+    -13691, -13698, -13705, -13691, -13649, -13588, -13527, -13486,
+    -13474, -13481, -13487, -13473, -13431, -13369, -13309, -13269,
+    -13257, -13263, -13269, -13254, -13212, -13151, -13091, -13052,
+    -13040, -13046, -13051, -13036, -12993, -12932, -12873, -12834,
+    -12823, -12829, -12833, -12818, -12775, -12714, -12655, -12617,
+    -12606, -12612, -12616, -12599, -12556, -12496, -12438, -12400,
+    -12388, -12394, -12398, -12381, -12337, -12277, -12220, -12182,
+    -12171, -12177, -12180, -12162, -12119, -12059, -12002, -11965,
+    -11954, -11960, -11962, -11944, -11900, -11841, -11784, -11748,
+    -11737, -11742, -11744, -11726, -11682, -11622, -11566, -11530,
+    -11520, -11525, -11526, -11507, -11463, -11404, -11348, -11313,
+    -11303, -11307, -11308, -11289, -11245, -11186, -11130, -11095,
+    -11085, -11090, -11091, -11071, -11026, -10967, -10913, -10878,
+    -10868, -10873, -10873, -10852, -10808, -10749, -10695, -10661,
+    -10651, -10655, -10655, -10634, -10589, -10531, -10477, -10443,
+    -10434, -10438, -10437, -10416, -10371, -10312, -10259, -10226,
+    -10217, -10220, -10219, -10198, -10152, -10094, -10041, -10008,
+     -9999, -10003, -10001,  -9979,  -9934,  -9876,  -9823,  -9791,
+     -9782,  -9786,  -9783,  -9761,  -9716,  -9658,  -9605,  -9574,
+     -9565,  -9568,  -9566,  -9543,  -9497,  -9439,  -9388,  -9356,
+     -9347,  -9351,  -9348,  -9325,  -9279,  -9221,  -9170,  -9139,
+     -9130,  -9133,  -9130,  -9106,  -9060,  -9003,  -8952,  -8921,
+     -8913,  -8916,  -8912,  -8888,  -8842,  -8785,  -8734,  -8704,
+     -8696,  -8698,  -8694,  -8670,  -8623,  -8566,  -8516,  -8486,
+     -8478,  -8481,  -8476,  -8452,  -8405,  -8348,  -8298,  -8269,
+     -8261,  -8263,  -8259,  -8233,  -8187,  -8130,  -8080,  -8051,
+     -8044,  -8046,  -8041,  -8015,  -7968,  -7912,  -7863,  -7834,
+     -7826,  -7828,  -7823,  -7797,  -7750,  -7693,  -7645,  -7616,
+     -7609,  -7611,  -7605,  -7579,  -7532,  -7475,  -7427,  -7399,
+     -7392,  -7393,  -7387,  -7360,  -7313,  -7257,  -7209,  -7181,
+     -7174,  -7176,  -7169,  -7142,  -7095,  -7039,  -6991,  -6964,
+     -6957,  -6958,  -6951,  -6924,  -6876,  -6821,  -6773,  -6746,
+     -6740,  -6741,  -6734,  -6706,  -6658,  -6602,  -6555,  -6529,
+     -6522,  -6523,  -6516,  -6488,  -6440,  -6384,  -6338,  -6311,
+     -6305,  -6306,  -6298,  -6269,  -6221,  -6166,  -6120,  -6094,
+     -6087,  -6088,  -6080,  -6051,  -6003,  -5948,  -5902,  -5876,
+     -5870,  -5871,  -5862,  -5833,  -5785,  -5730,  -5684,  -5659,
+     -5653,  -5653,  -5644,  -5615,  -5566,  -5511,  -5466,  -5441,
+     -5435,  -5436,  -5426,  -5397,  -5348,  -5293,  -5248,  -5224,
+     -5218,  -5218,  -5209,  -5179,  -5130,  -5075,  -5030,  -5006,
+     -5001,  -5001,  -4991,  -4960,  -4912,  -4857,  -4813,  -4789,
+     -4783,  -4783,  -4773,  -4742,  -4693,  -4639,  -4595,  -4571,
+     -4566,  -4566,  -4555,  -4524,  -4475,  -4421,  -4377,  -4354,
+     -4348,  -4348,  -4337,  -4306,  -4257,  -4202,  -4159,  -4136,
+     -4131,  -4131,  -4119,  -4088,  -4038,  -3984,  -3941,  -3919,
+     -3914,  -3913,  -3901,  -3870,  -3820,  -3766,  -3723,  -3701,
+     -3696,  -3696,  -3684,  -3651,  -3602,  -3548,  -3506,  -3483,
+     -3479,  -3478,  -3466,  -3433,  -3383,  -3330,  -3288,  -3266,
+     -3261,  -3260,  -3248,  -3215,  -3165,  -3112,  -3070,  -3048,
+     -3044,  -3043,  -3030,  -2997,  -2947,  -2893,  -2852,  -2831,
+     -2827,  -2825,  -2812,  -2779,  -2729,  -2675,  -2634,  -2613,
+     -2609,  -2608,  -2594,  -2561,  -2510,  -2457,  -2416,  -2396,
+     -2392,  -2390,  -2377,  -2342,  -2292,  -2239,  -2198,  -2178,
+     -2174,  -2173,  -2159,  -2124,  -2074,  -2021,  -1981,  -1961,
+     -1957,  -1955,  -1941,  -1906,  -1855,  -1803,  -1763,  -1743,
+     -1739,  -1738,  -1723,  -1688,  -1637,  -1584,  -1545,  -1526,
+     -1522,  -1520,  -1505,  -1470,  -1419,  -1366,  -1327,  -1308,
+     -1305,  -1303,  -1287,  -1252,  -1201,  -1148,  -1109,  -1090,
+     -1087,  -1085,  -1069,  -1033,   -982,   -930,   -891,   -873,
+      -870,   -867,   -852,   -815,   -764,   -712,   -673,   -655,
+      -652,   -650,   -634,   -597,   -546,   -494,   -456,   -438,
+      -435,   -432,   -416,   -379,   -327,   -275,   -238,   -220,
+      -217,   -215,   -198,   -161,   -109,    -57,    -20,     -3
+};
+
+/* Sawtooth, harmonics 1..128 */
+static const INT16S waveMipSawtooth1[1024] = {
+         0,      5,     40,    115,    219,    322,    396,    429,
+       434,    440,    476,    552,    656,    759,    832,    864,
+       868,    874,    911,    989,   1094,   1196,   1267,   1298,
+      1302,   1309,   1347,   1426,   1531,   1633,   1703,   1733,
+      1736,   1743,   1783,   1863,   1968,   2070,   2139,   2167,
+      2170,   2178,   2218,   2300,   2406,   2506,   2574,   2601,
+      2604,   2612,   2654,   2737,   2843,   2943,   3010,   3036,
+      3038,   3047,   3090,   3173,   3281,   3380,   3446,   3470,
+      3472,   3481,   3526,   3610,   3718,   3817,   3881,   3905,
+      3906,   3916,   3961,   4047,   4156,   4254,   4317,   4339,
+      4340,   4350,   4397,   4484,   4593,   4691,   4753,   4774,
+      4774,   4785,   4833,   4921,   5031,   5128,   5189,   5208,
+      5207,   5219,   5268,   5358,   5468,   5565,   5624,   5642,
+      5641,   5653,   5704,   5795,   5906,   6002,   6060,   6077,
+      6075,   6088,   6140,   6232,   6343,   6439,   6496,   6511,
+      6509,   6522,   6575,   6670,   6781,   6876,   6931,   6945,
+      6943,   6956,   7011,   7107,   7219,   7314,   7367,   7380,
+      7376,   7391,   7447,   7544,   7657,   7751,   7803,   7814,
+      7810,   7825,   7883,   7981,   8094,   8188,   8238,   8248,
+      8243,   8259,   8318,   8418,   8532,   8625,   8674,   8682,
+      8677,   8693,   8754,   8855,   8970,   9062,   9110,   9117,
+      9111,   9128,   9190,   9293,   9408,   9500,   9546,   9551,
+      9544,   9562,   9625,   9730,   9846,   9937,   9981,   9985,
+      9977,   9996,  10061,  10168,  10284,  10374,  10417,  10419,
+     10411,  10430,  10497,  10605,  10722,  10812,  10853,  10853,
+     10844,  10864,  10933,  11042,  11161,  11249,  11288,  11286,
+     11277,  11297,  11368,  11480,  11599,  11687,  11724,  11720,
+     11710,  11731,  11804,  11918,  12037,  12125,  12160,  12154,
+     12143,  12165,  12240,  12355,  12476,  12562,  12595,  12588,
+     12576,  12599,  12676,  12793,  12915,  13000,  13031,  13021,
+     13008,  13032,  13111,  13231,  13353,  13438,  13467,  13455,
+     13441,  13466,  13547,  13669,  13792,  13876,  13902,  13888,
+     13873,  13899,  13983,  14107,  14231,  14314,  14338,  14321,
+     14305,  14332,  14418,  14545,  14671,  14752,  14774,  14754,
+     14737,  14765,  14854,  14984,  15110,  15191,  15209,  15187,
+     15169,  15198,  15290,  15422,  15550,  15629,  15645,  15620,
+     15601,  15631,  15726,  15861,  15990,  16068,  16081,  16053,
+     16032,  16064,  16161,  16300,  16430,  16507,  16516,  16485,
+     16463,  16496,  16597,  16739,  16871,  16946,  16952,  16917,
+     16894,  16928,  17033,  17178,  17311,  17385,  17388,  17349,
+     17324,  17360,  17469,  17618,  17753,  17825,  17823,  17781,
+     17754,  17792,  17904,  18058,  18194,  18265,  18259,  18212,
+     18184,  18223,  18340,  18498,  18636,  18705,  18695,  18643,
+     18613,  18654,  18776,  18939,  19079,  19146,  19130,  19074,
+     19041,  19085,  19212,  19380,  19523,  19587,  19566,  19504,
+     19469,  19515,  19648,  19822,  19967,  20028,  20001,  19933,
+     19896,  19944,  20084,  20264,  20412,  20471,  20437,  20362,
+     20322,  20373,  20519,  20707,  20858,  20914,  20872,  20790,
+     20746,  20801,  20955,  21151,  21305,  21357,  21308,  21217,
+     21170,  21228,  21391,  21596,  21754,  21802,  21743,  21642,
+     21592,  21654,  21827,  22042,  22205,  22249,  22179,  22067,
+     22011,  22078,  22263,  22490,  22658,  22697,  22614,  22489,
+     22428,  22501,  22700,  22941,  23114,  23146,  23049,  22909,
+     22842,  22921,  23136,  23393,  23573,  23599,  23484,  23326,
+     23251,  23339,  23572,  23849,  24038,  24055,  23919,  23739,
+     23655,  23752,  24009,  24310,  24509,  24516,  24353,  24147,
+     24051,  24160,  24447,  24778,  24989,  24983,  24787,  24546,
+     24436,  24560,  24885,  25255,  25484,  25459,  25220,  24934,
+     24804,  24948,  25324,  25748,  25998,  25950,  25651,  25302,
+     25145,  25318,  25766,  26265,  26548,  26465,  26078,  25637,
+     25440,  25656,  26214,  26828,  27162,  27024,  26496,  25906,
+     25643,  25932,  26676,  27492,  27916,  27677,  26888,  26011,
+     25619,  26056,  27194,  28450,  29076,  28596,  27144,  25500,
+     24740,  25648,  28156,  31130,  32658,  30770,  24294,  13468,
+         0, -13468, -24294, -30770, -32658, -31130, -28156, -25648,
+    -24740, -25500, -27144, -28596, -29076, -28450, -27194, -26056,
+    -25619, -26011, -26888, -27677, -27916, -27492, -26676, -25932,
+    -25643, -25906, -26496, -27024, -27162, -26828, -26214, -25656,
+    -25440, -25637, -26078, -26465, -26548, -26265, -25766, -25318,
+    -25145, -25302, -25651, -25950, -25998, -25748, -25324, -24948,
+    -24804, -24934, -25220, -25459, -25484, -25255, -24885, -24560,
+    -24436, -24546, -24787, -24983, -24989, -24778, -24447, -24160,
+    -24051, -24147, -24353, -24516, -24509, -24310, -24009, -23752,
+    -23655, -23739, -23919, -24055, -24038, -23849, -23572, -23339,
+    -23251, -23326, -23484, -23599, -23573, -23393, -23136, -22921,
+    -22842, -22909, -23049, -23146, -23114, -22941, -22700, -22501,
+    -22428, -22489, -22614, -22697, -22658, -22490, -22263, -22078,
+    -22011, -22067, -22179, -22249, -22205, -22042, -21827, -21654,
+    -21592, -21642, -21743, -21802, -21754, -21596, -21391, -21228,
+    -21170, -21217, -21308, -21357, -21305, -21151, -20955, -20801,
+    -20746, -20790, -20872, -20914, -20858, -20707, -20519, -20373,
+    -20322, -20362, -20437, -20471, -20412, -20264, -20084, -19944,
+    -19896, -19933, -20001, -20028, -19967, -19822, -19648, -19515,
+    -19469, -19504, -19566, -19587, -19523, -19380, -19212, -19085,
+    -19041, -19074, -19130, -19146, -19079, -18939, -18776, -18654,
+    -18613, -18643, -18695, -18705, -18636, -18498, -18340, -18223,
+    -18184, -18212, -18259, -18265, -18194, -18058, -17904, -17792,
+    -17754, -17781, -17823, -17825, -17753, -17618, -17469, -17360,
+    -17324, -17349, -17388, -17385, -17311, -17178, -17033, -16928,
+    -16894, -16917, -16952, -16946, -16871, -16739, -16597, -16496,
+    -16463, -16485, -16516, -16507, -16430, -16300, -16161, -16064,
+    -16032, -16053, -16081, -16068, -15990, -15861, -15726, -15631,
+    -15601, -15620, -15645, -15629, -15550, -15422, -15290, -15198,
+    -15169, -15187, -15209, -15191, -15110, -14984, -14854, -14765,
+    -14737, -14754, -14774, -14752, -14671, -14545, -14418, -14332,
+    -14305, -14321, -14338, -14314, -14231, -14107, -13983, -13899,
+    -13873, -13888, -13902, -13876, -13792, -13669, -13547, -13466,
+    -13441, -13455, -13467, -13438, -13353, -13231, -13111, -13032,
+    -13008, -13021, -13031, -13000, -12915, -12793, -12676, -12599,
+    -12576, -12588, -12595, -12562, -12476, -12355, -12240, -12165,
+    -12143, -12154, -12160, -12125, -12037, -11918, -11804, -11731,
+    -11710, -11720, -11724, -11687, -11599, -11480, -11368, -11297,
+    -11277, -11286, -11288, -11249, -11161, -11042, -10933, -10864,
+    -10844, -10853, -10853, -10812, -10722, -10605, -10497, -10430,
+    -10411, -10419, -10417, -10374, -10284, -10168, -10061,  -9996,
+     -9977,  -9985,  -9981,  -9937,  -9846,  -9730,  -9625,  -9562,
+     -9544,  -9551,  -9546,  -9500,  -9408,  -9293,  -9190,  -9128,
+     -9111,  -9117,  -9110,  -9062,  -8970,  -8855,  -8754,  -8693,
+     -8677,  -8682,  -8674,  -8625,  -8532,  -8418,  -8318,  -8259,
+     -8243,  -8248,  -8238,  -8188,  -8094,  -7981,  -7883,  -7825,
+     -7810,  -7814,  -7803,  -7751,  -7657,  -7544,  -7447,  -7391,
+     -7376,  -7380,  -7367,  -7314,  -7219,  -7107,  -7011,  -6956,
+     -6943,  -6945,  -6931,  -6876,  -6781,  -6670,  -6575,  -6522,
+     -6509,  -6511,  -6496,  -6439,  -6343,  -6232,  -6140,  -6088,
+     -6075,  -6077,  -6060,  -6002,  -5906,  -5795,  -5704,  -5653,
+     -5641,  -5642,  -5624,  -5565,  -5468,  -5358,  -5268,  -5219,
+     -5207,  -5208,  -5189,  -5128,  -5031,  -4921,  -4833,  -4785,
+     -4774,  -4774,  -4753,  -4691,  -4593,  -4484,  -4397,  -4350,
+     -4340,  -4339,  -4317,  -4254,  -4156,  -4047,  -3961,  -3916,
+     -3906,  -3905,  -3881,  -3817,  -3718,  -3610,  -3526,  -3481,
+     -3472,  -3470,  -3446,  -3380,  -3281,  -3173,  -3090,  -3047,
+     -3038,  -3036,  -3010,  -2943,  -2843,  -2737,  -2654,  -2612,
+     -2604,  -2601,  -2574,  -2506,  -2406,  -2300,  -2218,  -2178,
+     -2170,  -2167,  -2139,  -2070,  -1968,  -1863,  -1783,  -1743,
+     -1736,  -1733,  -1703,  -1633,  -1531,  -1426,  -1347,  -1309,
+     -1302,  -1298,  -1267,  -1196,  -1094,   -989,   -911,   -874,
+      -868,   -864,   -832,   -759,   -656,   -552,   -476,   -440,
+      -434,   -429,   -396,   -322,   -219,   -115,    -40,     -5
+};
+
+/* Sawtooth, harmonics 1..64 */
+static const INT16S waveMipSawtooth2[512] = {
+         0,     11,     80,    231,    439,    645,    791,    856,
+       865,    878,    952,   1108,   1317,   1521,   1663,   1722,
+      1729,   1744,   1823,   1984,   2196,   2397,   2534,   2589,
+      2594,   2611,   2695,   2860,   3074,   3274,   3405,   3455,
+      3458,   3477,   3566,   3737,   3952,   4150,   4277,   4321,
+      4322,   4344,   4437,   4613,   4831,   5027,   5148,   5188,
+      5186,   5210,   5309,   5490,   5710,   5903,   6019,   6054,
+      6050,   6076,   6180,   6367,   6589,   6780,   6891,   6920,
+      6914,   6942,   7052,   7244,   7468,   7657,   7762,   7785,
+      7777,   7807,   7923,   8121,   8348,   8535,   8634,   8651,
+      8640,   8673,   8795,   8999,   9228,   9412,   9505,   9516,
+      9502,   9538,   9666,   9877,  10109,  10290,  10376,  10380,
+     10364,  10403,  10538,  10755,  10990,  11168,  11248,  11245,
+     11225,  11267,  11409,  11634,  11872,  12047,  12119,  12108,
+     12086,  12130,  12281,  12513,  12755,  12927,  12990,  12971,
+     12945,  12993,  13152,  13394,  13639,  13807,  13861,  13833,
+     13804,  13856,  14024,  14275,  14524,  14688,  14732,  14695,
+     14661,  14717,  14896,  15157,  15410,  15570,  15604,  15555,
+     15516,  15577,  15767,  16040,  16299,  16453,  16475,  16413,
+     16370,  16436,  16639,  16925,  17189,  17338,  17346,  17270,
+     17221,  17293,  17511,  17812,  18083,  18225,  18217,  18125,
+     18068,  18148,  18383,  18702,  18980,  19115,  19087,  18976,
+     18912,  18999,  19255,  19595,  19882,  20008,  19958,  19824,
+     19749,  19847,  20128,  20493,  20791,  20905,  20828,  20665,
+     20579,  20689,  21001,  21398,  21709,  21809,  21697,  21499,
+     21398,  21524,  21875,  22312,  22640,  22723,  22566,  22321,
+     22200,  22347,  22750,  23241,  23593,  23651,  23432,  23124,
+     22976,  23151,  23627,  24195,  24580,  24602,  24295,  23894,
+     23704,  23924,  24511,  25196,  25631,  25598,  25149,  24597,
+     24341,  24634,  25409,  26297,  26822,  26689,  25976,  25136,
+     24751,  25192,  26362,  27691,  28420,  28044,  26669,  25060,
+     24306,  25219,  27760,  30808,  32439,  30655,  24255,  13463,
+         0, -13463, -24255, -30655, -32439, -30808, -27760, -25219,
+    -24306, -25060, -26669, -28044, -28420, -27691, -26362, -25192,
+    -24751, -25136, -25976, -26689, -26822, -26297, -25409, -24634,
+    -24341, -24597, -25149, -25598, -25631, -25196, -24511, -23924,
+    -23704, -23894, -24295, -24602, -24580, -24195, -23627, -23151,
+    -22976, -23124, -23432, -23651, -23593, -23241, -22750, -22347,
+    -22200, -22321, -22566, -22723, -22640, -22312, -21875, -21524,
+    -21398, -21499, -21697, -21809, -21709, -21398, -21001, -20689,
+    -20579, -20665, -20828, -20905, -20791, -20493, -20128, -19847,
+    -19749, -19824, -19958, -20008, -19882, -19595, -19255, -18999,
+    -18912, -18976, -19087, -19115, -18980, -18702, -18383, -18148,
+    -18068, -18125, -18217, -18225, -18083, -17812, -17511, -17293,
+    -17221, -17270, -17346, -17338, -17189, -16925, -16639, -16436,
+    -16370, -16413, -16475, -16453, -16299, -16040, -15767, -15577,
+    -15516, -15555, -15604, -15570, -15410, -15157, -14896, -14717,
+    -14661, -14695, -14732, -14688, -14524, -14275, -14024, -13856,
+    -13804, -13833, -13861, -13807, -13639, -13394, -13152, -12993,
+    -12945, -12971, -12990, -12927, -12755, -12513, -12281, -12130,
+    -12086, -12108, -12119, -12047, -11872, -11634, -11409, -11267,
+    -11225, -11245, -11248, -11168, -10990, -10755, -10538, -10403,
+    -10364, -10380, -10376, -10290, -10109,  -9877,  -9666,  -9538,
+     -9502,  -9516,  -9505,  -9412,  -9228,  -8999,  -8795,  -8673,
+     -8640,  -8651,  -8634,  -8535,  -8348,  -8121,  -7923,  -7807,
+     -7777,  -7785,  -7762,  -7657,  -7468,  -7244,  -7052,  -6942,
+     -6914,  -6920,  -6891,  -6780,  -6589,  -6367,  -6180,  -6076,
+     -6050,  -6054,  -6019,  -5903,  -5710,  -5490,  -5309,  -5210,
+     -5186,  -5188,  -5148,  -5027,  -4831,  -4613,  -4437,  -4344,
+     -4322,  -4321,  -4277,  -4150,  -3952,  -3737,  -3566,  -3477,
+     -3458,  -3455,  -3405,  -3274,  -3074,  -2860,  -2695,  -2611,
+     -2594,  -2589,  -2534,  -2397,  -2196,  -1984,  -1823,  -1744,
+     -1729,  -1722,  -1663,  -1521,  -1317,  -1108,   -952,   -878,
+      -865,   -856,   -791,   -645,   -439,   -231,    -80,    -11
+};
+
+/* Sawtooth, harmonics 1..32 */
+static const INT16S waveMipSawtooth3[256] = {
+         0,     22,    163,    468,    885,   1294,   1580,   1701,
+      1716,   1746,   1906,   2230,   2655,   3057,   3323,   3424,
+      3430,   3469,   3649,   3993,   4426,   4819,   5065,   5147,
+      5144,   5191,   5392,   5757,   6199,   6583,   6808,   6868,
+      6856,   6913,   7135,   7522,   7974,   8349,   8550,   8587,
+      8566,   8632,   8878,   9290,   9752,  10116,  10293,  10303,
+     10272,  10349,  10622,  11061,  11534,  11887,  12034,  12016,
+     11972,  12062,  12366,  12836,  13322,  13661,  13776,  13724,
+     13665,  13770,  14110,  14618,  15120,  15443,  15517,  15423,
+     15348,  15470,  15855,  16409,  16930,  17233,  17257,  17111,
+     17014,  17159,  17602,  18214,  18762,  19037,  18995,  18781,
+     18653,  18830,  19351,  20045,  20627,  20866,  20729,  20416,
+     20246,  20469,  21105,  21922,  22557,  22738,  22455,  21986,
+     21747,  22045,  22875,  23899,  24627,  24705,  24153,  23392,
+     23022,  23470,  24700,  26170,  27103,  26937,  25717,  24182,
+     23442,  24364,  26969,  30163,  32000,  30424,  24174,  13452,
+         0, -13452, -24174, -30424, -32000, -30163, -26969, -24364,
+    -23442, -24182, -25717, -26937, -27103, -26170, -24700, -23470,
+    -23022, -23392, -24153, -24705, -24627, -23899, -22875, -22045,
+    -21747, -21986, -22455, -22738, -22557, -21922, -21105, -20469,
+    -20246, -20416, -20729, -20866, -20627, -20045, -19351, -18830,
+    -18653, -18781, -18995, -19037, -18762, -18214, -17602, -17159,
+    -17014, -17111, -17257, -17233, -16930, -16409, -15855, -15470,
+    -15348, -15423, -15517, -15443, -15120, -14618, -14110, -13770,
+    -13665, -13724, -13776, -13661, -13322, -12836, -12366, -12062,
+    -11972, -12016, -12034, -11887, -11534, -11061, -10622, -10349,
+    -10272, -10303, -10293, -10116,  -9752,  -9290,  -8878,  -8632,
+     -8566,  -8587,  -8550,  -8349,  -7974,  -7522,  -7135,  -6913,
+     -6856,  -6868,  -6808,  -6583,  -6199,  -5757,  -5392,  -5191,
+     -5144,  -5147,  -5065,  -4819,  -4426,  -3993,  -3649,  -3469,
+     -3430,  -3424,  -3323,  -3057,  -2655,  -2230,  -1906,  -1746,
+     -1716,  -1701,  -1580,  -1294,   -885,   -468,   -163,    -22
+};
+
+/* Sawtooth, harmonics 1..16 */
+static const INT16S waveMipSawtooth4[256] = {
+         0,      6,     46,    149,    334,    606,    956,   1363,
+      1797,   2223,   2607,   2921,   3151,   3294,   3362,   3378,
+      3376,   3390,   3454,   3593,   3821,   4135,   4522,   4954,
+      5396,   5813,   6172,   6450,   6635,   6733,   6763,   6754,
+      6742,   6765,   6856,   7035,   7309,   7671,   8098,   8558,
+      9010,   9417,   9748,   9982,  10117,  10163,  10149,  10109,
+     10087,  10122,  10243,  10469,  10800,  11220,  11697,  12189,
+     12654,  13048,  13344,  13525,  13595,  13575,  13504,  13426,
+     13390,  13438,  13601,  13890,  14297,  14795,  15339,  15877,
+     16358,  16736,  16981,  17086,  17063,  16949,  16794,  16660,
+     16603,  16673,  16898,  17284,  17809,  18429,  19080,  19693,
+     20200,  20550,  20712,  20687,  20505,  20224,  19923,  19685,
+     19591,  19701,  20046,  20619,  21377,  22242,  23113,  23882,
+     24448,  24734,  24707,  24378,  23811,  23117,  22436,  21924,
+     21726,  21953,  22663,  23839,  25389,  27143,  28869,  30289,
+     31115,  31077,  29956,  27613,  24012,  19223,  13429,   6906,
+         0,  -6906, -13429, -19223, -24012, -27613, -29956, -31077,
+    -31115, -30289, -28869, -27143, -25389, -23839, -22663, -21953,
+    -21726, -21924, -22436, -23117, -23811, -24378, -24707, -24734,
+    -24448, -23882, -23113, -22242, -21377, -20619, -20046, -19701,
+    -19591, -19685, -19923, -20224, -20505, -20687, -20712, -20550,
+    -20200, -19693, -19080, -18429, -17809, -17284, -16898, -16673,
+    -16603, -16660, -16794, -16949, -17063, -17086, -16981, -16736,
+    -16358, -15877, -15339, -14795, -14297, -13890, -13601, -13438,
+    -13390, -13426, -13504, -13575, -13595, -13525, -13344, -13048,
+    -12654, -12189, -11697, -11220, -10800, -10469, -10243, -10122,
+    -10087, -10109, -10149, -10163, -10117,  -9982,  -9748,  -9417,
+     -9010,  -8558,  -8098,  -7671,  -7309,  -7035,  -6856,  -6765,
+     -6742,  -6754,  -6763,  -6733,  -6635,  -6450,  -6172,  -5813,
+     -5396,  -4954,  -4522,  -4135,  -3821,  -3593,  -3454,  -3390,
+     -3376,  -3378,  -3362,  -3294,  -3151,  -2921,  -2607,  -2223,
+     -1797,  -1363,   -956,   -606,   -334,   -149,    -46,     -6
+};
+
+/* Sawtooth, harmonics 1..8 */
+static const INT16S waveMipSawtooth5[256] = {
+         0,      2,     12,     42,     97,    187,    315,    486,
+       703,    965,   1270,   1615,   1995,   2402,   2829,   3266,
+      3705,   4134,   4547,   4933,   5285,   5597,   5866,   6088,
+      6263,   6392,   6480,   6530,   6551,   6551,   6538,   6523,
+      6516,   6526,   6563,   6636,   6750,   6910,   7121,   7382,
+      7693,   8049,   8446,   8877,   9332,   9802,  10276,  10742,
+     11190,  11610,  11992,  12329,  12613,  12843,  13016,  13132,
+     13196,  13212,  13190,  13138,  13067,  12990,  12920,  12869,
+     12849,  12872,  12948,  13083,  13283,  13551,  13886,  14285,
+     14742,  15248,  15792,  16362,  16941,  17516,  18069,  18585,
+     19051,  19453,  19780,  20026,  20185,  20256,  20242,  20151,
+     19991,  19776,  19524,  19252,  18982,  18736,  18534,  18399,
+     18351,  18405,  18575,  18873,  19301,  19860,  20545,  21343,
+     22238,  23207,  24222,  25252,  26262,  27213,  28066,  28781,
+     29318,  29640,  29713,  29508,  29000,  28170,  27008,  25509,
+     23678,  21526,  19074,  16348,  13383,  10219,   6900,   3477,
+         0,  -3477,  -6900, -10219, -13383, -16348, -19074, -21526,
+    -23678, -25509, -27008, -28170, -29000, -29508, -29713, -29640,
+    -29318, -28781, -28066, -27213, -26262, -25252, -24222, -23207,
+    -22238, -21343, -20545, -19860, -19301, -18873, -18575, -18405,
+    -18351, -18399, -18534, -18736, -18982, -19252, -19524, -19776,
+    -19991, -20151, -20242, -20256, -20185, -20026, -19780, -19453,
+    -19051, -18585, -18069, -17516, -16941, -16362, -15792, -15248,
+    -14742, -14285, -13886, -13551, -13283, -13083, -12948, -12872,
+    -12849, -12869, -12920, -12990, -13067, -13138, -13190, -13212,
+    -13196, -13132, -13016, -12843, -12613, -12329, -11992, -11610,
+    -11190, -10742, -10276,  -9802,  -9332,  -8877,  -8446,  -8049,
+     -7693,  -7382,  -7121,  -6910,  -6750,  -6636,  -6563,  -6526,
+     -6516,  -6523,  -6538,  -6551,  -6551,  -6530,  -6480,  -6392,
+     -6263,  -6088,  -5866,  -5597,  -5285,  -4933,  -4547,  -4134,
+     -3705,  -3266,  -2829,  -2402,  -1995,  -1615,  -1270,   -965,
+      -703,   -486,   -315,   -187,    -97,    -42,    -12,     -2
+};
+
+/* Sawtooth, harmonics 1..4 */
+static const INT16S waveMipSawtooth6[256] = {
+         0,      0,      3,     12,     28,     54,     93,    146,
+       216,    304,    413,    543,    696,    872,   1072,   1297,
+      1546,   1819,   2116,   2436,   2777,   3138,   3519,   3916,
+      4328,   4752,   5187,   5629,   6077,   6526,   6975,   7421,
+      7861,   8292,   8711,   9116,   9505,   9875,  10224,  10550,
+     10853,  11129,  11379,  11601,  11796,  11963,  12101,  12213,
+     12298,  12358,  12394,  12408,  12403,  12380,  12342,  12292,
+     12232,  12167,  12100,  12033,  11971,  11916,  11873,  11845,
+     11835,  11846,  11882,  11945,  12037,  12162,  12322,  12517,
+     12750,  13020,  13330,  13678,  14065,  14489,  14951,  15446,
+     15975,  16533,  17119,  17727,  18356,  19000,  19655,  20316,
+     20977,  21634,  22280,  22911,  23519,  24100,  24646,  25152,
+     25613,  26022,  26374,  26663,  26885,  27034,  27106,  27098,
+     27005,  26825,  26555,  26193,  25738,  25188,  24544,  23806,
+     22975,  22052,  21040,  19941,  18759,  17498,  16162,  14756,
+     13286,  11757,  10177,   8552,   6888,   5193,   3475,   1742,
+         0,  -1742,  -3475,  -5193,  -6888,  -8552, -10177, -11757,
+    -13286, -14756, -16162, -17498, -18759, -19941, -21040, -22052,
+    -22975, -23806, -24544, -25188, -25738, -26193, -26555, -26825,
+    -27005, -27098, -27106, -27034, -26885, -26663, -26374, -26022,
+    -25613, -25152, -24646, -24100, -23519, -22911, -22280, -21634,
+    -20977, -20316, -19655, -19000, -18356, -17727, -17119, -16533,
+    -15975, -15446, -14951, -14489, -14065, -13678, -13330, -13020,
+    -12750, -12517, -12322, -12162, -12037, -11945, -11882, -11846,
+    -11835, -11845, -11873, -11916, -11971, -12033, -12100, -12167,
+    -12232, -12292, -12342, -12380, -12403, -12408, -12394, -12358,
+    -12298, -12213, -12101, -11963, -11796, -11601, -11379, -11129,
+    -10853, -10550, -10224,  -9875,  -9505,  -9116,  -8711,  -8292,
+     -7861,  -7421,  -6975,  -6526,  -6077,  -5629,  -5187,  -4752,
+     -4328,  -3916,  -3519,  -3138,  -2777,  -2436,  -2116,  -1819,
+     -1546,  -1297,  -1072,   -872,   -696,   -543,   -413,   -304,
+      -216,   -146,    -93,    -54,    -28,    -12,     -3,      0
+};
+
+/* Sawtooth, harmonics 1..2 */
+static const INT16S waveMipSawtooth7[256] = {
+         0,      0,      1,      4,      8,     16,     28,     45,
+        67,     95,    129,    172,    222,    281,    350,    428,
+       517,    617,    729,    852,    988,   1137,   1298,   1473,
+      1662,   1865,   2081,   2312,   2556,   2815,   3088,   3375,
+      3677,   3992,   4320,   4662,   5017,   5385,   5765,   6157,
+      6560,   6974,   7399,   7833,   8276,   8727,   9186,   9652,
+     10125,  10602,  11084,  11569,  12057,  12546,  13036,  13526,
+     14014,  14501,  14983,  15462,  15935,  16402,  16861,  17311,
+     17752,  18182,  18601,  19007,  19398,  19775,  20137,  20481,
+     20808,  21116,  21404,  21672,  21919,  22144,  22345,  22524,
+     22677,  22806,  22909,  22986,  23036,  23059,  23055,  23022,
+     22961,  22871,  22753,  22605,  22428,  22222,  21987,  21722,
+     21429,  21106,  20755,  20375,  19967,  19532,  19069,  18579,
+     18063,  17521,  16954,  16363,  15749,  15111,  14451,  13771,
+     13070,  12350,  11611,  10856,  10085,   9298,   8498,   7685,
+      6860,   6025,   5181,   4330,   3472,   2608,   1741,    871,
+         0,   -871,  -1741,  -2608,  -3472,  -4330,  -5181,  -6025,
+     -6860,  -7685,  -8498,  -9298, -10085, -10856, -11611, -12350,
+    -13070, -13771, -14451, -15111, -15749, -16363, -16954, -17521,
+    -18063, -18579, -19069, -19532, -19967, -20375, -20755, -21106,
+    -21429, -21722, -21987, -22222, -22428, -22605, -22753, -22871,
+    -22961, -23022, -23055, -23059, -23036, -22986, -22909, -22806,
+    -22677, -22524, -22345, -22144, -21919, -21672, -21404, -21116,
+    -20808, -20481, -20137, -19775, -19398, -19007, -18601, -18182,
+    -17752, -17311, -16861, -16402, -15935, -15462, -14983, -14501,
+    -14014, -13526, -13036, -12546, -12057, -11569, -11084, -10602,
+    -10125,  -9652,  -9186,  -8727,  -8276,  -7833,  -7399,  -6974,
+     -6560,  -6157,  -5765,  -5385,  -5017,  -4662,  -4320,  -3992,
+     -3677,  -3375,  -3088,  -2815,  -2556,  -2312,  -2081,  -1865,
+     -1662,  -1473,  -1298,  -1137,   -988,   -852,   -729,   -617,
+      -517,   -428,   -350,   -281,   -222,   -172,   -129,    -95,
+       -67,    -45,    -28,    -16,     -8,     -4,     -1,      0
+};
+
+/* Sawtooth, harmonics 1..1 */
+static const INT16S waveMipSawtooth8[256] = {
+         0,    436,    871,   1306,   1740,   2173,   2605,   3035,
+      3463,   3890,   4313,   4735,   5153,   5569,   5981,   6389,
+      6793,   7194,   7590,   7982,   8368,   8750,   9126,   9497,
+      9863,  10222,  10575,  10922,  11262,  11595,  11922,  12241,
+     12553,  12857,  13154,  13442,  13723,  13995,  14259,  14514,
+     14760,  14998,  15227,  15446,  15656,  15857,  16048,  16229,
+     16401,  16563,  16714,  16856,  16988,  17109,  17220,  17321,
+     17411,  17491,  17560,  17619,  17667,  17704,  17731,  17747,
+     17752,  17747,  17731,  17704,  17667,  17619,  17560,  17491,
+     17411,  17321,  17220,  17109,  16988,  16856,  16714,  16563,
+     16401,  16229,  16048,  15857,  15656,  15446,  15227,  14998,
+     14760,  14514,  14259,  13995,  13723,  13442,  13154,  12857,
+     12553,  12241,  11922,  11595,  11262,  10922,  10575,  10222,
+      9863,   9497,   9126,   8750,   8368,   7982,   7590,   7194,
+      6793,   6389,   5981,   5569,   5153,   4735,   4313,   3890,
+      3463,   3035,   2605,   2173,   1740,   1306,    871,    436,
+         0,   -436,   -871,  -1306,  -1740,  -2173,  -2605,  -3035,
+     -3463,  -3890,  -4313,  -4735,  -5153,  -5569,  -5981,  -6389,
+     -6793,  -7194,  -7590,  -7982,  -8368,  -8750,  -9126,  -9497,
+     -9863, -10222, -10575, -10922, -11262, -11595, -11922, -12241,
+    -12553, -12857, -13154, -13442, -13723, -13995, -14259, -14514,
+    -14760, -14998, -15227, -15446, -15656, -15857, -16048, -16229,
+    -16401, -16563, -16714, -16856, -16988, -17109, -17220, -17321,
+    -17411, -17491, -17560, -17619, -17667, -17704, -17731, -17747,
+    -17752, -17747, -17731, -17704, -17667, -17619, -17560, -17491,
+    -17411, -17321, -17220, -17109, -16988, -16856, -16714, -16563,
+    -16401, -16229, -16048, -15857, -15656, -15446, -15227, -14998,
+    -14760, -14514, -14259, -13995, -13723, -13442, -13154, -12857,
+    -12553, -12241, -11922, -11595, -11262, -10922, -10575, -10222,
+     -9863,  -9497,  -9126,  -8750,  -8368,  -7982,  -7590,  -7194,
+     -6793,  -6389,  -5981,  -5569,  -5153,  -4735,  -4313,  -3890,
+     -3463,  -3035,  -2605,  -2173,  -1740,  -1306,   -871,   -436
+};
+
+const WAVE_MIPMAP WaveMipSawtooth = {
+    {
+        &waveMipSawtooth0[0], &waveMipSawtooth1[0], &waveMipSawtooth2[0],
+        &waveMipSawtooth3[0], &waveMipSawtooth4[0], &waveMipSawtooth5[0],
+        &waveMipSawtooth6[0], &waveMipSawtooth7[0], &waveMipSawtooth8[0]
+    },
+    {11u, 10u, 9u, 8u, 8u, 8u, 8u, 8u, 8u}
+};
+
+/* Square, harmonics 1..256 */
+static const INT16S waveMipSquare0[2048] = {
+         0,  12435,  22458,  28503,  30341,  29027,  26351,  24067,
+     23234,  23940,  25490,  26900,  27439,  26956,  25865,  24845,
+     24446,  24813,  25655,  26455,  26771,  26475,  25789,  25132,
+     24870,  25118,  25696,  26254,  26478,  26265,  25764,  25280,
+     25084,  25272,  25712,  26141,  26314,  26147,  25753,  25369,
+     25213,  25364,  25720,  26068,  26210,  26073,  25748,  25429,
+     25300,  25426,  25725,  26018,  26138,  26021,  25744,  25472,
+     25361,  25470,  25727,  25981,  26084,  25983,  25742,  25504,
+     25407,  25502,  25729,  25953,  26044,  25954,  25741,  25530,
+     25443,  25528,  25730,  25930,  26012,  25932,  25739,  25550,
+     25472,  25548,  25731,  25912,  25986,  25913,  25739,  25566,
+     25495,  25565,  25732,  25897,  25965,  25898,  25738,  25580,
+     25515,  25579,  25732,  25885,  25947,  25885,  25738,  25591,
+     25531,  25591,  25733,  25874,  25932,  25875,  25737,  25601,
+     25545,  25601,  25733,  25865,  25919,  25865,  25737,  25610,
+     25557,  25609,  25733,  25857,  25907,  25857,  25737,  25617,
+     25568,  25617,  25734,  25850,  25898,  25850,  25737,  25624,
+     25577,  25623,  25734,  25844,  25889,  25844,  25736,  25630,
+     25585,  25629,  25734,  25838,  25881,  25838,  25736,  25635,
+     25593,  25634,  25734,  25833,  25874,  25834,  25736,  25639,
+     25599,  25639,  25734,  25829,  25868,  25829,  25736,  25643,
+     25605,  25643,  25734,  25825,  25862,  25825,  25736,  25647,
+     25611,  25647,  25734,  25821,  25857,  25822,  25736,  25651,
+     25616,  25650,  25734,  25818,  25852,  25818,  25736,  25654,
+     25620,  25654,  25734,  25815,  25848,  25815,  25736,  25657,
+     25624,  25656,  25735,  25812,  25844,  25812,  25736,  25659,
+     25628,  25659,  25735,  25810,  25841,  25810,  25736,  25662,
+     25631,  25662,  25735,  25807,  25838,  25808,  25736,  25664,
+     25634,  25664,  25735,  25805,  25835,  25805,  25736,  25666,
+     25637,  25666,  25735,  25803,  25832,  25804,  25736,  25668,
+     25640,  25668,  25735,  25802,  25829,  25802,  25736,  25670,
+     25642,  25669,  25735,  25800,  25827,  25800,  25736,  25671,
+     25645,  25671,  25735,  25798,  25825,  25798,  25735,  25673,
+     25647,  25673,  25735,  25797,  25822,  25797,  25735,  25674,
+     25649,  25674,  25735,  25796,  25821,  25796,  25735,  25675,
+     25651,  25675,  25735,  25794,  25819,  25794,  25735,  25677,
+     25652,  25677,  25735,  25793,  25817,  25793,  25735,  25678,
+     25654,  25678,  25735,  25792,  25816,  25792,  25735,  25679,
+     25655,  25679,  25735,  25791,  25814,  25791,  25735,  25680,
+     25657,  25680,  25735,  25790,  25813,  25790,  25735,  25681,
+     25658,  25681,  25735,  25789,  25811,  25789,  25735,  25682,
+     25659,  25682,  25735,  25788,  25810,  25788,  25735,  25682,
+     25661,  25682,  25735,  25787,  25809,  25788,  25735,  25683,
+     25662,  25683,  25735,  25787,  25808,  25787,  25735,  25684,
+     25663,  25684,  25735,  25786,  25807,  25786,  25735,  25685,
+     25663,  25684,  25735,  25785,  25806,  25786,  25735,  25685,
+     25664,  25685,  25735,  25785,  25806,  25785,  25735,  25686,
+     25665,  25686,  25735,  25784,  25805,  25784,  25735,  25686,
+     25666,  25686,  25735,  25784,  25804,  25784,  25735,  25687,
+     25667,  25687,  25735,  25783,  25803,  25783,  25735,  25687,
+     25667,  25687,  25735,  25783,  25803,  25783,  25735,  25687,
+     25668,  25687,  25735,  25783,  25802,  25783,  25735,  25688,
+     25668,  25688,  25735,  25782,  25802,  25782,  25735,  25688,
+     25669,  25688,  25735,  25782,  25801,  25782,  25735,  25689,
+     25669,  25688,  25735,  25782,  25801,  25782,  25735,  25689,
+     25670,  25689,  25735,  25781,  25801,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25800,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25800,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25800,  25781,  25735,  25690,
+     25671,  25690,  25735,  25781,  25800,  25781,  25735,  25690,
+     25671,  25690,  25735,  25781,  25799,  25781,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25780,  25799,  25780,  25735,  25690,
+     25671,  25690,  25735,  25781,  25799,  25781,  25735,  25690,
+     25671,  25690,  25735,  25781,  25800,  25781,  25735,  25690,
+     25671,  25690,  25735,  25781,  25800,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25800,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25800,  25781,  25735,  25689,
+     25670,  25689,  25735,  25781,  25801,  25781,  25735,  25689,
+     25670,  25689,  25735,  25782,  25801,  25782,  25735,  25688,
+     25669,  25689,  25735,  25782,  25801,  25782,  25735,  25688,
+     25669,  25688,  25735,  25782,  25802,  25782,  25735,  25688,
+     25668,  25688,  25735,  25783,  25802,  25783,  25735,  25687,
+     25668,  25687,  25735,  25783,  25803,  25783,  25735,  25687,
+     25667,  25687,  25735,  25783,  25803,  25783,  25735,  25687,
+     25667,  25687,  25735,  25784,  25804,  25784,  25735,  25686,
+     25666,  25686,  25735,  25784,  25805,  25784,  25735,  25686,
+     25665,  25686,  25735,  25785,  25806,  25785,  25735,  25685,
+     25664,  25685,  25735,  25786,  25806,  25785,  25735,  25684,
+     25663,  25685,  25735,  25786,  25807,  25786,  25735,  25684,
+     25663,  25684,  25735,  25787,  25808,  25787,  25735,  25683,
+     25662,  25683,  25735,  25788,  25809,  25787,  25735,  25682,
+     25661,  25682,  25735,  25788,  25810,  25788,  25735,  25682,
+     25659,  25682,  25735,  25789,  25811,  25789,  25735,  25681,
+     25658,  25681,  25735,  25790,  25813,  25790,  25735,  25680,
+     25657,  25680,  25735,  25791,  25814,  25791,  25735,  25679,
+     25655,  25679,  25735,  25792,  25816,  25792,  25735,  25678,
+     25654,  25678,  25735,  25793,  25817,  25793,  25735,  25677,
+     25652,  25677,  25735,  25794,  25819,  25794,  25735,  25675,
+     25651,  25675,  25735,  25796,  25821,  25796,  25735,  25674,
+     25649,  25674,  25735,  25797,  25822,  25797,  25735,  25673,
+     25647,  25673,  25735,  25798,  25825,  25798,  25735,  25671,
+     25645,  25671,  25736,  25800,  25827,  25800,  25735,  25669,
+     25642,  25670,  25736,  25802,  25829,  25802,  25735,  25668,
+     25640,  25668,  25736,  25804,  25832,  25803,  25735,  25666,
+     25637,  25666,  25736,  25805,  25835,  25805,  25735,  25664,
+     25634,  25664,  25736,  25808,  25838,  25807,  25735,  25662,
+     25631,  25662,  25736,  25810,  25841,  25810,  25735,  25659,
+     25628,  25659,  25736,  25812,  25844,  25812,  25735,  25656,
+     25624,  25657,  25736,  25815,  25848,  25815,  25734,  25654,
+     25620,  25654,  25736,  25818,  25852,  25818,  25734,  25650,
+     25616,  25651,  25736,  25822,  25857,  25821,  25734,  25647,
+     25611,  25647,  25736,  25825,  25862,  25825,  25734,  25643,
+     25605,  25643,  25736,  25829,  25868,  25829,  25734,  25639,
+     25599,  25639,  25736,  25834,  25874,  25833,  25734,  25634,
+     25593,  25635,  25736,  25838,  25881,  25838,  25734,  25629,
+     25585,  25630,  25736,  25844,  25889,  25844,  25734,  25623,
+     25577,  25624,  25737,  25850,  25898,  25850,  25734,  25617,
+     25568,  25617,  25737,  25857,  25907,  25857,  25733,  25609,
+     25557,  25610,  25737,  25865,  25919,  25865,  25733,  25601,
+     25545,  25601,  25737,  25875,  25932,  25874,  25733,  25591,
+     25531,  25591,  25738,  25885,  25947,  25885,  25732,  25579,
+     25515,  25580,  25738,  25898,  25965,  25897,  25732,  25565,
+     25495,  25566,  25739,  25913,  25986,  25912,  25731,  25548,
+     25472,  25550,  25739,  25932,  26012,  25930,  25730,  25528,
+     25443,  25530,  25741,  25954,  26044,  25953,  25729,  25502,
+     25407,  25504,  25742,  25983,  26084,  25981,  25727,  25470,
+     25361,  25472,  25744,  26021,  26138,  26018,  25725,  25426,
+     25300,  25429,  25748,  26073,  26210,  26068,  25720,  25364,
+     25213,  25369,  25753,  26147,  26314,  26141,  25712,  25272,
+     25084,  25280,  25764,  26265,  26478,  26254,  25696,  25118,
+     24870,  25132,  25789,  26475,  26771,  26455,  25655,  24813,
+     24446,  24845,  25865,  26956,  27439,  26900,  25490,  23940,
+     23234,  24067,  26351,  29027,  30341,  28503,  22458,  12435,
+         0, -12435, -22458, -28503, -30341, -29027, -26351, -24067,
+    -23234, -23940, -25490, -26900, -27439, -26956, -25865, -24845,
+    -24446, -24813, -25655, -26455, -26771, -26475, -25789, -25132,
+    -24870, -25118, -25696, -26254, -26478, -26265, -25764, -25280,
+    -25084, -25272, -25712, -26141, -26314, -26147, -25753, -25369,
+    -25213, -25364, -25720, -26068, -26210, -26073, -25748, -25429,
+    -25300, -25426, -25725, -26018, -26138, -26021, -25744, -25472,
+    -25361, -25470, -25727, -25981, -26084, -25983, -25742, -25504,
+    -25407, -25502, -25729, -25953, -26044, -25954, -25741, -25530,
+    -25443, -25528, -25730, -25930, -26012, -25932, -25739, -25550,
+    -25472, -25548, -25731, -25912, -25986, -25913, -25739, -25566,
+    -25495, -25565, -25732, -25897, -25965, -25898, -25738, -25580,
+    -25515, -25579, -25732, -25885, -25947, -25885, -25738, -25591,
+    -25531, -25591, -25733, -25874, -25932, -25875, -25737, -25601,
+    -25545, -25601, -25733, -25865, -25919, -25865, -25737, -25610,
+    -25557, -25609, -25733, -25857, -25907, -25857, -25737, -25617,
+    -25568, -25617, -25734, -25850, -25898, -25850, -25737, -25624,
+    -25577, -25623, -25734, -25844, -25889, -25844, -25736, -25630,
+    -25585, -25629, -25734, -25838, -25881, -25838, -25736, -25635,
+    -25593, -25634, -25734, -25833, -25874, -25834, -25736, -25639,
+    -25599, -25639, -25734, -25829, -25868, -25829, -25736, -25643,
+    -25605, -25643, -25734, -25825, -25862, -25825, -25736, -25647,
+    -25611, -25647, -25734, -25821, -25857, -25822, -25736, -25651,
+    -25616, -25650, -25734, -25818, -25852, -25818, -25736, -25654,
+    -25620, -25654, -25734, -25815, -25848, -25815, -25736, -25657,
+    -25624, -25656, -25735, -25812, -25844, -25812, -25736, -25659,
+    -25628, -25659, -25735, -25810, -25841, -25810, -25736, -25662,
+    -25631, -25662, -25735, -25807, -25838, -25808, -25736, -25664,
+    -25634, -25664, -25735, -25805, -25835, -25805, -25736, -25666,
+    -25637, -25666, -25735, -25803, -25832, -25804, -25736, -25668,
+    -25640, -25668, -25735, -25802, -25829, -25802, -25736, -25670,
+    -25642, -25669, -25735, -25800, -25827, -25800, -25736, -25671,
+    -25645, -25671, -25735, -25798, -25825, -25798, -25735, -25673,
+    -25647, -25673, -25735, -25797, -25822, -25797, -25735, -25674,
+    -25649, -25674, -25735, -25796, -25821, -25796, -25735, -25675,
+    -25651, -25675, -25735, -25794, -25819, -25794, -25735, -25677,
+    -25652, -25677, -25735, -25793, -25817, -25793, -25735, -25678,
+    -25654, -25678, -25735, -25792, -25816, -25792, -25735, -25679,
+    -25655, -25679, -25735, -25791, -25814, -25791, -25735, -25680,
+    -25657, -25680, -25735, -25790, -25813, -25790, -25735, -25681,
+    -25658, -25681, -25735, -25789, -25811, -25789, -25735, -25682,
+    -25659, -25682, -25735, -25788, -25810, -25788, -25735, -25682,
+    -25661, -25682, -25735, -25787, -25809, -25788, -25735, -25683,
+    -25662, -25683, -25735, -25787, -25808, -25787, -25735, -25684,
+    -25663, -25684, -25735, -25786, -25807, -25786, -25735, -25685,
+    -25663, -25684, -25735, -25785, -25806, -25786, -25735, -25685,
+    -25664, -25685, -25735, -25785, -25806, -25785, -25735, -25686,
+    -25665, -25686, -25735, -25784, -25805, -25784, -25735, -25686,
+    -25666, -25686, -25735, -25784, -25804, -25784, -25735, -25687,
+    -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+    -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+    -25668, -25687, -25735, -25783, -25802, -25783, -25735, -25688,
+    -25668, -25688, -25735, -25782, -25802, -25782, -25735, -25688,
+    -25669, -25688, -25735, -25782, -25801, -25782, -25735, -25689,
+    -25669, -25688, -25735, -25782, -25801, -25782, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25801, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25690,
+    -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25690,
+    -25671, -25690, -25735, -25781, -25799, -25781, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+    -25671, -25690, -25735, -25781, -25799, -25781, -25735, -25690,
+    -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25690,
+    -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25781, -25801, -25781, -25735, -25689,
+    -25670, -25689, -25735, -25782, -25801, -25782, -25735, -25688,
+    -25669, -25689, -25735, -25782, -25801, -25782, -25735, -25688,
+    -25669, -25688, -25735, -25782, -25802, -25782, -25735, -25688,
+    -25668, -25688, -25735, -25783, -25802, -25783, -25735, -25687,
+    -25668, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+    -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+    -25667, -25687, -25735, -25784, -25804, -25784, -25735, -25686,
+    -25666, -25686, -25735, -25784, -25805, -25784, -25735, -25686,
+    -25665, -25686, -25735, -25785, -25806, -25785, -25735, -25685,
+    -25664, -25685, -25735, -25786, -25806, -25785, -25735, -25684,
+    -25663, -25685, -25735, -25786, -25807, -25786, -25735, -25684,
+    -25663, -25684, -25735, -25787, -25808, -25787, -25735, -25683,
+    -25662, -25683, -25735, -25788, -25809, -25787, -25735, -25682,
+    -25661, -25682, -25735, -25788, -25810, -25788, -25735, -25682,
+    -25659, -25682, -25735, -25789, -25811, -25789, -25735, -25681,
+    -25658, -25681, -25735, -25790, -25813, -25790, -25735, -25680,
+    -25657, -25680, -25735, -25791, -25814, -25791, -25735, -25679,
+    -25655, -25679, -25735, -25792, -25816, -25792, -25735, -25678,
+    -25654, -25678, -25735, -25793, -25817, -25793, -25735, -25677,
+    -25652, -25677, -25735, -25794, -25819, -25794, -25735, -25675,
+    -25651, -25675, -25735, -25796, -25821, -25796, -25735, -25674,
+    -25649, -25674, -25735, -25797, -25822, -25797, -25735, -25673,
+    -25647, -25673, -25735, -25798, -25825, -25798, -25735, -25671,
+    -25645, -25671, -25736, -25800, -25827, -25800, -25735, -25669,
+    -25642, -25670, -25736, -25802, -25829, -25802, -25735, -25668,
+    -25640, -25668, -25736, -25804, -25832, -25803, -25735, -25666,
+    -25637, -25666, -25736, -25805, -25835, -25805, -25735, -25664,
+    -25634, -25664, -25736, -25808, -25838, -25807, -25735, -25662,
+    -25631, -25662, -25736, -25810, -25841, -25810, -25735, -25659,
+    -25628, -25659, -25736, -25812, -25844, -25812, -25735, -25656,
+    -25624, -25657, -25736, -25815, -25848, -25815, -25734, -25654,
+    -25620, -25654, -25736, -25818, -25852, -25818, -25734, -25650,
+    -25616, -25651, -25736, -25822, -25857, -25821, -25734, -25647,
+    -25611, -25647, -25736, -25825, -25862, -25825, -25734, -25643,
+    -25605, -25643, -25736, -25829, -25868, -25829, -25734, -25639,
+    -25599, -25639, -25736, -25834, -25874, -25833, -25734, -25634,
+    -25593, -25635, -25736, -25838, -25881, -25838, -25734, -25629,
+    -25585, -25630, -25736, -25844, -25889, -25844, -25734, -25623,
+    -25577, -25624, -25737, -25850, -25898, -25850, -25734, -25617,
+    -25568, -25617, -25737, -25857, -25907, -25857, -25733, -25609,
+    -25557, -25610, -25737, -25865, -25919, -25865, -25733, -25601,
+    -25545, -25601, -25737, -25875, -25932, -25874, -25733, -25591,
+    -25531, -25591, -25738, -25885, -25947, -25885, -25732, -25579,
+    -25515, -25580, -25738, -25898, -25965, -25897, -25732, -25565,
+    -25495, -25566, -25739, -25913, -25986, -25912, -25731, -25548,
+    -25472, -25550, -25739, -25932, -26012, -25930, -25730, -25528,
+    -25443, -25530, -25741, -25954, -26044, -25953, -25729, -25502,
+    -25407, -25504, -25742, -25983, -26084, -25981, -25727, -25470,
+    -25361, -25472, -25744, -26021, -26138, -26018, -25725, -25426,
+    -25300, -25429, -25748, -26073, -26210, -26068, -25720, -25364,
+    -25213, -25369, -25753, -26147, -26314, -26141, -25712, -25272,
+    -25084, -25280, -25764, -26265, -26478, -26254, -25696, -25118,
+    -24870, -25132, -25789, -26475, -26771, -26455, -25655, -24813,
+    -24446, -24845, -25865, -26956, -27439, -26900, -25490, -23940,
+    -23234, -24067, -26351, -29027, -30341, -28503, -22458, -12435
+};
+
+/* Square, harmonics 1..128 */
+static const INT16S waveMipSquare1[1024] = {
+         0,  12435,  22458,  28504,  30342,  29027,  26351,  24067,
+     23233,  23940,  25490,  26901,  27440,  26957,  25865,  24844,
+     24445,  24812,  25656,  26456,  26773,  26476,  25789,  25130,
+     24868,  25116,  25697,  26256,  26481,  26267,  25764,  25277,
+     25081,  25269,  25713,  26144,  26318,  26150,  25753,  25366,
+     25209,  25361,  25720,  26072,  26214,  26076,  25747,  25426,
+     25295,  25422,  25725,  26022,  26143,  26025,  25744,  25468,
+     25356,  25466,  25727,  25985,  26090,  25987,  25742,  25500,
+     25401,  25498,  25729,  25957,  26051,  25959,  25740,  25524,
+     25436,  25523,  25730,  25936,  26020,  25937,  25739,  25544,
+     25464,  25543,  25731,  25918,  25995,  25919,  25739,  25560,
+     25486,  25559,  25732,  25904,  25974,  25905,  25738,  25573,
+     25505,  25572,  25733,  25892,  25957,  25893,  25738,  25584,
+     25520,  25583,  25733,  25882,  25943,  25883,  25737,  25593,
+     25533,  25592,  25733,  25873,  25931,  25874,  25737,  25601,
+     25545,  25600,  25734,  25866,  25921,  25867,  25737,  25607,
+     25554,  25607,  25734,  25860,  25912,  25860,  25736,  25613,
+     25562,  25613,  25734,  25854,  25904,  25855,  25736,  25618,
+     25570,  25618,  25734,  25850,  25897,  25850,  25736,  25623,
+     25576,  25622,  25734,  25846,  25892,  25846,  25736,  25626,
+     25581,  25626,  25734,  25842,  25887,  25842,  25736,  25630,
+     25586,  25630,  25734,  25839,  25882,  25839,  25736,  25633,
+     25590,  25632,  25735,  25836,  25878,  25837,  25736,  25635,
+     25594,  25635,  25735,  25834,  25875,  25834,  25736,  25637,
+     25597,  25637,  25735,  25832,  25872,  25832,  25736,  25639,
+     25599,  25639,  25735,  25830,  25870,  25831,  25735,  25641,
+     25601,  25641,  25735,  25829,  25868,  25829,  25735,  25642,
+     25603,  25642,  25735,  25828,  25866,  25828,  25735,  25643,
+     25605,  25643,  25735,  25827,  25865,  25827,  25735,  25644,
+     25606,  25644,  25735,  25826,  25864,  25826,  25735,  25644,
+     25607,  25644,  25735,  25826,  25863,  25826,  25735,  25645,
+     25607,  25645,  25735,  25826,  25863,  25826,  25735,  25645,
+     25607,  25645,  25735,  25826,  25863,  25826,  25735,  25645,
+     25607,  25645,  25735,  25826,  25863,  25826,  25735,  25644,
+     25607,  25644,  25735,  25826,  25864,  25826,  25735,  25644,
+     25606,  25644,  25735,  25827,  25865,  25827,  25735,  25643,
+     25605,  25643,  25735,  25828,  25866,  25828,  25735,  25642,
+     25603,  25642,  25735,  25829,  25868,  25829,  25735,  25641,
+     25601,  25641,  25735,  25831,  25870,  25830,  25735,  25639,
+     25599,  25639,  25736,  25832,  25872,  25832,  25735,  25637,
+     25597,  25637,  25736,  25834,  25875,  25834,  25735,  25635,
+     25594,  25635,  25736,  25837,  25878,  25836,  25735,  25632,
+     25590,  25633,  25736,  25839,  25882,  25839,  25734,  25630,
+     25586,  25630,  25736,  25842,  25887,  25842,  25734,  25626,
+     25581,  25626,  25736,  25846,  25892,  25846,  25734,  25622,
+     25576,  25623,  25736,  25850,  25897,  25850,  25734,  25618,
+     25570,  25618,  25736,  25855,  25904,  25854,  25734,  25613,
+     25562,  25613,  25736,  25860,  25912,  25860,  25734,  25607,
+     25554,  25607,  25737,  25867,  25921,  25866,  25734,  25600,
+     25545,  25601,  25737,  25874,  25931,  25873,  25733,  25592,
+     25533,  25593,  25737,  25883,  25943,  25882,  25733,  25583,
+     25520,  25584,  25738,  25893,  25957,  25892,  25733,  25572,
+     25505,  25573,  25738,  25905,  25974,  25904,  25732,  25559,
+     25486,  25560,  25739,  25919,  25995,  25918,  25731,  25543,
+     25464,  25544,  25739,  25937,  26020,  25936,  25730,  25523,
+     25436,  25524,  25740,  25959,  26051,  25957,  25729,  25498,
+     25401,  25500,  25742,  25987,  26090,  25985,  25727,  25466,
+     25356,  25468,  25744,  26025,  26143,  26022,  25725,  25422,
+     25295,  25426,  25747,  26076,  26214,  26072,  25720,  25361,
+     25209,  25366,  25753,  26150,  26318,  26144,  25713,  25269,
+     25081,  25277,  25764,  26267,  26481,  26256,  25697,  25116,
+     24868,  25130,  25789,  26476,  26773,  26456,  25656,  24812,
+     24445,  24844,  25865,  26957,  27440,  26901,  25490,  23940,
+     23233,  24067,  26351,  29027,  30342,  28504,  22458,  12435,
+         0, -12435, -22458, -28504, -30342, -29027, -26351, -24067,
+    -23233, -23940, -25490, -26901, -27440, -26957, -25865, -24844,
+    -24445, -24812, -25656, -26456, -26773, -26476, -25789, -25130,
+    -24868, -25116, -25697, -26256, -26481, -26267, -25764, -25277,
+    -25081, -25269, -25713, -26144, -26318, -26150, -25753, -25366,
+    -25209, -25361, -25720, -26072, -26214, -26076, -25747, -25426,
+    -25295, -25422, -25725, -26022, -26143, -26025, -25744, -25468,
+    -25356, -25466, -25727, -25985, -26090, -25987, -25742, -25500,
+    -25401, -25498, -25729, -25957, -26051, -25959, -25740, -25524,
+    -25436, -25523, -25730, -25936, -26020, -25937, -25739, -25544,
+    -25464, -25543, -25731, -25918, -25995, -25919, -25739, -25560,
+    -25486, -25559, -25732, -25904, -25974, -25905, -25738, -25573,
+    -25505, -25572, -25733, -25892, -25957, -25893, -25738, -25584,
+    -25520, -25583, -25733, -25882, -25943, -25883, -25737, -25593,
+    -25533, -25592, -25733, -25873, -25931, -25874, -25737, -25601,
+    -25545, -25600, -25734, -25866, -25921, -25867, -25737, -25607,
+    -25554, -25607, -25734, -25860, -25912, -25860, -25736, -25613,
+    -25562, -25613, -25734, -25854, -25904, -25855, -25736, -25618,
+    -25570, -25618, -25734, -25850, -25897, -25850, -25736, -25623,
+    -25576, -25622, -25734, -25846, -25892, -25846, -25736, -25626,
+    -25581, -25626, -25734, -25842, -25887, -25842, -25736, -25630,
+    -25586, -25630, -25734, -25839, -25882, -25839, -25736, -25633,
+    -25590, -25632, -25735, -25836, -25878, -25837, -25736, -25635,
+    -25594, -25635, -25735, -25834, -25875, -25834, -25736, -25637,
+    -25597, -25637, -25735, -25832, -25872, -25832, -25736, -25639,
+    -25599, -25639, -25735, -25830, -25870, -25831, -25735, -25641,
+    -25601, -25641, -25735, -25829, -25868, -25829, -25735, -25642,
+    -25603, -25642, -25735, -25828, -25866, -25828, -25735, -25643,
+    -25605, -25643, -25735, -25827, -25865, -25827, -25735, -25644,
+    -25606, -25644, -25735, -25826, -25864, -25826, -25735, -25644,
+    -25607, -25644, -25735, -25826, -25863, -25826, -25735, -25645,
+    -25607, -25645, -25735, -25826, -25863, -25826, -25735, -25645,
+    -25607, -25645, -25735, -25826, -25863, -25826, -25735, -25645,
+    -25607, -25645, -25735, -25826, -25863, -25826, -25735, -25644,
+    -25607, -25644, -25735, -25826, -25864, -25826, -25735, -25644,
+    -25606, -25644, -25735, -25827, -25865, -25827, -25735, -25643,
+    -25605, -25643, -25735, -25828, -25866, -25828, -25735, -25642,
+    -25603, -25642, -25735, -25829, -25868, -25829, -25735, -25641,
+    -25601, -25641, -25735, -25831, -25870, -25830, -25735, -25639,
+    -25599, -25639, -25736, -25832, -25872, -25832, -25735, -25637,
+    -25597, -25637, -25736, -25834, -25875, -25834, -25735, -25635,
+    -25594, -25635, -25736, -25837, -25878, -25836, -25735, -25632,
+    -25590, -25633, -25736, -25839, -25882, -25839, -25734, -25630,
+    -25586, -25630, -25736, -25842, -25887, -25842, -25734, -25626,
+    -25581, -25626, -25736, -25846, -25892, -25846, -25734, -25622,
+    -25576, -25623, -25736, -25850, -25897, -25850, -25734, -25618,
+    -25570, -25618, -25736, -25855, -25904, -25854, -25734, -25613,
+    -25562, -25613, -25736, -25860, -25912, -25860, -25734, -25607,
+    -25554, -25607, -25737, -25867, -25921, -25866, -25734, -25600,
+    -25545, -25601, -25737, -25874, -25931, -25873, -25733, -25592,
+    -25533, -25593, -25737, -25883, -25943, -25882, -25733, -25583,
+    -25520, -25584, -25738, -25893, -25957, -25892, -25733, -25572,
+    -25505, -25573, -25738, -25905, -25974, -25904, -25732, -25559,
+    -25486, -25560, -25739, -25919, -25995, -25918, -25731, -25543,
+    -25464, -25544, -25739, -25937, -26020, -25936, -25730, -25523,
+    -25436, -25524, -25740, -25959, -26051, -25957, -25729, -25498,
+    -25401, -25500, -25742, -25987, -26090, -25985, -25727, -25466,
+    -25356, -25468, -25744, -26025, -26143, -26022, -25725, -25422,
+    -25295, -25426, -25747, -26076, -26214, -26072, -25720, -25361,
+    -25209, -25366, -25753, -26150, -26318, -26144, -25713, -25269,
+    -25081, -25277, -25764, -26267, -26481, -26256, -25697, -25116,
+    -24868, -25130, -25789, -26476, -26773, -26456, -25656, -24812,
+    -24445, -24844, -25865, -26957, -27440, -26901, -25490, -23940,
+    -23233, -24067, -26351, -29027, -30342, -28504, -22458, -12435
+};
+
+/* Square, harmonics 1..64 */
+static const INT16S waveMipSquare2[512] = {
+         0,  12435,  22459,  28505,  30343,  29028,  26350,  24064,
+     23230,  23938,  25491,  26904,  27445,  26960,  25864,  24839,
+     24438,  24808,  25656,  26462,  26781,  26482,  25788,  25123,
+     24858,  25110,  25697,  26264,  26492,  26274,  25764,  25268,
+     25068,  25260,  25713,  26154,  26332,  26160,  25753,  25355,
+     25193,  25350,  25721,  26084,  26232,  26088,  25747,  25412,
+     25275,  25408,  25725,  26037,  26164,  26040,  25743,  25451,
+     25332,  25449,  25728,  26003,  26116,  26005,  25741,  25480,
+     25373,  25479,  25730,  25978,  26080,  25980,  25740,  25502,
+     25404,  25501,  25731,  25960,  26054,  25961,  25739,  25518,
+     25427,  25517,  25732,  25946,  26033,  25946,  25738,  25530,
+     25445,  25530,  25733,  25935,  26018,  25936,  25737,  25540,
+     25458,  25539,  25733,  25927,  26007,  25928,  25737,  25546,
+     25468,  25546,  25734,  25922,  25999,  25922,  25736,  25551,
+     25474,  25551,  25734,  25918,  25994,  25918,  25736,  25553,
+     25478,  25553,  25735,  25916,  25991,  25916,  25735,  25554,
+     25479,  25554,  25735,  25916,  25991,  25916,  25735,  25553,
+     25478,  25553,  25736,  25918,  25994,  25918,  25734,  25551,
+     25474,  25551,  25736,  25922,  25999,  25922,  25734,  25546,
+     25468,  25546,  25737,  25928,  26007,  25927,  25733,  25539,
+     25458,  25540,  25737,  25936,  26018,  25935,  25733,  25530,
+     25445,  25530,  25738,  25946,  26033,  25946,  25732,  25517,
+     25427,  25518,  25739,  25961,  26054,  25960,  25731,  25501,
+     25404,  25502,  25740,  25980,  26080,  25978,  25730,  25479,
+     25373,  25480,  25741,  26005,  26116,  26003,  25728,  25449,
+     25332,  25451,  25743,  26040,  26164,  26037,  25725,  25408,
+     25275,  25412,  25747,  26088,  26232,  26084,  25721,  25350,
+     25193,  25355,  25753,  26160,  26332,  26154,  25713,  25260,
+     25068,  25268,  25764,  26274,  26492,  26264,  25697,  25110,
+     24858,  25123,  25788,  26482,  26781,  26462,  25656,  24808,
+     24438,  24839,  25864,  26960,  27445,  26904,  25491,  23938,
+     23230,  24064,  26350,  29028,  30343,  28505,  22459,  12435,
+         0, -12435, -22459, -28505, -30343, -29028, -26350, -24064,
+    -23230, -23938, -25491, -26904, -27445, -26960, -25864, -24839,
+    -24438, -24808, -25656, -26462, -26781, -26482, -25788, -25123,
+    -24858, -25110, -25697, -26264, -26492, -26274, -25764, -25268,
+    -25068, -25260, -25713, -26154, -26332, -26160, -25753, -25355,
+    -25193, -25350, -25721, -26084, -26232, -26088, -25747, -25412,
+    -25275, -25408, -25725, -26037, -26164, -26040, -25743, -25451,
+    -25332, -25449, -25728, -26003, -26116, -26005, -25741, -25480,
+    -25373, -25479, -25730, -25978, -26080, -25980, -25740, -25502,
+    -25404, -25501, -25731, -25960, -26054, -25961, -25739, -25518,
+    -25427, -25517, -25732, -25946, -26033, -25946, -25738, -25530,
+    -25445, -25530, -25733, -25935, -26018, -25936, -25737, -25540,
+    -25458, -25539, -25733, -25927, -26007, -25928, -25737, -25546,
+    -25468, -25546, -25734, -25922, -25999, -25922, -25736, -25551,
+    -25474, -25551, -25734, -25918, -25994, -25918, -25736, -25553,
+    -25478, -25553, -25735, -25916, -25991, -25916, -25735, -25554,
+    -25479, -25554, -25735, -25916, -25991, -25916, -25735, -25553,
+    -25478, -25553, -25736, -25918, -25994, -25918, -25734, -25551,
+    -25474, -25551, -25736, -25922, -25999, -25922, -25734, -25546,
+    -25468, -25546, -25737, -25928, -26007, -25927, -25733, -25539,
+    -25458, -25540, -25737, -25936, -26018, -25935, -25733, -25530,
+    -25445, -25530, -25738, -25946, -26033, -25946, -25732, -25517,
+    -25427, -25518, -25739, -25961, -26054, -25960, -25731, -25501,
+    -25404, -25502, -25740, -25980, -26080, -25978, -25730, -25479,
+    -25373, -25480, -25741, -26005, -26116, -26003, -25728, -25449,
+    -25332, -25451, -25743, -26040, -26164, -26037, -25725, -25408,
+    -25275, -25412, -25747, -26088, -26232, -26084, -25721, -25350,
+    -25193, -25355, -25753, -26160, -26332, -26154, -25713, -25260,
+    -25068, -25268, -25764, -26274, -26492, -26264, -25697, -25110,
+    -24858, -25123, -25788, -26482, -26781, -26462, -25656, -24808,
+    -24438, -24839, -25864, -26960, -27445, -26904, -25491, -23938,
+    -23230, -24064, -26350, -29028, -30343, -28505, -22459, -12435
+};
+
+/* Square, harmonics 1..32 */
+static const INT16S waveMipSquare3[256] = {
+         0,  12435,  22461,  28509,  30350,  29032,  26348,  24055,
+     23217,  23929,  25493,  26918,  27464,  26973,  25862,  24821,
+     24413,  24790,  25658,  26485,  26813,  26504,  25786,  25095,
+     24818,  25082,  25699,  26298,  26539,  26307,  25761,  25229,
+     25013,  25222,  25716,  26199,  26396,  26204,  25750,  25303,
+     25121,  25299,  25724,  26143,  26315,  26146,  25743,  25345,
+     25182,  25343,  25729,  26112,  26270,  26114,  25739,  25367,
+     25214,  25366,  25733,  26098,  26249,  26099,  25736,  25374,
+     25224,  25374,  25736,  26099,  26249,  26098,  25733,  25366,
+     25214,  25367,  25739,  26114,  26270,  26112,  25729,  25343,
+     25182,  25345,  25743,  26146,  26315,  26143,  25724,  25299,
+     25121,  25303,  25750,  26204,  26396,  26199,  25716,  25222,
+     25013,  25229,  25761,  26307,  26539,  26298,  25699,  25082,
+     24818,  25095,  25786,  26504,  26813,  26485,  25658,  24790,
+     24413,  24821,  25862,  26973,  27464,  26918,  25493,  23929,
+     23217,  24055,  26348,  29032,  30350,  28509,  22461,  12435,
+         0, -12435, -22461, -28509, -30350, -29032, -26348, -24055,
+    -23217, -23929, -25493, -26918, -27464, -26973, -25862, -24821,
+    -24413, -24790, -25658, -26485, -26813, -26504, -25786, -25095,
+    -24818, -25082, -25699, -26298, -26539, -26307, -25761, -25229,
+    -25013, -25222, -25716, -26199, -26396, -26204, -25750, -25303,
+    -25121, -25299, -25724, -26143, -26315, -26146, -25743, -25345,
+    -25182, -25343, -25729, -26112, -26270, -26114, -25739, -25367,
+    -25214, -25366, -25733, -26098, -26249, -26099, -25736, -25374,
+    -25224, -25374, -25736, -26099, -26249, -26098, -25733, -25366,
+    -25214, -25367, -25739, -26114, -26270, -26112, -25729, -25343,
+    -25182, -25345, -25743, -26146, -26315, -26143, -25724, -25299,
+    -25121, -25303, -25750, -26204, -26396, -26199, -25716, -25222,
+    -25013, -25229, -25761, -26307, -26539, -26298, -25699, -25082,
+    -24818, -25095, -25786, -26504, -26813, -26485, -25658, -24790,
+    -24413, -24821, -25862, -26973, -27464, -26918, -25493, -23929,
+    -23217, -24055, -26348, -29032, -30350, -28509, -22461, -12435
+};
+
+/* Square, harmonics 1..16 */
+static const INT16S waveMipSquare4[256] = {
+         0,   6379,  12436,  17879,  22469,  26044,  28529,  29939,
+     30375,  30005,  29049,  27747,  26340,  25041,  24018,  23378,
+     23166,  23362,  23894,  24651,  25502,  26315,  26975,  27399,
+     27543,  27406,  27028,  26479,  25852,  25243,  24742,  24415,
+     24303,  24411,  24714,  25157,  25669,  26171,  26589,  26863,
+     26958,  26865,  26605,  26220,  25773,  25331,  24962,  24717,
+     24632,  24716,  24953,  25304,  25715,  26123,  26467,  26695,
+     26775,  26696,  26471,  26136,  25741,  25348,  25015,  24793,
+     24715,  24793,  25015,  25348,  25741,  26136,  26471,  26696,
+     26775,  26695,  26467,  26123,  25715,  25304,  24953,  24716,
+     24632,  24717,  24962,  25331,  25773,  26220,  26605,  26865,
+     26958,  26863,  26589,  26171,  25669,  25157,  24714,  24411,
+     24303,  24415,  24742,  25243,  25852,  26479,  27028,  27406,
+     27543,  27399,  26975,  26315,  25502,  24651,  23894,  23362,
+     23166,  23378,  24018,  25041,  26340,  27747,  29049,  30005,
+     30375,  29939,  28529,  26044,  22469,  17879,  12436,   6379,
+         0,  -6379, -12436, -17879, -22469, -26044, -28529, -29939,
+    -30375, -30005, -29049, -27747, -26340, -25041, -24018, -23378,
+    -23166, -23362, -23894, -24651, -25502, -26315, -26975, -27399,
+    -27543, -27406, -27028, -26479, -25852, -25243, -24742, -24415,
+    -24303, -24411, -24714, -25157, -25669, -26171, -26589, -26863,
+    -26958, -26865, -26605, -26220, -25773, -25331, -24962, -24717,
+    -24632, -24716, -24953, -25304, -25715, -26123, -26467, -26695,
+    -26775, -26696, -26471, -26136, -25741, -25348, -25015, -24793,
+    -24715, -24793, -25015, -25348, -25741, -26136, -26471, -26696,
+    -26775, -26695, -26467, -26123, -25715, -25304, -24953, -24716,
+    -24632, -24717, -24962, -25331, -25773, -26220, -26605, -26865,
+    -26958, -26863, -26589, -26171, -25669, -25157, -24714, -24411,
+    -24303, -24415, -24742, -25243, -25852, -26479, -27028, -27406,
+    -27543, -27399, -26975, -26315, -25502, -24651, -23894, -23362,
+    -23166, -23378, -24018, -25041, -26340, -27747, -29049, -30005,
+    -30375, -29939, -28529, -26044, -22469, -17879, -12436,  -6379
+};
+
+/* Square, harmonics 1..8 */
+static const INT16S waveMipSquare5[256] = {
+         0,   3210,   6380,   9469,  12441,  15260,  17894,  20315,
+     22501,  24432,  26097,  27489,  28605,  29450,  30033,  30369,
+     30476,  30377,  30098,  29667,  29115,  28471,  27768,  27036,
+     26303,  25597,  24941,  24356,  23859,  23463,  23177,  23006,
+     22949,  23004,  23163,  23415,  23748,  24145,  24590,  25064,
+     25549,  26025,  26477,  26887,  27241,  27528,  27739,  27867,
+     27910,  27867,  27743,  27543,  27276,  26953,  26587,  26192,
+     25783,  25377,  24988,  24631,  24318,  24063,  23873,  23756,
+     23717,  23756,  23873,  24063,  24318,  24631,  24988,  25377,
+     25783,  26192,  26587,  26953,  27276,  27543,  27743,  27867,
+     27910,  27867,  27739,  27528,  27241,  26887,  26477,  26025,
+     25549,  25064,  24590,  24145,  23748,  23415,  23163,  23004,
+     22949,  23006,  23177,  23463,  23859,  24356,  24941,  25597,
+     26303,  27036,  27768,  28471,  29115,  29667,  30098,  30377,
+     30476,  30369,  30033,  29450,  28605,  27489,  26097,  24432,
+     22501,  20315,  17894,  15260,  12441,   9469,   6380,   3210,
+         0,  -3210,  -6380,  -9469, -12441, -15260, -17894, -20315,
+    -22501, -24432, -26097, -27489, -28605, -29450, -30033, -30369,
+    -30476, -30377, -30098, -29667, -29115, -28471, -27768, -27036,
+    -26303, -25597, -24941, -24356, -23859, -23463, -23177, -23006,
+    -22949, -23004, -23163, -23415, -23748, -24145, -24590, -25064,
+    -25549, -26025, -26477, -26887, -27241, -27528, -27739, -27867,
+    -27910, -27867, -27743, -27543, -27276, -26953, -26587, -26192,
+    -25783, -25377, -24988, -24631, -24318, -24063, -23873, -23756,
+    -23717, -23756, -23873, -24063, -24318, -24631, -24988, -25377,
+    -25783, -26192, -26587, -26953, -27276, -27543, -27743, -27867,
+    -27910, -27867, -27739, -27528, -27241, -26887, -26477, -26025,
+    -25549, -25064, -24590, -24145, -23748, -23415, -23163, -23004,
+    -22949, -23006, -23177, -23463, -23859, -24356, -24941, -25597,
+    -26303, -27036, -27768, -28471, -29115, -29667, -30098, -30377,
+    -30476, -30369, -30033, -29450, -28605, -27489, -26097, -24432,
+    -22501, -20315, -17894, -15260, -12441,  -9469,  -6380,  -3210
+};
+
+/* Square, harmonics 1..4 */
+static const INT16S waveMipSquare6[256] = {
+         0,   1608,   3210,   4804,   6382,   7942,   9478,  10986,
+     12461,  13899,  15297,  16650,  17955,  19208,  20407,  21549,
+     22630,  23650,  24605,  25494,  26316,  27070,  27755,  28370,
+     28917,  29394,  29803,  30145,  30420,  30630,  30778,  30865,
+     30893,  30866,  30785,  30655,  30478,  30258,  29998,  29703,
+     29376,  29020,  28641,  28242,  27827,  27401,  26967,  26530,
+     26093,  25661,  25236,  24824,  24427,  24049,  23692,  23360,
+     23056,  22781,  22539,  22330,  22157,  22021,  21923,  21864,
+     21845,  21864,  21923,  22021,  22157,  22330,  22539,  22781,
+     23056,  23360,  23692,  24049,  24427,  24824,  25236,  25661,
+     26093,  26530,  26967,  27401,  27827,  28242,  28641,  29020,
+     29376,  29703,  29998,  30258,  30478,  30655,  30785,  30866,
+     30893,  30865,  30778,  30630,  30420,  30145,  29803,  29394,
+     28917,  28370,  27755,  27070,  26316,  25494,  24605,  23650,
+     22630,  21549,  20407,  19208,  17955,  16650,  15297,  13899,
+     12461,  10986,   9478,   7942,   6382,   4804,   3210,   1608,
+         0,  -1608,  -3210,  -4804,  -6382,  -7942,  -9478, -10986,
+    -12461, -13899, -15297, -16650, -17955, -19208, -20407, -21549,
+    -22630, -23650, -24605, -25494, -26316, -27070, -27755, -28370,
+    -28917, -29394, -29803, -30145, -30420, -30630, -30778, -30865,
+    -30893, -30866, -30785, -30655, -30478, -30258, -29998, -29703,
+    -29376, -29020, -28641, -28242, -27827, -27401, -26967, -26530,
+    -26093, -25661, -25236, -24824, -24427, -24049, -23692, -23360,
+    -23056, -22781, -22539, -22330, -22157, -22021, -21923, -21864,
+    -21845, -21864, -21923, -22021, -22157, -22330, -22539, -22781,
+    -23056, -23360, -23692, -24049, -24427, -24824, -25236, -25661,
+    -26093, -26530, -26967, -27401, -27827, -28242, -28641, -29020,
+    -29376, -29703, -29998, -30258, -30478, -30655, -30785, -30866,
+    -30893, -30865, -30778, -30630, -30420, -30145, -29803, -29394,
+    -28917, -28370, -27755, -27070, -26316, -25494, -24605, -23650,
+    -22630, -21549, -20407, -19208, -17955, -16650, -15297, -13899,
+    -12461, -10986,  -9478,  -7942,  -6382,  -4804,  -3210,  -1608
+};
+
+/* Square, harmonics 1..2 */
+static const INT16S waveMipSquare7[256] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+     32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+     27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+     18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+      6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+     -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+     -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804
+};
+
+/* Square, harmonics 1..1 */
+static const INT16S waveMipSquare8[256] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+     32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+     27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+     18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+      6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+     -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+     -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804
+};
+
+const WAVE_MIPMAP WaveMipSquare = {
+    {
+        &waveMipSquare0[0], &waveMipSquare1[0], &waveMipSquare2[0],
+        &waveMipSquare3[0], &waveMipSquare4[0], &waveMipSquare5[0],
+        &waveMipSquare6[0], &waveMipSquare7[0], &waveMipSquare8[0]
+    },
+    {11u, 10u, 9u, 8u, 8u, 8u, 8u, 8u, 8u}
+};
+
+/* Triangle, harmonics 1..256 */
+static const INT16S waveMipTriangle0[2048] = {
+         0,     64,    128,    192,    256,    321,    385,    449,
+       513,    577,    641,    705,    769,    833,    898,    962,
+      1026,   1090,   1154,   1218,   1282,   1346,   1410,   1474,
+      1538,   1602,   1666,   1731,   1795,   1859,   1923,   1987,
+      2051,   2115,   2179,   2243,   2308,   2372,   2436,   2500,
+      2564,   2628,   2692,   2756,   2820,   2885,   2949,   3013,
+      3077,   3141,   3205,   3269,   3333,   3397,   3462,   3526,
+      3590,   3654,   3718,   3782,   3846,   3910,   3974,   4038,
+      4102,   4166,   4230,   4295,   4359,   4423,   4487,   4551,
+      4615,   4679,   4743,   4807,   4872,   4936,   5000,   5064,
+      5128,   5192,   5256,   5320,   5384,   5449,   5513,   5577,
+      5641,   5705,   5769,   5833,   5897,   5961,   6026,   6090,
+      6154,   6218,   6282,   6346,   6410,   6474,   6538,   6602,
+      6666,   6730,   6794,   6858,   6923,   6987,   7051,   7115,
+      7179,   7243,   7307,   7371,   7436,   7500,   7564,   7628,
+      7692,   7756,   7820,   7884,   7948,   8013,   8077,   8141,
+      8205,   8269,   8333,   8397,   8461,   8525,   8590,   8654,
+      8718,   8781,   8846,   8910,   8974,   9038,   9102,   9166,
+      9230,   9294,   9358,   9422,   9487,   9551,   9615,   9679,
+      9743,   9807,   9871,   9935,  10000,  10064,  10128,  10192,
+     10256,  10320,  10384,  10448,  10512,  10577,  10641,  10705,
+     10769,  10833,  10897,  10961,  11025,  11089,  11154,  11218,
+     11282,  11345,  11409,  11474,  11538,  11602,  11666,  11730,
+     11794,  11858,  11922,  11986,  12051,  12115,  12179,  12243,
+     12307,  12371,  12435,  12499,  12564,  12628,  12692,  12756,
+     12820,  12884,  12948,  13012,  13076,  13141,  13205,  13269,
+     13333,  13397,  13461,  13525,  13589,  13653,  13718,  13782,
+     13845,  13909,  13973,  14038,  14102,  14166,  14230,  14294,
+     14358,  14422,  14486,  14550,  14615,  14679,  14743,  14807,
+     14871,  14935,  14999,  15063,  15127,  15192,  15256,  15320,
+     15384,  15448,  15512,  15576,  15640,  15705,  15769,  15833,
+     15897,  15961,  16025,  16089,  16153,  16217,  16282,  16346,
+     16409,  16473,  16537,  16602,  16666,  16730,  16794,  16858,
+     16922,  16986,  17050,  17114,  17179,  17243,  17307,  17371,
+     17435,  17499,  17563,  17627,  17691,  17756,  17820,  17884,
+     17948,  18012,  18076,  18140,  18204,  18269,  18333,  18397,
+     18461,  18525,  18589,  18653,  18717,  18781,  18846,  18910,
+     18973,  19037,  19101,  19166,  19230,  19294,  19358,  19422,
+     19486,  19550,  19614,  19678,  19743,  19807,  19871,  19935,
+     19999,  20063,  20127,  20191,  20255,  20320,  20384,  20448,
+     20512,  20576,  20640,  20704,  20768,  20833,  20897,  20961,
+     21025,  21088,  21152,  21217,  21281,  21345,  21410,  21474,
+     21537,  21601,  21665,  21729,  21794,  21858,  21922,  21986,
+     22050,  22114,  22178,  22242,  22307,  22371,  22435,  22499,
+     22563,  22627,  22691,  22755,  22819,  22884,  22948,  23012,
+     23076,  23140,  23204,  23268,  23332,  23397,  23461,  23525,
+     23589,  23652,  23716,  23781,  23845,  23909,  23974,  24038,
+     24101,  24165,  24229,  24293,  24358,  24422,  24487,  24550,
+     24614,  24678,  24742,  24806,  24871,  24935,  24999,  25063,
+     25127,  25191,  25255,  25319,  25383,  25448,  25512,  25576,
+     25640,  25703,  25767,  25832,  25896,  25961,  26025,  26089,
+     26153,  26216,  26280,  26344,  26409,  26474,  26538,  26602,
+     26665,  26729,  26793,  26857,  26922,  26986,  27051,  27115,
+     27178,  27242,  27306,  27370,  27435,  27499,  27564,  27627,
+     27691,  27754,  27818,  27883,  27947,  28012,  28076,  28140,
+     28204,  28267,  28331,  28395,  28460,  28525,  28589,  28653,
+     28717,  28780,  28844,  28908,  28973,  29038,  29102,  29166,
+     29229,  29293,  29356,  29421,  29486,  29551,  29615,  29679,
+     29742,  29805,  29869,  29933,  29999,  30064,  30128,  30192,
+     30255,  30318,  30381,  30446,  30512,  30577,  30642,  30705,
+     30768,  30830,  30894,  30959,  31024,  31090,  31155,  31218,
+     31280,  31342,  31406,  31471,  31537,  31604,  31669,  31732,
+     31793,  31854,  31917,  31983,  32051,  32119,  32184,  32246,
+     32304,  32363,  32425,  32494,  32569,  32643,  32707,  32751,
+     32767,  32751,  32707,  32643,  32569,  32494,  32425,  32363,
+     32304,  32246,  32184,  32119,  32051,  31983,  31917,  31854,
+     31793,  31732,  31669,  31604,  31537,  31471,  31406,  31342,
+     31280,  31218,  31155,  31090,  31024,  30959,  30894,  30830,
+     30768,  30705,  30642,  30577,  30512,  30446,  30381,  30318,
+     30255,  30192,  30128,  30064,  29999,  29933,  29869,  29805,
+     29742,  29679,  29615,  29551,  29486,  29421,  29356,  29293,
+     29229,  29166,  29102,  29038,  28973,  28908,  28844,  28780,
+     28717,  28653,  28589,  28525,  28460,  28395,  28331,  28267,
+     28204,  28140,  28076,  28012,  27947,  27883,  27818,  27754,
+     27691,  27627,  27564,  27499,  27435,  27370,  27306,  27242,
+     27178,  27115,  27051,  26986,  26922,  26857,  26793,  26729,
+     26665,  26602,  26538,  26474,  26409,  26344,  26280,  26216,
+     26153,  26089,  26025,  25961,  25896,  25832,  25767,  25703,
+     25640,  25576,  25512,  25448,  25383,  25319,  25255,  25191,
+     25127,  25063,  24999,  24935,  24871,  24806,  24742,  24678,
+     24614,  24550,  24487,  24422,  24358,  24293,  24229,  24165,
+     24101,  24038,  23974,  23909,  23845,  23781,  23716,  23652,
+     23589,  23525,  23461,  23397,  23332,  23268,  23204,  23140,
+     23076,  23012,  22948,  22884,  22819,  22755,  22691,  22627,
+     22563,  22499,  22435,  22371,  22307,  22242,  22178,  22114,
+     22050,  21986,  21922,  21858,  21794,  21729,  21665,  21601,
+     21537,  21474,  21410,  21345,  21281,  21217,  21152,  21088,
+     21025,  20961,  20897,  20833,  20768,  20704,  20640,  20576,
+     20512,  20448,  20384,  20320,  20255,  20191,  20127,  20063,
+     19999,  19935,  19871,  19807,  19743,  19678,  19614,  19550,
+     19486,  19422,  19358,  19294,  19230,  19166,  19101,  19037,
+     18973,  18910,  18846,  18781,  18717,  18653,  18589,  18525,
+     18461,  18397,  18333,  18269,  18204,  18140,  18076,  18012,
+     17948,  17884,  17820,  17756,  17691,  17627,  17563,  17499,
+     17435,  17371,  17307,  17243,  17179,  17114,  17050,  16986,
+     16922,  16858,  16794,  16730,  16666,  16602,  16537,  16473,
+     16409,  16346,  16282,  16217,  16153,  16089,  16025,  15961,
+     15897,  15833,  15769,  15705,  15640,  15576,  15512,  15448,
+     15384,  15320,  15256,  15192,  15127,  15063,  14999,  14935,
+     14871,  14807,  14743,  14679,  14615,  14550,  14486,  14422,
+     14358,  14294,  14230,  14166,  14102,  14038,  13973,  13909,
+     13845,  13782,  13718,  13653,  13589,  13525,  13461,  13397,
+     13333,  13269,  13205,  13141,  13076,  13012,  12948,  12884,
+     12820,  12756,  12692,  12628,  12564,  12499,  12435,  12371,
+     12307,  12243,  12179,  12115,  12051,  11986,  11922,  11858,
+     11794,  11730,  11666,  11602,  11538,  11474,  11409,  11345,
+     11282,  11218,  11154,  11089,  11025,  10961,  10897,  10833,
+     10769,  10705,  10641,  10577,  10512,  10448,  10384,  10320,
+     10256,  10192,  10128,  10064,  10000,   9935,   9871,   9807,
+      9743,   9679,   9615,   9551,   9487,   9422,   9358,   9294,
+      9230,   9166,   9102,   9038,   8974,   8910,   8846,   8781,
+      8718,   8654,   8590,   8525,   8461,   8397,   8333,   8269,
+      8205,   8141,   8077,   8013,   7948,   7884,   7820,   7756,
+      7692,   7628,   7564,   7500,   7436,   7371,   7307,   7243,
+      7179,   7115,   7051,   6987,   6923,   6858,   6794,   6730,
+      6666,   6602,   6538,   6474,   6410,   6346,   6282,   6218,
+      6154,   6090,   6026,   5961,   5897,   5833,   5769,   5705,
+      5641,   5577,   5513,   5449,   5384,   5320,   5256,   5192,
+      5128,   5064,   5000,   4936,   4872,   4807,   4743,   4679,
+      4615,   4551,   4487,   4423,   4359,   4295,   4230,   4166,
+      4102,   4038,   3974,   3910,   3846,   3782,   3718,   3654,
+      3590,   3526,   3462,   3397,   3333,   3269,   3205,   3141,
+      3077,   3013,   2949,   2885,   2820,   2756,   2692,   2628,
+      2564,   2500,   2436,   2372,   2308,   2243,   2179,   2115,
+      2051,   1987,   1923,   1859,   1795,   1731,   1666,   1602,
+      1538,   1474,   1410,   1346,   1282,   1218,   1154,   1090,
+      1026,    962,    898,    833,    769,    705,    641,    577,
+       513,    449,    385,    321,    256,    192,    128,     64,
+         0,    -64,   -128,   -192,   -256,   -321,   -385,   -449,
+      -513,   -577,   -641,   -705,   -769,   -833,   -898,   -962,
+     -1026,  -1090,  -1154,  -1218,  -1282,  -1346,  -1410,  -1474,
+     -1538,  -1602,  -1666,  -1731,  -1795,  -1859,  -1923,  -1987,
+     -2051,  -2115,  -2179,  -2243,  -2308,  -2372,  -2436,  -2500,
+     -2564,  -2628,  -2692,  -2756,  -2820,  -2885,  -2949,  -3013,
+     -3077,  -3141,  -3205,  -3269,  -3333,  -3397,  -3462,  -3526,
+     -3590,  -3654,  -3718,  -3782,  -3846,  -3910,  -3974,  -4038,
+     -4102,  -4166,  -4230,  -4295,  -4359,  -4423,  -4487,  -4551,
+     -4615,  -4679,  -4743,  -4807,  -4872,  -4936,  -5000,  -5064,
+     -5128,  -5192,  -5256,  -5320,  -5384,  -5449,  -5513,  -5577,
+     -5641,  -5705,  -5769,  -5833,  -5897,  -5961,  -6026,  -6090,
+     -6154,  -6218,  -6282,  -6346,  -6410,  -6474,  -6538,  -6602,
+     -6666,  -6730,  -6794,  -6858,  -6923,  -6987,  -7051,  -7115,
+     -7179,  -7243,  -7307,  -7371,  -7436,  -7500,  -7564,  -7628,
+     -7692,  -7756,  -7820,  -7884,  -7948,  -8013,  -8077,  -8141,
+     -8205,  -8269,  -8333,  -8397,  -8461,  -8525,  -8590,  -8654,
+     -8718,  -8781,  -8846,  -8910,  -8974,  -9038,  -9102,  -9166,
+     -9230,  -9294,  -9358,  -9422,  -9487,  -9551,  -9615,  -9679,
+     -9743,  -9807,  -9871,  -9935, -10000, -10064, -10128, -10192,
+    -10256, -10320, -10384, -10448, -10512, -10577, -10641, -10705,
+    -10769, -10833, -10897, -10961, -11025, -11089, -11154, -11218,
+    -11282, -11345, -11409, -11474, -11538, -11602, -11666, -11730,
+    -11794, -11858, -11922, -11986, -12051, -12115, -12179, -12243,
+    -12307, -12371, -12435, -12499, -12564, -12628, -12692, -12756,
+    -12820, -12884, -12948, -13012, -13076, -13141, -13205, -13269,
+    -13333, -13397, -13461, -13525, -13589, -13653, -13718, -13782,
+    -13845, -13909, -13973, -14038, -14102, -14166, -14230, -14294,
+    -14358, -14422, -14486, -14550, -14615, -14679, -14743, -14807,
+    -14871, -14935, -14999, -15063, -15127, -15192, -15256, -15320,
+    -15384, -15448, -15512, -15576, -15640, -15705, -15769, -15833,
+    -15897, -15961, -16025, -16089, -16153, -16217, -16282, -16346,
+    -16409, -16473, -16537, -16602, -16666, -16730, -16794, -16858,
+    -16922, -16986, -17050, -17114, -17179, -17243, -17307, -17371,
+    -17435, -17499, -17563, -17627, -17691, -17756, -17820, -17884,
+    -17948, -18012, -18076, -18140, -18204, -18269, -18333, -18397,
+    -18461, -18525, -18589, -18653, -18717, -18781, -18846, -18910,
+    -18973, -19037, -19101, -19166, -19230, -19294, -19358, -19422,
+    -19486, -19550, -19614, -19678, -19743, -19807, -19871, -19935,
+    -19999, -20063, -20127, -20191, -20255, -20320, -20384, -20448,
+    -20512, -20576, -20640, -20704, -20768, -20833, -20897, -20961,
+    -21025, -21088, -21152, -21217, -21281, -21345, -21410, -21474,
+    -21537, -21601, -21665, -21729, -21794, -21858, -21922, -21986,
+    -22050, -22114, -22178, -22242, -22307, -22371, -22435, -22499,
+    -22563, -22627, -22691, -22755, -22819, -22884, -22948, -23012,
+    -23076, -23140, -23204, -23268, -23332, -23397, -23461, -23525,
+    -23589, -23652, -23716, -23781, -23845, -23909, -23974, -24038,
+    -24101, -24165, -24229, -24293, -24358, -24422, -24487, -24550,
+    -24614, -24678, -24742, -24806, -24871, -24935, -24999, -25063,
+    -25127, -25191, -25255, -25319, -25383, -25448, -25512, -25576,
+    -25640, -25703, -25767, -25832, -25896, -25961, -26025, -26089,
+    -26153, -26216, -26280, -26344, -26409, -26474, -26538, -26602,
+    -26665, -26729, -26793, -26857, -26922, -26986, -27051, -27115,
+    -27178, -27242, -27306, -27370, -27435, -27499, -27564, -27627,
+    -27691, -27754, -27818, -27883, -27947, -28012, -28076, -28140,
+    -28204, -28267, -28331, -28395, -28460, -28525, -28589, -28653,
+    -28717, -28780, -28844, -28908, -28973, -29038, -29102, -29166,
+    -29229, -29293, -29356, -29421, -29486, -29551, -29615, -29679,
+    -29742, -29805, -29869, -29933, -29999, -30064, -30128, -30192,
+    -30255, -30318, -30381, -30446, -30512, -30577, -30642, -30705,
+    -30768, -30830, -30894, -30959, -31024, -31090, -31155, -31218,
+    -31280, -31342, -31406, -31471, -31537, -31604, -31669, -31732,
+    -31793, -31854, -31917, -31983, -32051, -32119, -32184, -32246,
+    -32304, -32363, -32425, -32494, -32569, -32643, -32707, -32751,
+    -32767, -32751, -32707, -32643, -32569, -32494, -32425, -32363,
+    -32304, -32246, -32184, -32119, -32051, -31983, -31917, -31854,
+    -31793, -31732, -31669, -31604, -31537, -31471, -31406, -31342,
+    -31280, -31218, -31155, -31090, -31024, -30959, -30894, -30830,
+    -30768, -30705, -30642, -30577, -30512, -30446, -30381, -30318,
+    -30255, -30192, -30128, -30064, -29999, -29933, -29869, -29805,
+    -29742, -29679, -29615, -29551, -29486, -29421, -29356, -29293,
+    -29229, -29166, -29102, -29038, -28973, -28908, -28844, -28780,
+    -28717, -28653, -28589, -28525, -28460, -28395, -28331, -28267,
+    -28204, -28140, -28076, -28012, -27947, -27883, -27818, -27754,
+    -27691, -27627, -27564, -27499, -27435, -27370, -27306, -27242,
+    -27178, -27115, -27051, -26986, -26922, -26857, -26793, -26729,
+    -26665, -26602, -26538, -26474, -26409, -26344, -26280, -26216,
+    -26153, -26089, -26025, -25961, -25896, -25832, -25767, -25703,
+    -25640, -25576, -25512, -25448, -25383, -25319, -25255, -25191,
+    -25127, -25063, -24999, -24935, -24871, -24806, -24742, -24678,
+    -24614, -24550, -24487, -24422, -24358, -24293, -24229, -24165,
+    -24101, -24038, -23974, -23909, -23845, -23781, -23716, -23652,
+    -23589, -23525, -23461, -23397, -23332, -23268, -23204, -23140,
+    -23076, -23012, -22948, -22884, -22819, -22755, -22691, -22627,
+    -22563, -22499, -22435, -22371, -22307, -22242, -22178, -22114,
+    -22050, -21986, -21922, -21858, -21794, -21729, -21665, -21601,
+    -21537, -21474, -21410, -21345, -21281, -21217, -21152, -21088,
+    -21025, -20961, -20897, -20833, -20768, -20704, -20640, -20576,
+    -20512, -20448, -20384, -20320, -20255, -20191, -20127, -20063,
+    -19999, -19935, -19871, -19807, -19743, -19678, -19614, -19550,
+    -19486, -19422, -19358, -19294, -19230, -19166, -19101, -19037,
+    -18973, -18910, -18846, -18781, -18717, -18653, -18589, -18525,
+    -18461, -18397, -18333, -18269, -18204, -18140, -18076, -18012,
+    -17948, -17884, -17820, -17756, -17691, -17627, -17563, -17499,
+    -17435, -17371, -17307, -17243, -17179, -17114, -17050, -16986,
+    -16922, -16858, -16794, -16730, -16666, -16602, -16537, -16473,
+    -16409, -16346, -16282, -16217, -16153, -16089, -16025, -15961,
+    -15897, -15833, -15769, -15705, -15640, -15576, -15512, -15448,
+    -15384, -15320, -15256, -15192, -15127, -15063, -14999, -14935,
+    -14871, -14807, -14743, -14679, -14615, -14550, -14486, -14422,
+    -14358, -14294, -14230, -14166, -14102, -14038, -13973, -13909,
+    -13845, -13782, -13718, -13653, -13589, -13525, -13461, -13397,
+    -13333, -13269, -13205, -13141, -13076, -13012, -12948, -12884,
+    -12820, -12756, -12692, -12628, -12564, -12499, -12435, -12371,
+    -12307, -12243, -12179, -12115, -12051, -11986, -11922, -11858,
+    -11794, -11730, -11666, -11602, -11538, -11474, -11409, -11345,
+    -11282, -11218, -11154, -11089, -11025, -10961, -10897, -10833,
+    -10769, -10705, -10641, -10577, -10512, -10448, -10384, -10320,
+    -10256, -10192, -10128, -10064, -10000,  -9935,  -9871,  -9807,
+     -9743,  -9679,  -9615,  -9551,  -9487,  -9422,  -9358,  -9294,
+     -9230,  -9166,  -9102,  -9038,  -8974,  -8910,  -8846,  -8781,
+     -8718,  -8654,  -8590,  -8525,  -8461,  -8397,  -8333,  -8269,
+     -8205,  -8141,  -8077,  -8013,  -7948,  -7884,  -7820,  -7756,
+     -7692,  -7628,  -7564,  -7500,  -7436,  -7371,  -7307,  -7243,
+     -7179,  -7115,  -7051,  -6987,  -6923,  -6858,  -6794,  -6730,
+     -6666,  -6602,  -6538,  -6474,  -6410,  -6346,  -6282,  -6218,
+     -6154,  -6090,  -6026,  -5961,  -5897,  -5833,  -5769,  -5705,
+     -5641,  -5577,  -5513,  -5449,  -5384,  -5320,  -5256,  -5192,
+     -5128,  -5064,  -5000,  -4936,  -4872,  -4807,  -4743,  -4679,
+     -4615,  -4551,  -4487,  -4423,  -4359,  -4295,  -4230,  -4166,
+     -4102,  -4038,  -3974,  -3910,  -3846,  -3782,  -3718,  -3654,
+     -3590,  -3526,  -3462,  -3397,  -3333,  -3269,  -3205,  -3141,
+     -3077,  -3013,  -2949,  -2885,  -2820,  -2756,  -2692,  -2628,
+     -2564,  -2500,  -2436,  -2372,  -2308,  -2243,  -2179,  -2115,
+     -2051,  -1987,  -1923,  -1859,  -1795,  -1731,  -1666,  -1602,
+     -1538,  -1474,  -1410,  -1346,  -1282,  -1218,  -1154,  -1090,
+     -1026,   -962,   -898,   -833,   -769,   -705,   -641,   -577,
+      -513,   -449,   -385,   -321,   -256,   -192,   -128,    -64
+};
+
+/* Triangle, harmonics 1..128 */
+static const INT16S waveMipTriangle1[1024] = {
+         0,    128,    256,    384,    513,    642,    770,    898,
+      1026,   1153,   1281,   1410,   1538,   1667,   1796,   1924,
+      2051,   2179,   2307,   2435,   2564,   2693,   2821,   2949,
+      3077,   3204,   3332,   3461,   3590,   3718,   3847,   3975,
+      4102,   4230,   4358,   4486,   4615,   4744,   4872,   5000,
+      5128,   5256,   5384,   5512,   5641,   5770,   5898,   6026,
+      6154,   6281,   6409,   6538,   6666,   6795,   6924,   7052,
+      7179,   7307,   7435,   7563,   7692,   7821,   7949,   8077,
+      8205,   8332,   8460,   8589,   8718,   8846,   8975,   9103,
+      9230,   9358,   9486,   9614,   9743,   9872,  10000,  10128,
+     10256,  10383,  10511,  10640,  10769,  10898,  11026,  11154,
+     11282,  11409,  11537,  11665,  11794,  11923,  12052,  12180,
+     12307,  12435,  12563,  12691,  12820,  12949,  13077,  13205,
+     13333,  13460,  13588,  13717,  13846,  13974,  14103,  14231,
+     14358,  14486,  14614,  14742,  14871,  15000,  15129,  15256,
+     15384,  15511,  15639,  15768,  15897,  16026,  16154,  16282,
+     16409,  16537,  16665,  16793,  16922,  17051,  17180,  17308,
+     17435,  17562,  17690,  17819,  17948,  18077,  18206,  18333,
+     18461,  18588,  18716,  18844,  18973,  19103,  19231,  19359,
+     19486,  19613,  19741,  19870,  19999,  20128,  20257,  20385,
+     20512,  20639,  20767,  20895,  21025,  21154,  21283,  21410,
+     21537,  21664,  21792,  21921,  22050,  22180,  22308,  22436,
+     22563,  22690,  22818,  22946,  23076,  23205,  23334,  23462,
+     23589,  23715,  23843,  23972,  24101,  24231,  24360,  24487,
+     24614,  24741,  24868,  24997,  25127,  25257,  25386,  25513,
+     25640,  25766,  25894,  26023,  26153,  26283,  26412,  26539,
+     26665,  26791,  26919,  27048,  27178,  27309,  27438,  27565,
+     27691,  27817,  27944,  28073,  28204,  28335,  28464,  28591,
+     28716,  28842,  28969,  29098,  29230,  29361,  29491,  29617,
+     29742,  29866,  29993,  30123,  30256,  30389,  30519,  30644,
+     30767,  30889,  31015,  31147,  31283,  31418,  31549,  31672,
+     31789,  31906,  32031,  32169,  32318,  32466,  32595,  32684,
+     32715,  32684,  32595,  32466,  32318,  32169,  32031,  31906,
+     31789,  31672,  31549,  31418,  31283,  31147,  31015,  30889,
+     30767,  30644,  30519,  30389,  30256,  30123,  29993,  29866,
+     29742,  29617,  29491,  29361,  29230,  29098,  28969,  28842,
+     28716,  28591,  28464,  28335,  28204,  28073,  27944,  27817,
+     27691,  27565,  27438,  27309,  27178,  27048,  26919,  26791,
+     26665,  26539,  26412,  26283,  26153,  26023,  25894,  25766,
+     25640,  25513,  25386,  25257,  25127,  24997,  24868,  24741,
+     24614,  24487,  24360,  24231,  24101,  23972,  23843,  23715,
+     23589,  23462,  23334,  23205,  23076,  22946,  22818,  22690,
+     22563,  22436,  22308,  22180,  22050,  21921,  21792,  21664,
+     21537,  21410,  21283,  21154,  21025,  20895,  20767,  20639,
+     20512,  20385,  20257,  20128,  19999,  19870,  19741,  19613,
+     19486,  19359,  19231,  19103,  18973,  18844,  18716,  18588,
+     18461,  18333,  18206,  18077,  17948,  17819,  17690,  17562,
+     17435,  17308,  17180,  17051,  16922,  16793,  16665,  16537,
+     16409,  16282,  16154,  16026,  15897,  15768,  15639,  15511,
+     15384,  15256,  15129,  15000,  14871,  14742,  14614,  14486,
+     14358,  14231,  14103,  13974,  13846,  13717,  13588,  13460,
+     13333,  13205,  13077,  12949,  12820,  12691,  12563,  12435,
+     12307,  12180,  12052,  11923,  11794,  11665,  11537,  11409,
+     11282,  11154,  11026,  10898,  10769,  10640,  10511,  10383,
+     10256,  10128,  10000,   9872,   9743,   9614,   9486,   9358,
+      9230,   9103,   8975,   8846,   8718,   8589,   8460,   8332,
+      8205,   8077,   7949,   7821,   7692,   7563,   7435,   7307,
+      7179,   7052,   6924,   6795,   6666,   6538,   6409,   6281,
+      6154,   6026,   5898,   5770,   5641,   5512,   5384,   5256,
+      5128,   5000,   4872,   4744,   4615,   4486,   4358,   4230,
+      4102,   3975,   3847,   3718,   3590,   3461,   3332,   3204,
+      3077,   2949,   2821,   2693,   2564,   2435,   2307,   2179,
+      2051,   1924,   1796,   1667,   1538,   1410,   1281,   1153,
+      1026,    898,    770,    642,    513,    384,    256,    128,
+         0,   -128,   -256,   -384,   -513,   -642,   -770,   -898,
+     -1026,  -1153,  -1281,  -1410,  -1538,  -1667,  -1796,  -1924,
+     -2051,  -2179,  -2307,  -2435,  -2564,  -2693,  -2821,  -2949,
+     -3077,  -3204,  -3332,  -3461,  -3590,  -3718,  -3847,  -3975,
+     -4102,  -4230,  -4358,  -4486,  -4615,  -4744,  -4872,  -5000,
+     -5128,  -5256,  -5384,  -5512,  -5641,  -5770,  -5898,  -6026,
+     -6154,  -6281,  -6409,  -6538,  -6666,  -6795,  -6924,  -7052,
+     -7179,  -7307,  -7435,  -7563,  -7692,  -7821,  -7949,  -8077,
+     -8205,  -8332,  -8460,  -8589,  -8718,  -8846,  -8975,  -9103,
+     -9230,  -9358,  -9486,  -9614,  -9743,  -9872, -10000, -10128,
+    -10256, -10383, -10511, -10640, -10769, -10898, -11026, -11154,
+    -11282, -11409, -11537, -11665, -11794, -11923, -12052, -12180,
+    -12307, -12435, -12563, -12691, -12820, -12949, -13077, -13205,
+    -13333, -13460, -13588, -13717, -13846, -13974, -14103, -14231,
+    -14358, -14486, -14614, -14742, -14871, -15000, -15129, -15256,
+    -15384, -15511, -15639, -15768, -15897, -16026, -16154, -16282,
+    -16409, -16537, -16665, -16793, -16922, -17051, -17180, -17308,
+    -17435, -17562, -17690, -17819, -17948, -18077, -18206, -18333,
+    -18461, -18588, -18716, -18844, -18973, -19103, -19231, -19359,
+    -19486, -19613, -19741, -19870, -19999, -20128, -20257, -20385,
+    -20512, -20639, -20767, -20895, -21025, -21154, -21283, -21410,
+    -21537, -21664, -21792, -21921, -22050, -22180, -22308, -22436,
+    -22563, -22690, -22818, -22946, -23076, -23205, -23334, -23462,
+    -23589, -23715, -23843, -23972, -24101, -24231, -24360, -24487,
+    -24614, -24741, -24868, -24997, -25127, -25257, -25386, -25513,
+    -25640, -25766, -25894, -26023, -26153, -26283, -26412, -26539,
+    -26665, -26791, -26919, -27048, -27178, -27309, -27438, -27565,
+    -27691, -27817, -27944, -28073, -28204, -28335, -28464, -28591,
+    -28716, -28842, -28969, -29098, -29230, -29361, -29491, -29617,
+    -29742, -29866, -29993, -30123, -30256, -30389, -30519, -30644,
+    -30767, -30889, -31015, -31147, -31283, -31418, -31549, -31672,
+    -31789, -31906, -32031, -32169, -32318, -32466, -32595, -32684,
+    -32715, -32684, -32595, -32466, -32318, -32169, -32031, -31906,
+    -31789, -31672, -31549, -31418, -31283, -31147, -31015, -30889,
+    -30767, -30644, -30519, -30389, -30256, -30123, -29993, -29866,
+    -29742, -29617, -29491, -29361, -29230, -29098, -28969, -28842,
+    -28716, -28591, -28464, -28335, -28204, -28073, -27944, -27817,
+    -27691, -27565, -27438, -27309, -27178, -27048, -26919, -26791,
+    -26665, -26539, -26412, -26283, -26153, -26023, -25894, -25766,
+    -25640, -25513, -25386, -25257, -25127, -24997, -24868, -24741,
+    -24614, -24487, -24360, -24231, -24101, -23972, -23843, -23715,
+    -23589, -23462, -23334, -23205, -23076, -22946, -22818, -22690,
+    -22563, -22436, -22308, -22180, -22050, -21921, -21792, -21664,
+    -21537, -21410, -21283, -21154, -21025, -20895, -20767, -20639,
+    -20512, -20385, -20257, -20128, -19999, -19870, -19741, -19613,
+    -19486, -19359, -19231, -19103, -18973, -18844, -18716, -18588,
+    -18461, -18333, -18206, -18077, -17948, -17819, -17690, -17562,
+    -17435, -17308, -17180, -17051, -16922, -16793, -16665, -16537,
+    -16409, -16282, -16154, -16026, -15897, -15768, -15639, -15511,
+    -15384, -15256, -15129, -15000, -14871, -14742, -14614, -14486,
+    -14358, -14231, -14103, -13974, -13846, -13717, -13588, -13460,
+    -13333, -13205, -13077, -12949, -12820, -12691, -12563, -12435,
+    -12307, -12180, -12052, -11923, -11794, -11665, -11537, -11409,
+    -11282, -11154, -11026, -10898, -10769, -10640, -10511, -10383,
+    -10256, -10128, -10000,  -9872,  -9743,  -9614,  -9486,  -9358,
+     -9230,  -9103,  -8975,  -8846,  -8718,  -8589,  -8460,  -8332,
+     -8205,  -8077,  -7949,  -7821,  -7692,  -7563,  -7435,  -7307,
+     -7179,  -7052,  -6924,  -6795,  -6666,  -6538,  -6409,  -6281,
+     -6154,  -6026,  -5898,  -5770,  -5641,  -5512,  -5384,  -5256,
+     -5128,  -5000,  -4872,  -4744,  -4615,  -4486,  -4358,  -4230,
+     -4102,  -3975,  -3847,  -3718,  -3590,  -3461,  -3332,  -3204,
+     -3077,  -2949,  -2821,  -2693,  -2564,  -2435,  -2307,  -2179,
+     -2051,  -1924,  -1796,  -1667,  -1538,  -1410,  -1281,  -1153,
+     -1026,   -898,   -770,   -642,   -513,   -384,   -256,   -128
+};
+
+/* Triangle, harmonics 1..64 */
+static const INT16S waveMipTriangle2[512] = {
+         0,    254,    510,    767,   1026,   1284,   1542,   1797,
+      2051,   2305,   2561,   2818,   3077,   3336,   3593,   3848,
+      4102,   4356,   4612,   4869,   5128,   5387,   5644,   5900,
+      6154,   6408,   6663,   6920,   7179,   7438,   7695,   7951,
+      8205,   8459,   8714,   8971,   9230,   9489,   9747,  10002,
+     10256,  10510,  10765,  11023,  11282,  11541,  11798,  12053,
+     12307,  12561,  12816,  13074,  13333,  13592,  13850,  14105,
+     14358,  14612,  14867,  15125,  15384,  15644,  15901,  16156,
+     16409,  16662,  16918,  17175,  17435,  17695,  17953,  18208,
+     18460,  18713,  18968,  19226,  19486,  19747,  20005,  20259,
+     20512,  20764,  21019,  21277,  21538,  21799,  22057,  22311,
+     22563,  22814,  23069,  23327,  23589,  23851,  24109,  24363,
+     24614,  24864,  25118,  25377,  25641,  25904,  26163,  26416,
+     26664,  26913,  27166,  27427,  27693,  27958,  28218,  28469,
+     28714,  28959,  29211,  29475,  29746,  30018,  30279,  30525,
+     30759,  30993,  31244,  31520,  31818,  32114,  32371,  32548,
+     32611,  32548,  32371,  32114,  31818,  31520,  31244,  30993,
+     30759,  30525,  30279,  30018,  29746,  29475,  29211,  28959,
+     28714,  28469,  28218,  27958,  27693,  27427,  27166,  26913,
+     26664,  26416,  26163,  25904,  25641,  25377,  25118,  24864,
+     24614,  24363,  24109,  23851,  23589,  23327,  23069,  22814,
+     22563,  22311,  22057,  21799,  21538,  21277,  21019,  20764,
+     20512,  20259,  20005,  19747,  19486,  19226,  18968,  18713,
+     18460,  18208,  17953,  17695,  17435,  17175,  16918,  16662,
+     16409,  16156,  15901,  15644,  15384,  15125,  14867,  14612,
+     14358,  14105,  13850,  13592,  13333,  13074,  12816,  12561,
+     12307,  12053,  11798,  11541,  11282,  11023,  10765,  10510,
+     10256,  10002,   9747,   9489,   9230,   8971,   8714,   8459,
+      8205,   7951,   7695,   7438,   7179,   6920,   6663,   6408,
+      6154,   5900,   5644,   5387,   5128,   4869,   4612,   4356,
+      4102,   3848,   3593,   3336,   3077,   2818,   2561,   2305,
+      2051,   1797,   1542,   1284,   1026,    767,    510,    254,
+         0,   -254,   -510,   -767,  -1026,  -1284,  -1542,  -1797,
+     -2051,  -2305,  -2561,  -2818,  -3077,  -3336,  -3593,  -3848,
+     -4102,  -4356,  -4612,  -4869,  -5128,  -5387,  -5644,  -5900,
+     -6154,  -6408,  -6663,  -6920,  -7179,  -7438,  -7695,  -7951,
+     -8205,  -8459,  -8714,  -8971,  -9230,  -9489,  -9747, -10002,
+    -10256, -10510, -10765, -11023, -11282, -11541, -11798, -12053,
+    -12307, -12561, -12816, -13074, -13333, -13592, -13850, -14105,
+    -14358, -14612, -14867, -15125, -15384, -15644, -15901, -16156,
+    -16409, -16662, -16918, -17175, -17435, -17695, -17953, -18208,
+    -18460, -18713, -18968, -19226, -19486, -19747, -20005, -20259,
+    -20512, -20764, -21019, -21277, -21538, -21799, -22057, -22311,
+    -22563, -22814, -23069, -23327, -23589, -23851, -24109, -24363,
+    -24614, -24864, -25118, -25377, -25641, -25904, -26163, -26416,
+    -26664, -26913, -27166, -27427, -27693, -27958, -28218, -28469,
+    -28714, -28959, -29211, -29475, -29746, -30018, -30279, -30525,
+    -30759, -30993, -31244, -31520, -31818, -32114, -32371, -32548,
+    -32611, -32548, -32371, -32114, -31818, -31520, -31244, -30993,
+    -30759, -30525, -30279, -30018, -29746, -29475, -29211, -28959,
+    -28714, -28469, -28218, -27958, -27693, -27427, -27166, -26913,
+    -26664, -26416, -26163, -25904, -25641, -25377, -25118, -24864,
+    -24614, -24363, -24109, -23851, -23589, -23327, -23069, -22814,
+    -22563, -22311, -22057, -21799, -21538, -21277, -21019, -20764,
+    -20512, -20259, -20005, -19747, -19486, -19226, -18968, -18713,
+    -18460, -18208, -17953, -17695, -17435, -17175, -16918, -16662,
+    -16409, -16156, -15901, -15644, -15384, -15125, -14867, -14612,
+    -14358, -14105, -13850, -13592, -13333, -13074, -12816, -12561,
+    -12307, -12053, -11798, -11541, -11282, -11023, -10765, -10510,
+    -10256, -10002,  -9747,  -9489,  -9230,  -8971,  -8714,  -8459,
+     -8205,  -7951,  -7695,  -7438,  -7179,  -6920,  -6663,  -6408,
+     -6154,  -5900,  -5644,  -5387,  -5128,  -4869,  -4612,  -4356,
+     -4102,  -3848,  -3593,  -3336,  -3077,  -2818,  -2561,  -2305,
+     -2051,  -1797,  -1542,  -1284,  -1026,   -767,   -510,   -254
+};
+
+/* Triangle, harmonics 1..32 */
+static const INT16S waveMipTriangle3[256] = {
+         0,    504,   1013,   1529,   2051,   2573,   3090,   3599,
+      4102,   4606,   5115,   5631,   6154,   6676,   7193,   7702,
+      8204,   8707,   9216,   9733,  10256,  10780,  11297,  11805,
+     12306,  12808,  13317,  13834,  14359,  14884,  15401,  15909,
+     16408,  16908,  17416,  17935,  18462,  18989,  19508,  20013,
+     20510,  21006,  21513,  22034,  22566,  23098,  23618,  24120,
+     24609,  25099,  25603,  26130,  26674,  27217,  27740,  28232,
+     28700,  29168,  29668,  30221,  30816,  31409,  31924,  32277,
+     32403,  32277,  31924,  31409,  30816,  30221,  29668,  29168,
+     28700,  28232,  27740,  27217,  26674,  26130,  25603,  25099,
+     24609,  24120,  23618,  23098,  22566,  22034,  21513,  21006,
+     20510,  20013,  19508,  18989,  18462,  17935,  17416,  16908,
+     16408,  15909,  15401,  14884,  14359,  13834,  13317,  12808,
+     12306,  11805,  11297,  10780,  10256,   9733,   9216,   8707,
+      8204,   7702,   7193,   6676,   6154,   5631,   5115,   4606,
+      4102,   3599,   3090,   2573,   2051,   1529,   1013,    504,
+         0,   -504,  -1013,  -1529,  -2051,  -2573,  -3090,  -3599,
+     -4102,  -4606,  -5115,  -5631,  -6154,  -6676,  -7193,  -7702,
+     -8204,  -8707,  -9216,  -9733, -10256, -10780, -11297, -11805,
+    -12306, -12808, -13317, -13834, -14359, -14884, -15401, -15909,
+    -16408, -16908, -17416, -17935, -18462, -18989, -19508, -20013,
+    -20510, -21006, -21513, -22034, -22566, -23098, -23618, -24120,
+    -24609, -25099, -25603, -26130, -26674, -27217, -27740, -28232,
+    -28700, -29168, -29668, -30221, -30816, -31409, -31924, -32277,
+    -32403, -32277, -31924, -31409, -30816, -30221, -29668, -29168,
+    -28700, -28232, -27740, -27217, -26674, -26130, -25603, -25099,
+    -24609, -24120, -23618, -23098, -22566, -22034, -21513, -21006,
+    -20510, -20013, -19508, -18989, -18462, -17935, -17416, -16908,
+    -16408, -15909, -15401, -14884, -14359, -13834, -13317, -12808,
+    -12306, -11805, -11297, -10780, -10256,  -9733,  -9216,  -8707,
+     -8204,  -7702,  -7193,  -6676,  -6154,  -5631,  -5115,  -4606,
+     -4102,  -3599,  -3090,  -2573,  -2051,  -1529,  -1013,   -504
+};
+
+/* Triangle, harmonics 1..16 */
+static const INT16S waveMipTriangle4[256] = {
+         0,    493,    989,   1491,   2000,   2516,   3041,   3571,
+      4104,   4637,   5166,   5691,   6207,   6715,   7216,   7711,
+      8202,   8693,   9188,   9689,  10198,  10716,  11243,  11776,
+     12312,  12849,  13381,  13907,  14424,  14930,  15427,  15916,
+     16401,  16886,  17375,  17873,  18382,  18904,  19437,  19979,
+     20527,  21075,  21617,  22149,  22665,  23165,  23648,  24118,
+     24581,  25044,  25516,  26004,  26516,  27054,  27621,  28210,
+     28813,  29415,  29999,  30545,  31030,  31433,  31737,  31925,
+     31989,  31925,  31737,  31433,  31030,  30545,  29999,  29415,
+     28813,  28210,  27621,  27054,  26516,  26004,  25516,  25044,
+     24581,  24118,  23648,  23165,  22665,  22149,  21617,  21075,
+     20527,  19979,  19437,  18904,  18382,  17873,  17375,  16886,
+     16401,  15916,  15427,  14930,  14424,  13907,  13381,  12849,
+     12312,  11776,  11243,  10716,  10198,   9689,   9188,   8693,
+      8202,   7711,   7216,   6715,   6207,   5691,   5166,   4637,
+      4104,   3571,   3041,   2516,   2000,   1491,    989,    493,
+         0,   -493,   -989,  -1491,  -2000,  -2516,  -3041,  -3571,
+     -4104,  -4637,  -5166,  -5691,  -6207,  -6715,  -7216,  -7711,
+     -8202,  -8693,  -9188,  -9689, -10198, -10716, -11243, -11776,
+    -12312, -12849, -13381, -13907, -14424, -14930, -15427, -15916,
+    -16401, -16886, -17375, -17873, -18382, -18904, -19437, -19979,
+    -20527, -21075, -21617, -22149, -22665, -23165, -23648, -24118,
+    -24581, -25044, -25516, -26004, -26516, -27054, -27621, -28210,
+    -28813, -29415, -29999, -30545, -31030, -31433, -31737, -31925,
+    -31989, -31925, -31737, -31433, -31030, -30545, -29999, -29415,
+    -28813, -28210, -27621, -27054, -26516, -26004, -25516, -25044,
+    -24581, -24118, -23648, -23165, -22665, -22149, -21617, -21075,
+    -20527, -19979, -19437, -18904, -18382, -17873, -17375, -16886,
+    -16401, -15916, -15427, -14930, -14424, -13907, -13381, -12849,
+    -12312, -11776, -11243, -10716, -10198,  -9689,  -9188,  -8693,
+     -8202,  -7711,  -7216,  -6715,  -6207,  -5691,  -5166,  -4637,
+     -4104,  -3571,  -3041,  -2516,  -2000,  -1491,   -989,   -493
+};
+
+/* Triangle, harmonics 1..8 */
+static const INT16S waveMipTriangle5[256] = {
+         0,    473,    947,   1425,   1907,   2394,   2889,   3390,
+      3900,   4418,   4944,   5477,   6017,   6564,   7115,   7669,
+      8225,   8781,   9335,   9885,  10431,  10971,  11502,  12025,
+     12539,  13044,  13538,  14024,  14501,  14971,  15434,  15894,
+     16352,  16810,  17269,  17734,  18205,  18685,  19176,  19680,
+     20197,  20728,  21274,  21835,  22409,  22994,  23590,  24193,
+     24799,  25406,  26008,  26601,  27180,  27739,  28274,  28778,
+     29246,  29673,  30054,  30384,  30661,  30879,  31037,  31133,
+     31165,  31133,  31037,  30879,  30661,  30384,  30054,  29673,
+     29246,  28778,  28274,  27739,  27180,  26601,  26008,  25406,
+     24799,  24193,  23590,  22994,  22409,  21835,  21274,  20728,
+     20197,  19680,  19176,  18685,  18205,  17734,  17269,  16810,
+     16352,  15894,  15434,  14971,  14501,  14024,  13538,  13044,
+     12539,  12025,  11502,  10971,  10431,   9885,   9335,   8781,
+      8225,   7669,   7115,   6564,   6017,   5477,   4944,   4418,
+      3900,   3390,   2889,   2394,   1907,   1425,    947,    473,
+         0,   -473,   -947,  -1425,  -1907,  -2394,  -2889,  -3390,
+     -3900,  -4418,  -4944,  -5477,  -6017,  -6564,  -7115,  -7669,
+     -8225,  -8781,  -9335,  -9885, -10431, -10971, -11502, -12025,
+    -12539, -13044, -13538, -14024, -14501, -14971, -15434, -15894,
+    -16352, -16810, -17269, -17734, -18205, -18685, -19176, -19680,
+    -20197, -20728, -21274, -21835, -22409, -22994, -23590, -24193,
+    -24799, -25406, -26008, -26601, -27180, -27739, -28274, -28778,
+    -29246, -29673, -30054, -30384, -30661, -30879, -31037, -31133,
+    -31165, -31133, -31037, -30879, -30661, -30384, -30054, -29673,
+    -29246, -28778, -28274, -27739, -27180, -26601, -26008, -25406,
+    -24799, -24193, -23590, -22994, -22409, -21835, -21274, -20728,
+    -20197, -19680, -19176, -18685, -18205, -17734, -17269, -16810,
+    -16352, -15894, -15434, -14971, -14501, -14024, -13538, -13044,
+    -12539, -12025, -11502, -10971, -10431,  -9885,  -9335,  -8781,
+     -8225,  -7669,  -7115,  -6564,  -6017,  -5477,  -4944,  -4418,
+     -3900,  -3390,  -2889,  -2394,  -1907,  -1425,   -947,   -473
+};
+
+/* Triangle, harmonics 1..4 */
+static const INT16S waveMipTriangle6[256] = {
+         0,    435,    872,   1309,   1749,   2193,   2640,   3091,
+      3548,   4010,   4479,   4954,   5437,   5928,   6427,   6934,
+      7449,   7974,   8507,   9048,   9599,  10157,  10724,  11298,
+     11880,  12469,  13064,  13664,  14269,  14879,  15491,  16105,
+     16720,  17336,  17950,  18562,  19170,  19774,  20371,  20961,
+     21542,  22113,  22672,  23219,  23751,  24267,  24766,  25247,
+     25708,  26148,  26567,  26961,  27332,  27677,  27995,  28286,
+     28549,  28782,  28986,  29160,  29302,  29414,  29494,  29542,
+     29558,  29542,  29494,  29414,  29302,  29160,  28986,  28782,
+     28549,  28286,  27995,  27677,  27332,  26961,  26567,  26148,
+     25708,  25247,  24766,  24267,  23751,  23219,  22672,  22113,
+     21542,  20961,  20371,  19774,  19170,  18562,  17950,  17336,
+     16720,  16105,  15491,  14879,  14269,  13664,  13064,  12469,
+     11880,  11298,  10724,  10157,   9599,   9048,   8507,   7974,
+      7449,   6934,   6427,   5928,   5437,   4954,   4479,   4010,
+      3548,   3091,   2640,   2193,   1749,   1309,    872,    435,
+         0,   -435,   -872,  -1309,  -1749,  -2193,  -2640,  -3091,
+     -3548,  -4010,  -4479,  -4954,  -5437,  -5928,  -6427,  -6934,
+     -7449,  -7974,  -8507,  -9048,  -9599, -10157, -10724, -11298,
+    -11880, -12469, -13064, -13664, -14269, -14879, -15491, -16105,
+    -16720, -17336, -17950, -18562, -19170, -19774, -20371, -20961,
+    -21542, -22113, -22672, -23219, -23751, -24267, -24766, -25247,
+    -25708, -26148, -26567, -26961, -27332, -27677, -27995, -28286,
+    -28549, -28782, -28986, -29160, -29302, -29414, -29494, -29542,
+    -29558, -29542, -29494, -29414, -29302, -29160, -28986, -28782,
+    -28549, -28286, -27995, -27677, -27332, -26961, -26567, -26148,
+    -25708, -25247, -24766, -24267, -23751, -23219, -22672, -22113,
+    -21542, -20961, -20371, -19774, -19170, -18562, -17950, -17336,
+    -16720, -16105, -15491, -14879, -14269, -13664, -13064, -12469,
+    -11880, -11298, -10724, -10157,  -9599,  -9048,  -8507,  -7974,
+     -7449,  -6934,  -6427,  -5928,  -5437,  -4954,  -4479,  -4010,
+     -3548,  -3091,  -2640,  -2193,  -1749,  -1309,   -872,   -435
+};
+
+/* Triangle, harmonics 1..2 */
+static const INT16S waveMipTriangle7[256] = {
+         0,    653,   1305,   1957,   2607,   3256,   3903,   4548,
+      5190,   5829,   6464,   7095,   7722,   8345,   8962,   9574,
+     10180,  10780,  11374,  11961,  12540,  13112,  13676,  14232,
+     14779,  15318,  15847,  16366,  16876,  17376,  17865,  18343,
+     18810,  19266,  19711,  20143,  20564,  20972,  21367,  21749,
+     22119,  22475,  22817,  23146,  23461,  23762,  24048,  24320,
+     24577,  24820,  25047,  25259,  25457,  25638,  25805,  25956,
+     26091,  26210,  26314,  26402,  26474,  26530,  26570,  26594,
+     26602,  26594,  26570,  26530,  26474,  26402,  26314,  26210,
+     26091,  25956,  25805,  25638,  25457,  25259,  25047,  24820,
+     24577,  24320,  24048,  23762,  23461,  23146,  22817,  22475,
+     22119,  21749,  21367,  20972,  20564,  20143,  19711,  19266,
+     18810,  18343,  17865,  17376,  16876,  16366,  15847,  15318,
+     14779,  14232,  13676,  13112,  12540,  11961,  11374,  10780,
+     10180,   9574,   8962,   8345,   7722,   7095,   6464,   5829,
+      5190,   4548,   3903,   3256,   2607,   1957,   1305,    653,
+         0,   -653,  -1305,  -1957,  -2607,  -3256,  -3903,  -4548,
+     -5190,  -5829,  -6464,  -7095,  -7722,  -8345,  -8962,  -9574,
+    -10180, -10780, -11374, -11961, -12540, -13112, -13676, -14232,
+    -14779, -15318, -15847, -16366, -16876, -17376, -17865, -18343,
+    -18810, -19266, -19711, -20143, -20564, -20972, -21367, -21749,
+    -22119, -22475, -22817, -23146, -23461, -23762, -24048, -24320,
+    -24577, -24820, -25047, -25259, -25457, -25638, -25805, -25956,
+    -26091, -26210, -26314, -26402, -26474, -26530, -26570, -26594,
+    -26602, -26594, -26570, -26530, -26474, -26402, -26314, -26210,
+    -26091, -25956, -25805, -25638, -25457, -25259, -25047, -24820,
+    -24577, -24320, -24048, -23762, -23461, -23146, -22817, -22475,
+    -22119, -21749, -21367, -20972, -20564, -20143, -19711, -19266,
+    -18810, -18343, -17865, -17376, -16876, -16366, -15847, -15318,
+    -14779, -14232, -13676, -13112, -12540, -11961, -11374, -10780,
+    -10180,  -9574,  -8962,  -8345,  -7722,  -7095,  -6464,  -5829,
+     -5190,  -4548,  -3903,  -3256,  -2607,  -1957,  -1305,   -653
+};
+
+/* Triangle, harmonics 1..1 */
+static const INT16S waveMipTriangle8[256] = {
+         0,    653,   1305,   1957,   2607,   3256,   3903,   4548,
+      5190,   5829,   6464,   7095,   7722,   8345,   8962,   9574,
+     10180,  10780,  11374,  11961,  12540,  13112,  13676,  14232,
+     14779,  15318,  15847,  16366,  16876,  17376,  17865,  18343,
+     18810,  19266,  19711,  20143,  20564,  20972,  21367,  21749,
+     22119,  22475,  22817,  23146,  23461,  23762,  24048,  24320,
+     24577,  24820,  25047,  25259,  25457,  25638,  25805,  25956,
+     26091,  26210,  26314,  26402,  26474,  26530,  26570,  26594,
+     26602,  26594,  26570,  26530,  26474,  26402,  26314,  26210,
+     26091,  25956,  25805,  25638,  25457,  25259,  25047,  24820,
+     24577,  24320,  24048,  23762,  23461,  23146,  22817,  22475,
+     22119,  21749,  21367,  20972,  20564,  20143,  19711,  19266,
+     18810,  18343,  17865,  17376,  16876,  16366,  15847,  15318,
+     14779,  14232,  13676,  13112,  12540,  11961,  11374,  10780,
+     10180,   9574,   8962,   8345,   7722,   7095,   6464,   5829,
+      5190,   4548,   3903,   3256,   2607,   1957,   1305,    653,
+         0,   -653,  -1305,  -1957,  -2607,  -3256,  -3903,  -4548,
+     -5190,  -5829,  -6464,  -7095,  -7722,  -8345,  -8962,  -9574,
+    -10180, -10780, -11374, -11961, -12540, -13112, -13676, -14232,
+    -14779, -15318, -15847, -16366, -16876, -17376, -17865, -18343,
+    -18810, -19266, -19711, -20143, -20564, -20972, -21367, -21749,
+    -22119, -22475, -22817, -23146, -23461, -23762, -24048, -24320,
+    -24577, -24820, -25047, -25259, -25457, -25638, -25805, -25956,
+    -26091, -26210, -26314, -26402, -26474, -26530, -26570, -26594,
+    -26602, -26594, -26570, -26530, -26474, -26402, -26314, -26210,
+    -26091, -25956, -25805, -25638, -25457, -25259, -25047, -24820,
+    -24577, -24320, -24048, -23762, -23461, -23146, -22817, -22475,
+    -22119, -21749, -21367, -20972, -20564, -20143, -19711, -19266,
+    -18810, -18343, -17865, -17376, -16876, -16366, -15847, -15318,
+    -14779, -14232, -13676, -13112, -12540, -11961, -11374, -10780,
+    -10180,  -9574,  -8962,  -8345,  -7722,  -7095,  -6464,  -5829,
+     -5190,  -4548,  -3903,  -3256,  -2607,  -1957,  -1305,   -653
+};
+
+const WAVE_MIPMAP WaveMipTriangle = {
+    {
+        &waveMipTriangle0[0], &waveMipTriangle1[0], &waveMipTriangle2[0],
+        &waveMipTriangle3[0], &waveMipTriangle4[0], &waveMipTriangle5[0],
+        &waveMipTriangle6[0], &waveMipTriangle7[0], &waveMipTriangle8[0]
+    },
+    {11u, 10u, 9u, 8u, 8u, 8u, 8u, 8u, 8u}
+};
@@ -0,0 +1,100 @@
+/****************************************************************************
+ * WaveMod.c
+ * AM and FM of a WaveGen.c generator by a sine LFO. The LFO is looked up
+ * once per block, at the block end, and the value is ramped linearly from
+ * the previous block end across the block. AM costs one multiply per
+ * sample on top of the generator. FM of a sine is a linear sweep of the
+ * phase step across the block through DDSSineSweepLin(), other shapes get
+ * one averaged step per block. The ramps are only close to the LFO when it
+ * is well below the block rate, WAVE_PLAN_BLOCK_RATE in WavePlan.h.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveGen.h"
+#include "WaveMod.h"
+
+#define WAVE_MOD_ONE_Q15    32768
+#define WAVE_MOD_FM_MAX_DEV 0x3FFFFFFFu     /* phase step, just under sample_rate/4 */
+
+/****************************************************************************
+ * WaveModStart() - Public
+ * Sets up mod at sample_rate. rate_chz is the LFO rate in 0.01 Hz. depth is
+ * percent for WAVE_MOD_AM, clipped to WAVE_MOD_AM_MAX_DEPTH, and the peak
+ * deviation in Hz for WAVE_MOD_FM, up to sample_rate/4. The LFO restarts at phase 0.
+ ****************************************************************************/
+void WaveModStart(WAVE_MOD *mod, WAVE_MOD_TYPE type, INT32U rate_chz, INT32U depth, INT32U sample_rate){
+    mod->lfo_phase = 0;
+    mod->lfo_last = 0;
+    mod->lfo_step = (INT32U)((((INT64U)rate_chz << 32) + (50u * sample_rate)) / (100u * (INT64U)sample_rate));
+    if(type == WAVE_MOD_AM){
+        if(depth > WAVE_MOD_AM_MAX_DEPTH){
+            depth = WAVE_MOD_AM_MAX_DEPTH;
+        }else{
+        }
+        mod->depth = (INT32S)((depth * WAVE_MOD_ONE_Q15) / WAVE_MOD_AM_MAX_DEPTH);
+        mod->type = WAVE_MOD_AM;
+    }else if(type == WAVE_MOD_FM){
+        mod->depth = (INT32S)DDSPhaseStep(depth, sample_rate);
+        if((INT32U)mod->depth > WAVE_MOD_FM_MAX_DEV){   /* keeps the ramp in 64 bits */
+            mod->depth = (INT32S)WAVE_MOD_FM_MAX_DEV;
+        }else{
+        }
+        mod->type = WAVE_MOD_FM;
+    }else{
+        mod->depth = 0;
+        mod->type = WAVE_MOD_OFF;
+    }
+}
+/****************************************************************************
+ * WaveModRender() - Public
+ * Renders num_samples Q15 samples of gen into out under mod. gen->step is
+ * the carrier and is left unchanged.
+ * AM gain runs 1 - depth*(1 - lfo)/2, from 1 - depth at the LFO trough to
+ * unity at its crest, so the output never exceeds the carrier.
+ ****************************************************************************/
+void WaveModRender(WAVE_MOD *mod, WAVE_GEN *gen, INT16S *out, INT32U num_samples){
+    INT32S v0;
+    INT32S v1;
+    INT32S g0;
+    INT32S g1;
+    INT32S acc;
+    INT32S dacc;
+    INT64U step;
+    INT64S s0;
+    INT64S s1;
+    INT32U carrier;
+    INT32U i;
+
+    if((mod->type == WAVE_MOD_OFF) || (num_samples == 0)){
+        WaveGenRender(gen, out, num_samples);
+        return;
+    }else{
+    }
+    v0 = mod->lfo_last;
+    mod->lfo_phase += mod->lfo_step * num_samples;
+    v1 = DDSSineSample(mod->lfo_phase);
+    mod->lfo_last = (INT16S)v1;
+    if(mod->type == WAVE_MOD_AM){
+        WaveGenRender(gen, out, num_samples);
+        g0 = WAVE_MOD_ONE_Q15 - (INT32S)(((INT32U)mod->depth * (INT32U)(WAVE_MOD_ONE_Q15 - v0)) >> 16);
+        g1 = WAVE_MOD_ONE_Q15 - (INT32S)(((INT32U)mod->depth * (INT32U)(WAVE_MOD_ONE_Q15 - v1)) >> 16);
+        acc = g0 << 15;                                 /* gain Q15 with 15 more fraction bits */
+        dacc = ((g1 - g0) * (1 << 15)) / (INT32S)num_samples;
+        for(i = 0; i < num_samples; i++){
+            out[i] = (INT16S)((out[i] * (acc >> 15)) >> 15);
+            acc += dacc;
+        }
+    }else{
+        carrier = gen->step;
+        s0 = (INT64S)carrier + (((INT64S)mod->depth * v0) >> 15);
+        s1 = (INT64S)carrier + (((INT64S)mod->depth * v1) >> 15);
+        if(gen->ops == &WaveGenSine){
+            step = (INT64U)s0 << 32;
+            DDSSineSweepLin(&gen->phase, &step, ((s1 - s0) * 4294967296LL) / (INT64S)num_samples, out, num_samples);
+        }else{
+            gen->step = (INT32U)((s0 + s1) / 2);
+            WaveGenRender(gen, out, num_samples);
+            gen->step = carrier;
+        }
+    }
+}
@@ -0,0 +1,24 @@
+/****************************************************************************
+ * WaveMod.h
+ * Header file for WaveMod.c
+ * Amplitude and frequency modulation of a generator by a block-rate LFO.
+ ****************************************************************************/
+#ifndef WAVEMOD_H_
+#define WAVEMOD_H_
+
+typedef enum {WAVE_MOD_OFF, WAVE_MOD_AM, WAVE_MOD_FM} WAVE_MOD_TYPE;
+
+#define WAVE_MOD_AM_MAX_DEPTH   100u    /* AM depth in percent          */
+
+typedef struct {
+    INT32U lfo_phase;   /* LFO phase at the start of the next block, 2^32 per period */
+    INT32U lfo_step;    /* LFO phase increment per sample                  */
+    INT32S depth;       /* AM: index Q15, FM: peak phase step deviation    */
+    INT16S lfo_last;    /* LFO value at lfo_phase, Q15                     */
+    INT8U  type;        /* WAVE_MOD_TYPE                                   */
+} WAVE_MOD;
+
+void WaveModStart(WAVE_MOD *mod, WAVE_MOD_TYPE type, INT32U rate_chz, INT32U depth, INT32U sample_rate);
+void WaveModRender(WAVE_MOD *mod, WAVE_GEN *gen, INT16S *out, INT32U num_samples);
+
+#endif /* WAVEMOD_H_ */
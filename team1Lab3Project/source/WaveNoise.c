@@ -0,0 +1,155 @@
+/****************************************************************************
+ * WaveNoise.c
+ * Noise generators for the DAC pipeline. Every generator owns its PRNG
+ * state, so there is no lock and no shared seed, and each call renders a
+ * whole block with the state held in registers.
+ * The PRNG is xoshiro128+ (Blackman/Vigna), shifts, xors, a rotate and an
+ * add per 32-bit word. Its lowest bits are weak, so only the top bits are
+ * used for samples.
+ *  - White: uniform Q15 over the full range, one word per sample
+ *  - Pink:  Voss-McCartney bank of WAVE_NOISE_ROWS octave rows plus a
+ *           white row. Row r is redrawn every 2^(r+1) samples, picked by
+ *           the trailing zeros of a counter, so each sample redraws one
+ *           row and costs one word, a table lookup and two adds. The
+ *           spectrum is 1/f relative to the sample rate, so it needs no
+ *           coefficients for the plan rate.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveNoise.h"
+
+#define WAVE_NOISE_ROW_BITS 12u     /* row value bits, 16 rows sum to Q15 */
+#define WAVE_NOISE_ROTL(x, k)   (((x) << (k)) | ((x) >> (32u - (k))))
+
+/* Bit position of a single set bit b, at (b*0x077CB531) >> 27 */
+static const INT8U waveNoiseCtzTable[32] = {
+    0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+    31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u
+};
+
+/****************************************************************************
+ * WaveNoiseSeed() - Public
+ * Expands seed into the PRNG state with splitmix32, so any seed including
+ * 0 gives a usable state, and clears the pink rows.
+ ****************************************************************************/
+void WaveNoiseSeed(WAVE_NOISE *noise, INT32U seed){
+    INT32U z;
+    INT32U i;
+
+    for(i = 0; i < 4u; i++){
+        seed += 0x9E3779B9u;
+        z = seed;
+        z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+        z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+        noise->rng[i] = z ^ (z >> 16);
+    }
+    if((noise->rng[0] | noise->rng[1] | noise->rng[2] | noise->rng[3]) == 0){
+        noise->rng[0] = 1u;
+    }else{
+    }
+    for(i = 0; i < WAVE_NOISE_ROWS; i++){
+        noise->row[i] = 0;
+    }
+    noise->sum = 0;
+    noise->count = 0;
+}
+/****************************************************************************
+ * WaveNoiseFill() - Public
+ * Writes num_words raw 32-bit PRNG words into out.
+ ****************************************************************************/
+void WaveNoiseFill(WAVE_NOISE *noise, INT32U *out, INT32U num_words){
+    INT32U s0 = noise->rng[0];
+    INT32U s1 = noise->rng[1];
+    INT32U s2 = noise->rng[2];
+    INT32U s3 = noise->rng[3];
+    INT32U t;
+    INT32U i;
+
+    for(i = 0; i < num_words; i++){
+        out[i] = s0 + s3;
+        t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = WAVE_NOISE_ROTL(s3, 11u);
+    }
+    noise->rng[0] = s0;
+    noise->rng[1] = s1;
+    noise->rng[2] = s2;
+    noise->rng[3] = s3;
+}
+/****************************************************************************
+ * WaveNoiseWhite() - Public
+ * Renders num_samples uniform Q15 samples into out.
+ ****************************************************************************/
+void WaveNoiseWhite(WAVE_NOISE *noise, INT16S *out, INT32U num_samples){
+    INT32U s0 = noise->rng[0];
+    INT32U s1 = noise->rng[1];
+    INT32U s2 = noise->rng[2];
+    INT32U s3 = noise->rng[3];
+    INT32U t;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        out[i] = (INT16S)((s0 + s3) >> 16);
+        t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = WAVE_NOISE_ROTL(s3, 11u);
+    }
+    noise->rng[0] = s0;
+    noise->rng[1] = s1;
+    noise->rng[2] = s2;
+    noise->rng[3] = s3;
+}
+/****************************************************************************
+ * WaveNoisePink() - Public
+ * Renders num_samples Q15 pink noise samples into out. Bits 31..20 of each
+ * word redraw one octave row and bits 19..8 are the white row, each a
+ * signed 12-bit value, so the 16 rows always sum inside the Q15 range.
+ * A counter value with more trailing zeros than there are rows redraws
+ * nothing but the white row.
+ ****************************************************************************/
+void WaveNoisePink(WAVE_NOISE *noise, INT16S *out, INT32U num_samples){
+    INT32U s0 = noise->rng[0];
+    INT32U s1 = noise->rng[1];
+    INT32U s2 = noise->rng[2];
+    INT32U s3 = noise->rng[3];
+    INT32S sum = noise->sum;
+    INT32U count = noise->count;
+    INT32U word;
+    INT32U t;
+    INT32U r;
+    INT32S v;
+    INT32U i;
+
+    for(i = 0; i < num_samples; i++){
+        word = s0 + s3;
+        t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = WAVE_NOISE_ROTL(s3, 11u);
+        count++;
+        r = waveNoiseCtzTable[((count & (0u - count)) * 0x077CB531u) >> 27];
+        if(r < WAVE_NOISE_ROWS){
+            v = (INT32S)word >> (32u - WAVE_NOISE_ROW_BITS);
+            sum += v - noise->row[r];
+            noise->row[r] = v;
+        }else{
+        }
+        out[i] = (INT16S)(sum + ((INT32S)(word << WAVE_NOISE_ROW_BITS) >> (32u - WAVE_NOISE_ROW_BITS)));
+    }
+    noise->rng[0] = s0;
+    noise->rng[1] = s1;
+    noise->rng[2] = s2;
+    noise->rng[3] = s3;
+    noise->sum = sum;
+    noise->count = count;
+}
@@ -0,0 +1,27 @@
+/****************************************************************************
+ * WaveNoise.h
+ * Header file for WaveNoise.c
+ * Block white and pink noise from a per-generator xoshiro128+ PRNG.
+ ****************************************************************************/
+#ifndef WAVENOISE_H_
+#define WAVENOISE_H_
+
+/* Octave rows of the pink noise bank. The lowest row changes every
+ * 2^WAVE_NOISE_ROWS samples, so the 1/f slope holds down to about
+ * sample_rate/2^(WAVE_NOISE_ROWS+1).                                       */
+#define WAVE_NOISE_ROWS 15u
+
+struct WAVE_NOISE_S {
+    INT32U rng[4];                  /* xoshiro128+ state, never all zero    */
+    INT32S row[WAVE_NOISE_ROWS];    /* held value of each pink octave row   */
+    INT32S sum;                     /* sum of row                           */
+    INT32U count;                   /* pink sample counter, picks the row   */
+};
+typedef struct WAVE_NOISE_S WAVE_NOISE;
+
+void WaveNoiseSeed(WAVE_NOISE *noise, INT32U seed);
+void WaveNoiseFill(WAVE_NOISE *noise, INT32U *out, INT32U num_words);
+void WaveNoiseWhite(WAVE_NOISE *noise, INT16S *out, INT32U num_samples);
+void WaveNoisePink(WAVE_NOISE *noise, INT16S *out, INT32U num_samples);
+
+#endif /* WAVENOISE_H_ */
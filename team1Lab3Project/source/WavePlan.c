@@ -0,0 +1,193 @@
+/****************************************************************************
+ * WavePlan.c
+ * Sample rate and block size planner for the DAC path.
+ * The sample rate tracks the output frequency (WAVE_PLAN_OVERSAMPLE samples
+ * per period) within WAVE_PLAN_MIN_RATE..WAVE_PLAN_MAX_RATE, so a low tone
+ * costs far fewer samples per second than a high one. The block size holds
+ * the DMA interrupt rate near WAVE_PLAN_BLOCK_RATE, so low rates also get
+ * fewer interrupts.
+ * WavePlanFitLoop() fits a whole number of periods into a buffer for cached
+ * steady-state playback.
+ * The Channels versions do the same for several outputs on one sample
+ * clock. The rate follows the highest frequency and the loop has to hold
+ * whole periods of every channel, so it is fitted at their common divisor.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "app_cfg.h"
+#include "WavePlan.h"
+
+static INT32U wavePlanGcd(INT32U a, INT32U b);
+
+/****************************************************************************
+ * WavePlanForFreq() - Public
+ * Fills plan for an output frequency of freq Hz. freq = 0 gives the lowest
+ * rate plan.
+ ****************************************************************************/
+void WavePlanForFreq(INT32U freq, WAVE_PLAN *plan){
+    INT32U rate;
+    INT32U block;
+
+    plan->freq = freq;
+    if(freq > (WAVE_PLAN_MAX_RATE / WAVE_PLAN_OVERSAMPLE)){
+        rate = WAVE_PLAN_MAX_RATE;
+    }else if((freq * WAVE_PLAN_OVERSAMPLE) < WAVE_PLAN_MIN_RATE){
+        rate = WAVE_PLAN_MIN_RATE;
+    }else{
+        rate = freq * WAVE_PLAN_OVERSAMPLE;
+    }
+    plan->pit_ldval = ((WAVE_BUS_CLK + (rate >> 1)) / rate) - 1;
+    plan->sample_rate = WAVE_BUS_CLK / (plan->pit_ldval + 1);
+
+    block = (plan->sample_rate / WAVE_PLAN_BLOCK_RATE) & ~(WAVE_PLAN_BLOCK_ALIGN - 1u);
+    if(block > WAVE_PLAN_MAX_BLOCK){
+        block = WAVE_PLAN_MAX_BLOCK;
+    }else if(block < WAVE_PLAN_MIN_BLOCK){
+        block = WAVE_PLAN_MIN_BLOCK;
+    }else{
+    }
+    plan->block_samples = (INT16U)block;
+    plan->phase_step = WavePlanStep(plan, freq);
+}
+/****************************************************************************
+ * WavePlanStep() - Public
+ * Returns the phase increment for freq Hz at the plan's PIT rate. It uses
+ * the exact rate WAVE_BUS_CLK/(pit_ldval+1), not the whole-Hz
+ * sample_rate, which is up to 1 Hz low and would put the output up to
+ * 125 ppm high. freq up to 2^22 Hz.
+ ****************************************************************************/
+INT32U WavePlanStep(const WAVE_PLAN *plan, INT32U freq){
+    INT64U step;
+    step = ((((INT64U)freq << 32) * (plan->pit_ldval + 1)) + (WAVE_BUS_CLK / 2)) / WAVE_BUS_CLK;
+    return (INT32U)step;
+}
+/****************************************************************************
+ * WavePlanFitLoop() - Public
+ * Finds a loop length (WAVE_LOOP_MIN_LEN..max_len samples), a whole number
+ * of periods and a PIT reload within 25% of the plan's rate so that
+ *     periods * WAVE_BUS_CLK / ((pit_ldval+1) * length) ~= plan->freq
+ * with the smallest error. Ties go to the rate closest to the plan.
+ * Returns TRUE and fills loop if the error is within WAVE_LOOP_MAX_PPM.
+ * Costs about 3*max_len 64-bit divides, call it once per frequency change.
+ ****************************************************************************/
+INT8U WavePlanFitLoop(const WAVE_PLAN *plan, INT16U max_len, WAVE_LOOP *loop){
+    INT64U clocks;          /* k * bus clocks for k periods                   */
+    INT64U per_clk;         /* freq * length                                  */
+    INT64U err;
+    INT64U best_err = 0;
+    INT64U best_clocks = 0;
+    INT32U best_dev = 0;
+    INT32U div0 = plan->pit_ldval + 1;
+    INT32U div;
+    INT32U dev;
+    INT32U len;
+    INT32U k0;
+    INT32U k;
+    INT8U found = FALSE;
+
+    if(plan->freq == 0){
+        return FALSE;
+    }else{
+    }
+    for(len = WAVE_LOOP_MIN_LEN; len <= max_len; len++){
+        per_clk = (INT64U)plan->freq * len;
+        k0 = (INT32U)((per_clk * div0 + (WAVE_BUS_CLK / 2)) / WAVE_BUS_CLK);
+        for(k = (k0 > 1) ? (k0 - 1) : 1; k <= (k0 + 1); k++){
+            clocks = (INT64U)k * WAVE_BUS_CLK;
+            div = (INT32U)((clocks + (per_clk >> 1)) / per_clk);
+            dev = (div > div0) ? (div - div0) : (div0 - div);
+            if((div < (WAVE_BUS_CLK / WAVE_PLAN_MAX_RATE)) || (div > (WAVE_BUS_CLK / WAVE_PLAN_MIN_RATE)) ||
+               ((dev * 4) > div0) || (k > 0xFFFFu)){
+                continue;
+            }else{
+            }
+            err = per_clk * div;
+            err = (err > clocks) ? (err - clocks) : (clocks - err);
+            /* compare err/clocks against best_err/best_clocks */
+            if((found == FALSE) || ((err * best_clocks) < (best_err * clocks)) ||
+               (((err * best_clocks) == (best_err * clocks)) && (dev < best_dev))){
+                found = TRUE;
+                best_err = err;
+                best_clocks = clocks;
+                best_dev = dev;
+                loop->pit_ldval = div - 1;
+                loop->length = (INT16U)len;
+                loop->periods = (INT16U)k;
+            }else{
+            }
+        }
+    }
+    if((found == FALSE) || ((best_err * 1000000u) > (best_clocks * WAVE_LOOP_MAX_PPM))){
+        return FALSE;
+    }else{
+    }
+    loop->phase_step = (INT32U)((((INT64U)loop->periods << 32) + (loop->length >> 1)) / loop->length);
+    return TRUE;
+}
+/****************************************************************************
+ * WavePlanForChannels() - Public
+ * Plans the shared rate for the highest of freqs[0..num_ch-1] and fills
+ * steps[] with each channel's phase increment at that rate.
+ ****************************************************************************/
+void WavePlanForChannels(const INT32U *freqs, INT8U num_ch, WAVE_PLAN *plan, INT32U *steps){
+    INT32U max_freq = 0;
+    INT8U ch;
+
+    for(ch = 0; ch < num_ch; ch++){
+        if(freqs[ch] > max_freq){
+            max_freq = freqs[ch];
+        }else{
+        }
+    }
+    WavePlanForFreq(max_freq, plan);
+    for(ch = 0; ch < num_ch; ch++){
+        steps[ch] = WavePlanStep(plan, freqs[ch]);
+    }
+}
+/****************************************************************************
+ * WavePlanFitChannelLoop() - Public
+ * Fits a loop at the greatest common divisor of the non-zero freqs, so each
+ * channel gets freqs[ch]/gcd times loop->periods whole periods, and fills
+ * steps[] with the matching per-channel increments. loop->phase_step is
+ * the increment at the divisor. Returns FALSE if every channel is silent or
+ * WavePlanFitLoop() finds nothing within WAVE_LOOP_MAX_PPM, which is
+ * likely when the divisor is low (1000 Hz and 1001 Hz repeat once a second).
+ ****************************************************************************/
+INT8U WavePlanFitChannelLoop(const WAVE_PLAN *plan, const INT32U *freqs, INT8U num_ch, INT16U max_len,
+                             WAVE_LOOP *loop, INT32U *steps){
+    WAVE_PLAN common = *plan;
+    INT64U periods;
+    INT32U div = 0;
+    INT8U ch;
+
+    for(ch = 0; ch < num_ch; ch++){
+        div = wavePlanGcd(div, freqs[ch]);
+    }
+    if(div == 0){
+        return FALSE;
+    }else{
+    }
+    common.freq = div;
+    if(WavePlanFitLoop(&common, max_len, loop) == FALSE){
+        return FALSE;
+    }else{
+    }
+    for(ch = 0; ch < num_ch; ch++){
+        /* whole periods beyond the length wrap the 32-bit phase exactly */
+        periods = ((INT64U)loop->periods * (freqs[ch] / div)) % loop->length;
+        steps[ch] = (INT32U)(((periods << 32) + (loop->length >> 1)) / loop->length);
+    }
+    return TRUE;
+}
+/****************************************************************************
+ * wavePlanGcd() - Private
+ * gcd(a, 0) = a, so a silent channel does not constrain the loop.
+ ****************************************************************************/
+static INT32U wavePlanGcd(INT32U a, INT32U b){
+    INT32U t;
+    while(b != 0){
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
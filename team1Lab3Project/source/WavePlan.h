@@ -0,0 +1,48 @@
+/****************************************************************************
+ * WavePlan.h
+ * Header file for WavePlan.c
+ * Chooses the DAC sample rate and DMA block size for an output frequency.
+ * Include app_cfg.h first.
+ ****************************************************************************/
+#ifndef WAVEPLAN_H_
+#define WAVEPLAN_H_
+
+#define WAVE_BUS_CLK            60000000u   /* PIT clock (bus clock), Hz      */
+#define WAVE_PLAN_OVERSAMPLE    48u         /* target samples per period      */
+#define WAVE_PLAN_MIN_RATE      8000u       /* lowest DAC sample rate, Hz     */
+#define WAVE_PLAN_MAX_RATE      200000u     /* highest DAC sample rate, Hz    */
+#define WAVE_PLAN_BLOCK_RATE    100u        /* target DMA blocks per second   */
+#define WAVE_PLAN_BLOCK_ALIGN   4u          /* block sizes are multiples, 2^n */
+#define WAVE_PLAN_MIN_BLOCK     32u         /* samples, WAVE_PLAN_BLOCK_ALIGN multiple */
+#define WAVE_PLAN_MAX_BLOCK     APP_CFG_WAVE_MAX_BLOCK  /* samples, as above */
+#define WAVE_LOOP_MIN_LEN       16u         /* shortest cached loop, samples  */
+#define WAVE_LOOP_MAX_PPM       20u         /* worst accepted loop freq error */
+
+typedef struct {
+    INT32U freq;            /* output frequency the plan is for, Hz            */
+    INT32U pit_ldval;       /* PIT reload, sample period is pit_ldval+1 clocks */
+    INT32U sample_rate;     /* actual sample rate after PIT rounding, Hz       */
+    INT32U phase_step;      /* DDS phase increment at sample_rate              */
+    INT16U block_samples;   /* samples per DMA block                           */
+} WAVE_PLAN;
+
+/* A buffer of length samples holding exactly periods cycles, replayed by
+ * the DMA at the PIT rate pit_ldval.                                      */
+typedef struct {
+    INT32U pit_ldval;
+    INT32U phase_step;      /* ~ periods * 2^32 / length                       */
+    INT16U length;
+    INT16U periods;
+} WAVE_LOOP;
+
+void WavePlanForFreq(INT32U freq, WAVE_PLAN *plan);
+INT32U WavePlanStep(const WAVE_PLAN *plan, INT32U freq);
+INT8U WavePlanFitLoop(const WAVE_PLAN *plan, INT16U max_len, WAVE_LOOP *loop);
+
+/* Channels sharing one sample clock. steps[] gets one phase increment per
+ * channel, freqs[] of 0 is a silent channel.                              */
+void WavePlanForChannels(const INT32U *freqs, INT8U num_ch, WAVE_PLAN *plan, INT32U *steps);
+INT8U WavePlanFitChannelLoop(const WAVE_PLAN *plan, const INT32U *freqs, INT8U num_ch, INT16U max_len,
+                             WAVE_LOOP *loop, INT32U *steps);
+
+#endif /* WAVEPLAN_H_ */
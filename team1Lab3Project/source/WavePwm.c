@@ -0,0 +1,224 @@
+/****************************************************************************
+ * WavePwm.c
+ * Works out the FTM alignment, prescaler, MOD and CnV for the pulse output
+ * with the least period error, and then the least duty error, the FTM can
+ * give.
+ *
+ * An edge-aligned period is (MOD+1)*2^ps bus clocks, any multiple of 2^ps
+ * up to WAVE_PWM_MAX_COUNT of them. A center-aligned period is
+ * 2*MOD*2^ps, multiples of 2^(ps+1). A coarser grid is a subset of a
+ * finer one, so the best setting is on the finest grid that still reaches
+ * the period. That is edge-aligned at the smallest prescaler that fits,
+ * and center-aligned /128 below the edge-aligned range. WavePwmPrescale()
+ * reads it from a table indexed by the bit length of the period, and
+ * WavePwmCalc() rounds MOD and CnV on it. WavePwmPlanRef() tries every
+ * alignment and prescaler to check them.
+ * WavePwmEdges() and WavePwmDeadtime() give the values for a combined
+ * channel pair, a pulse placed anywhere in an edge-aligned period.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WavePwm.h"
+
+#define WAVE_PWM_NUM_PS     8u          /* FTM_SC_PS /1 to /128              */
+#define WAVE_PWM_DT_MAX     63u         /* FTM_DEADTIME_DTVAL                */
+#define WAVE_PWM_DT_PS4     2u          /* FTM_DEADTIME_DTPS divide by 4     */
+#define WAVE_PWM_DT_PS16    3u          /* FTM_DEADTIME_DTPS divide by 16    */
+
+static INT8U wavePwmBits(INT32U x);
+
+/* Finest setting for periods of up to 2^(16+i) bus clocks, {center, ps} */
+static const INT8U wavePwmTable[WAVE_PWM_NUM_PS + 1][2] = {
+    {FALSE, 0}, {FALSE, 1}, {FALSE, 2}, {FALSE, 3}, {FALSE, 4}, {FALSE, 5}, {FALSE, 6}, {FALSE, 7},
+    {TRUE, 7}
+};
+
+/****************************************************************************
+ * WavePwmPrescale() - Public
+ * Picks the alignment and prescaler for freq in Hz, held to
+ * WAVE_PWM_MIN_FREQ..WAVE_PWM_MAX_FREQ. A set of frequencies that share
+ * one setting picks it for the lowest of them.
+ ****************************************************************************/
+void WavePwmPrescale(INT32U freq, WAVE_PWM *pwm){
+    INT32U clocks;
+    INT8U idx;
+
+    if(freq < WAVE_PWM_MIN_FREQ){
+        freq = WAVE_PWM_MIN_FREQ;
+    }else if(freq > WAVE_PWM_MAX_FREQ){
+        freq = WAVE_PWM_MAX_FREQ;
+    }else{
+    }
+    clocks = (WAVE_PWM_BUS_CLK + (freq >> 1)) / freq;
+    idx = wavePwmBits((clocks - 1u) >> 16);
+    if(idx > WAVE_PWM_NUM_PS){
+        idx = WAVE_PWM_NUM_PS;
+    }else{
+    }
+    pwm->center = wavePwmTable[idx][0];
+    pwm->ps = wavePwmTable[idx][1];
+}
+/****************************************************************************
+ * WavePwmPrescaleEdge() - Public
+ * As WavePwmPrescale() but edge-aligned only, for combined channels, which
+ * the FTM cannot run center-aligned. Below the edge-aligned range
+ * WavePwmCalc() then holds the period at its longest, about 7.2Hz.
+ ****************************************************************************/
+void WavePwmPrescaleEdge(INT32U freq, WAVE_PWM *pwm){
+    WavePwmPrescale(freq, pwm);
+    if(pwm->center == TRUE){
+        pwm->center = FALSE;
+        pwm->ps = WAVE_PWM_NUM_PS - 1u;
+    }else{
+    }
+}
+/****************************************************************************
+ * WavePwmCalc() - Public
+ * MOD, CnV and period for freq in Hz and duty in percent on the alignment
+ * and prescaler already in pwm. The periods either side of freq are both
+ * tried, in counts held to the range the alignment has, and the one with
+ * the smaller frequency error kept. A freq too low for the prescaler gets
+ * its longest period, freq 0 included. CnV rounds to the nearest count and
+ * duty 100 or more holds the output high.
+ ****************************************************************************/
+void WavePwmCalc(INT32U freq, INT16U duty, WAVE_PWM *pwm){
+    INT32U unit = (pwm->center == TRUE) ? (2u << pwm->ps) : (1u << pwm->ps);   /* bus clocks per count */
+    INT32U max = (pwm->center == TRUE) ? 0xFFFFu : WAVE_PWM_MAX_COUNT;
+    INT32U min = (pwm->center == TRUE) ? 1u : 2u;
+    INT32U counts;
+    INT64U below;
+    INT64U above;
+
+    counts = (freq > 0) ? (WAVE_PWM_BUS_CLK / (freq * unit)) : max;
+    if(counts >= max){
+        counts = max;
+    }else if(counts < min){
+        counts = min;
+    }else{
+        /* bus*(1/p - 1/(p+1)) compared without dividing, p = counts*unit  */
+        below = (INT64U)WAVE_PWM_BUS_CLK - ((INT64U)counts * unit * freq);
+        above = ((INT64U)(counts + 1u) * unit * freq) - WAVE_PWM_BUS_CLK;
+        if((above * counts) < (below * (counts + 1u))){
+            counts++;
+        }else{
+        }
+    }
+    pwm->period = counts * unit;
+    pwm->mod = (INT16U)((pwm->center == TRUE) ? counts : (counts - 1u));
+    if(duty < 100){
+        pwm->cnv = (INT16U)(((counts * duty) + 50u) / 100u);
+    }else if(pwm->center == TRUE){
+        pwm->cnv = pwm->mod;
+    }else{
+        pwm->cnv = (INT16U)((counts > 0xFFFFu) ? 0xFFFFu : counts);   /* CnV > MOD, short of MOD 0xFFFF */
+    }
+}
+/****************************************************************************
+ * WavePwmPlanRef() - Public
+ * Reference for WavePwmPrescale() and WavePwmCalc(): rounds freq on every
+ * alignment and prescaler and keeps the least period error, then the least
+ * duty error, then the finer grid.
+ ****************************************************************************/
+void WavePwmPlanRef(INT32U freq, INT16U duty, WAVE_PWM *pwm){
+    WAVE_PWM cand;
+    INT64U err;
+    INT64U best_err = 0;
+    INT64U derr;
+    INT64U best_derr = 0;
+    INT64U counts;
+    INT64U best_counts = 1;
+    INT64U x;
+    INT8U center;
+    INT8U ps;
+    INT8U first = TRUE;
+
+    if(freq < WAVE_PWM_MIN_FREQ){
+        freq = WAVE_PWM_MIN_FREQ;
+    }else if(freq > WAVE_PWM_MAX_FREQ){
+        freq = WAVE_PWM_MAX_FREQ;
+    }else{
+    }
+    if(duty > 100){
+        duty = 100;
+    }else{
+    }
+    for(ps = 0; ps < WAVE_PWM_NUM_PS; ps++){
+        for(center = FALSE; center <= TRUE; center++){
+            cand.ps = ps;
+            cand.center = center;
+            WavePwmCalc(freq, duty, &cand);
+            /* frequency error |bus - period*freq|/period, duty error
+               |100*CnV - duty*counts|/counts, compared cross multiplied   */
+            x = (INT64U)cand.period * freq;
+            err = (x > WAVE_PWM_BUS_CLK) ? (x - WAVE_PWM_BUS_CLK) : (WAVE_PWM_BUS_CLK - x);
+            counts = (center == TRUE) ? cand.mod : ((INT64U)cand.mod + 1u);
+            x = (duty < 100) ? ((INT64U)cand.cnv * 100u) : ((INT64U)duty * counts);
+            derr = (x > (INT64U)duty * counts) ? (x - (INT64U)duty * counts) : ((INT64U)duty * counts - x);
+            if((first == TRUE) || ((err * pwm->period) < (best_err * cand.period)) ||
+               (((err * pwm->period) == (best_err * cand.period)) && ((derr * best_counts) < (best_derr * counts)))){
+                first = FALSE;
+                best_err = err;
+                best_derr = derr;
+                best_counts = counts;
+                *pwm = cand;
+            }else{
+            }
+        }
+    }
+}
+/****************************************************************************
+ * WavePwmEdges() - Public
+ * C(n)V and C(n+1)V of a combined pair on pwm, edge-aligned, for a pulse
+ * starting phase into the period and lasting duty, both in
+ * WAVE_PWM_EDGE_FULL of a period and rounded to the nearest count. The
+ * pulse ends at the end of the period at the latest, duty is cut short
+ * past it. A pulse reaching the end never clears, so holds through the
+ * reload when phase is 0.
+ ****************************************************************************/
+void WavePwmEdges(const WAVE_PWM *pwm, INT16U phase, INT16U duty, INT16U *c0v, INT16U *c1v){
+    INT32U counts = (INT32U)pwm->mod + 1u;
+    INT32U end;
+
+    if(phase > WAVE_PWM_EDGE_FULL){
+        phase = WAVE_PWM_EDGE_FULL;
+    }else{
+    }
+    end = (INT32U)phase + duty;
+    if(end > WAVE_PWM_EDGE_FULL){
+        end = WAVE_PWM_EDGE_FULL;
+    }else{
+    }
+    *c0v = (INT16U)(((counts * phase) + (WAVE_PWM_EDGE_FULL / 2u)) / WAVE_PWM_EDGE_FULL);
+    end = ((counts * end) + (WAVE_PWM_EDGE_FULL / 2u)) / WAVE_PWM_EDGE_FULL;
+    *c1v = (INT16U)((end > 0xFFFFu) ? 0xFFFFu : end);
+}
+/****************************************************************************
+ * WavePwmDeadtime() - Public
+ * FTM_DEADTIME for at least ns of dead time, the finest prescaler that
+ * reaches it, or the longest the FTM has, 1008 bus clocks.
+ ****************************************************************************/
+INT8U WavePwmDeadtime(INT32U ns){
+    INT32U clocks = (INT32U)((((INT64U)ns * WAVE_PWM_BUS_CLK) + 999999999u) / 1000000000u);
+
+    if(clocks <= WAVE_PWM_DT_MAX){
+        return (INT8U)clocks;
+    }else if(((clocks + 3u) >> 2) <= WAVE_PWM_DT_MAX){
+        return (INT8U)((WAVE_PWM_DT_PS4 << 6) | ((clocks + 3u) >> 2));
+    }else if(((clocks + 15u) >> 4) <= WAVE_PWM_DT_MAX){
+        return (INT8U)((WAVE_PWM_DT_PS16 << 6) | ((clocks + 15u) >> 4));
+    }else{
+        return (INT8U)((WAVE_PWM_DT_PS16 << 6) | WAVE_PWM_DT_MAX);
+    }
+}
+/****************************************************************************
+ * wavePwmBits() - Private
+ * Number of significant bits in x, 0 for 0.
+ ****************************************************************************/
+static INT8U wavePwmBits(INT32U x){
+    INT8U bits = 0;
+
+    while(x != 0){
+        bits++;
+        x >>= 1;
+    }
+    return bits;
+}
@@ -0,0 +1,31 @@
+/****************************************************************************
+ * WavePwm.h
+ * Header file for WavePwm.c
+ * FTM register values for a pulse frequency and duty cycle.
+ ****************************************************************************/
+#ifndef WAVEPWM_H_
+#define WAVEPWM_H_
+
+#define WAVE_PWM_BUS_CLK    60000000u   /* FTM clock, bus clock, Hz                  */
+#define WAVE_PWM_MIN_FREQ   4u          /* lowest frequency, center-aligned /128, Hz */
+#define WAVE_PWM_MAX_FREQ   500000u     /* highest that keeps 1% duty steps, Hz      */
+#define WAVE_PWM_MAX_COUNT  0x10000u    /* prescaled clocks in an edge-aligned period */
+#define WAVE_PWM_EDGE_FULL  1000u       /* WavePwmEdges() phase and duty in a period */
+
+/* FTM settings for one frequency and duty cycle                            */
+typedef struct {
+    INT32U period;      /* bus clocks per period                            */
+    INT16U mod;         /* FTM_MOD                                          */
+    INT16U cnv;         /* FTM_CnV                                          */
+    INT8U  ps;          /* FTM_SC_PS prescaler select, divide by 2^ps       */
+    INT8U  center;      /* FTM_SC_CPWMS, TRUE center-aligned                */
+} WAVE_PWM;
+
+void WavePwmPrescale(INT32U freq, WAVE_PWM *pwm);
+void WavePwmPrescaleEdge(INT32U freq, WAVE_PWM *pwm);
+void WavePwmCalc(INT32U freq, INT16U duty, WAVE_PWM *pwm);
+void WavePwmPlanRef(INT32U freq, INT16U duty, WAVE_PWM *pwm);
+void WavePwmEdges(const WAVE_PWM *pwm, INT16U phase, INT16U duty, INT16U *c0v, INT16U *c1v);
+INT8U WavePwmDeadtime(INT32U ns);
+
+#endif /* WAVEPWM_H_ */
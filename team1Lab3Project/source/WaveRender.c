@@ -0,0 +1,123 @@
+/****************************************************************************
+ * WaveRender.c
+ * The sample loop of sinewaveProcTask(): renders both sine channels a
+ * chunk at a time through their generator, sweep, modulation or the
+ * upsampler, runs their effects chains, formats the DAC0/DAC1 frames and
+ * steps their sequences. It has no OS or hardware dependencies, so the
+ * host benchmark times this same code, tools/bench/WaveBench.c.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "app_cfg.h"
+#include "WaveRender.h"
+#include "WaveDac.h"
+
+#if ((WAVE_PLAN_BLOCK_ALIGN % WAVE_INTERP_L) != 0) || ((WAVE_PLAN_MAX_BLOCK % WAVE_INTERP_L) != 0)
+#error "Sine blocks must split evenly into WAVE_INTERP_L upsampled samples"
+#endif
+
+static void waveRenderUp(WAVE_RENDER_CH *chan, INT16S *out, INT32U num_samples);
+
+/****************************************************************************
+ * WaveRenderBlock() - Public
+ * Renders num_frames DAC0/DAC1 frames of the WAVE_RENDER_NUM_CH channels
+ * in chans into frames, at most WAVE_PLAN_MAX_BLOCK at a time through
+ * each channel's Q15 block. With upsample an unmodulated generator that
+ * WaveGenUpsampleWins() picks, the tones shape with WAVE_GEN_UP_TONES or
+ * more tones and its top harmonic within WAVE_INTERP_MAX_STEP, goes
+ * through waveRenderUp(). num_frames must then be a multiple of
+ * WAVE_INTERP_L.
+ * Sweeping channels share the generator phase so the chirp starts and ends
+ * without a jump. Each channel's effects chain runs on its block last.
+ * A chunk also ends where a channel's sequence steps, so the next step's
+ * generator, phase step and gain start on the exact sample. While any
+ * sequence runs both channels render direct, as the steps split chunks off
+ * the WAVE_INTERP_L grid.
+ ****************************************************************************/
+void WaveRenderBlock(WAVE_RENDER_CH *chans, INT16U *frames, INT32U num_frames, INT8U upsample){
+    INT32U chunk;
+    INT8U ch;
+
+    for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+        if(chans[ch].seq.left > 0){
+            upsample = FALSE;
+        }else{
+        }
+    }
+    while(num_frames > 0){
+        chunk = (num_frames > WAVE_PLAN_MAX_BLOCK) ? WAVE_PLAN_MAX_BLOCK : num_frames;
+        for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+            chunk = WaveSeqRun(&chans[ch].seq, chunk);
+        }
+        for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+            if(chans[ch].sweep.remaining > 0){
+                WaveSweepBlock(&chans[ch].sweep, &chans[ch].gen.phase, &chans[ch].block[0], chunk);
+                chans[ch].interpready = FALSE;
+            }else if((upsample == TRUE) && (chans[ch].mod.type == WAVE_MOD_OFF) &&
+                     (WaveGenUpsampleWins(&chans[ch].gen, WAVE_INTERP_MAX_STEP) == TRUE)){
+                waveRenderUp(&chans[ch], &chans[ch].block[0], chunk);
+            }else{
+                WaveModRender(&chans[ch].mod, &chans[ch].gen, &chans[ch].block[0], chunk);
+                chans[ch].interpready = FALSE;
+            }
+            WaveFxChainRun(&chans[ch].fx, &chans[ch].block[0], chunk);
+        }
+        WaveDacFormatPair(&chans[0].block[0], &chans[1].block[0], frames, chunk, chans[0].gain, chans[1].gain);
+        for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+            if(WaveSeqAdvance(&chans[ch].seq, chunk) == TRUE){
+                WaveRenderSeqApply(&chans[ch]);
+            }else{
+            }
+        }
+        frames += chunk * WAVE_RENDER_NUM_CH;
+        num_frames -= chunk;
+    }
+}
+
+/****************************************************************************
+ * WaveRenderSeqApply() - Public
+ * Sets chan's generator, phase step and gain to its sequence's current
+ * step, or back to the channel's own shape, step and amp once the sequence
+ * has stopped. The phase runs on, so only the slope changes at the
+ * transition.
+ ****************************************************************************/
+void WaveRenderSeqApply(WAVE_RENDER_CH *chan){
+    const WAVE_SEQ_STEP *set;
+    INT32U phase = chan->gen.phase;
+
+    if(chan->seq.left > 0){
+        set = &chan->seqset[chan->seq.index];
+        WaveGenInit(&chan->gen, (WAVE_SHAPE)set->shape);
+        chan->gen.step = chan->seqsteps[chan->seq.index];
+        chan->gain = (INT16S)(set->amp * WAVE_RENDER_AMP_SCALE);
+    }else{
+        WaveGenInit(&chan->gen, (WAVE_SHAPE)chan->shape);
+        chan->gen.step = chan->step;
+        chan->gain = (INT16S)(chan->amp * WAVE_RENDER_AMP_SCALE);
+    }
+    chan->gen.phase = phase;
+    chan->interpready = FALSE;
+}
+
+/****************************************************************************
+ * waveRenderUp() - Private
+ * Renders num_samples of chan's generator at 1/WAVE_INTERP_L of the DAC
+ * rate and upsamples them into out. When the channel comes from another
+ * path the FIR history is first rendered from the generator, ending one
+ * render-rate sample before its phase, so the output runs on without a
+ * glitch.
+ ****************************************************************************/
+static void waveRenderUp(WAVE_RENDER_CH *chan, INT16S *out, INT32U num_samples){
+    INT32U step = chan->gen.step;
+    INT32U num_in = num_samples / WAVE_INTERP_L;
+
+    chan->gen.step = step * WAVE_INTERP_L;
+    if(chan->interpready == FALSE){
+        chan->gen.phase -= WAVE_INTERP_HIST * chan->gen.step;
+        WaveGenRender(&chan->gen, &chan->lowrate[0], WAVE_INTERP_HIST);
+        chan->interpready = TRUE;
+    }else{
+    }
+    WaveGenRender(&chan->gen, &chan->lowrate[WAVE_INTERP_HIST], num_in);
+    chan->gen.step = step;
+    WaveInterpBlock(&chan->lowrate[0], num_in, out);
+}
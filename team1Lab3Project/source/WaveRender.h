@@ -0,0 +1,48 @@
+/****************************************************************************
+ * WaveRender.h
+ * Header file for WaveRender.c
+ * The sample loop of the sine outputs, one block of DAC0/DAC1 frames.
+ * Include MCUType.h and app_cfg.h first.
+ ****************************************************************************/
+#ifndef WAVERENDER_H_
+#define WAVERENDER_H_
+
+#include "WavePlan.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+#include "WaveTone.h"
+#include "WaveNoise.h"
+#include "WaveSweep.h"
+#include "WaveMod.h"
+#include "WaveFx.h"
+#include "WaveInterp.h"
+#include "WaveSeq.h"
+
+#define WAVE_RENDER_NUM_CH      2u      /* DAC0/DAC1, WaveDacFormatPair() */
+#define WAVE_RENDER_AMP_SCALE   186     /* 65536/352, amp 20 -> +/-1860 counts */
+
+/* Generator instance of one DAC channel */
+typedef struct {
+    INT16S  block[WAVE_PLAN_MAX_BLOCK];     /* Q15 samples from gen, first to keep it 32-bit aligned */
+    WAVE_GEN gen;
+    INT8U   amp;
+    INT16S  gain;                           /* DAC gain, amp * WAVE_RENDER_AMP_SCALE */
+    WAVE_MIP_USER usermip;                  /* octave tables of the user shape */
+    WAVE_TONES tones;                       /* oscillators of the tones shape */
+    WAVE_NOISE noise;                       /* PRNG and pink rows of the noise shapes */
+    WAVE_SWEEP sweep;                       /* chirp in progress while remaining > 0 */
+    WAVE_MOD mod;                           /* LFO modulation of gen */
+    INT16S  lowrate[WAVE_INTERP_HIST + (WAVE_PLAN_MAX_BLOCK / WAVE_INTERP_L)]; /* FIR history, then render-rate block */
+    INT8U   interpready;                    /* FALSE until lowrate history follows gen.phase */
+    WAVE_FX_CHAIN fx;                       /* effects run on block before the DAC */
+    INT8U   shape;                          /* channel's own shape, played when no sequence runs */
+    INT32U  step;                           /* channel's own phase step at the plan rate */
+    WAVE_SEQ seq;                           /* sequence in progress while seq.left > 0 */
+    WAVE_SEQ_STEP seqset[WAVE_SEQ_MAX_STEPS];   /* steps of seq */
+    INT32U  seqsteps[WAVE_SEQ_MAX_STEPS];   /* phase step of each seqset at the plan rate */
+} WAVE_RENDER_CH;
+
+void WaveRenderBlock(WAVE_RENDER_CH *chans, INT16U *frames, INT32U num_frames, INT8U upsample);
+void WaveRenderSeqApply(WAVE_RENDER_CH *chan);
+
+#endif /* WAVERENDER_H_ */
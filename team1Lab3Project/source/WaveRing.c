@@ -0,0 +1,81 @@
+/****************************************************************************
+ * WaveRing.c
+ * Index bookkeeping for an N-block DMA ring. The DMA plays blocks in order
+ * and calls WaveRingBlockDone() from its major-loop interrupt as each one
+ * finishes. The producer asks WaveRingNextFill() for the oldest played
+ * block, renders it and calls WaveRingFilled(). It can run up to
+ * num_blocks-1 blocks ahead of the DMA.
+ * If the DMA finishes a block while every other block is still waiting to
+ * be rendered, it is now playing stale data: the overrun is counted and the
+ * producer is moved to the block after the one playing.
+ * The caller keeps the ISR and producer calls from interleaving.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveRing.h"
+
+/****************************************************************************
+ * WaveRingInit() - Public
+ * Starts with every block rendered and the DMA on block 0.
+ ****************************************************************************/
+void WaveRingInit(WAVE_RING *ring, INT16U num_blocks){
+    ring->num_blocks = num_blocks;
+    ring->play = 0;
+    ring->fill = 0;
+    ring->free = 0;
+    ring->overruns = 0;
+}
+/****************************************************************************
+ * WaveRingBlockDone() - Public
+ * DMA side. The playing block is finished and the DMA has moved to the next.
+ * Returns the index of the finished block.
+ ****************************************************************************/
+INT16U WaveRingBlockDone(WAVE_RING *ring){
+    INT16U done = ring->play;
+
+    ring->play++;
+    if(ring->play >= ring->num_blocks){
+        ring->play = 0;
+    }else{
+    }
+    if(ring->free >= (ring->num_blocks - 1)){   /* next block was never refilled */
+        ring->overruns++;
+        ring->fill = ring->play + 1;
+        if(ring->fill >= ring->num_blocks){
+            ring->fill = 0;
+        }else{
+        }
+    }else{
+        ring->free++;
+    }
+    return done;
+}
+/****************************************************************************
+ * WaveRingNextFill() - Public
+ * Producer side. Returns TRUE and the block to render next in *index, or
+ * FALSE if all blocks are ahead of the DMA.
+ ****************************************************************************/
+INT8U WaveRingNextFill(const WAVE_RING *ring, INT16U *index){
+    if(ring->free == 0){
+        return FALSE;
+    }else{
+    }
+    *index = ring->fill;
+    return TRUE;
+}
+/****************************************************************************
+ * WaveRingFilled() - Public
+ * Producer side. Block index from WaveRingNextFill() is rendered. Ignored if
+ * an overrun moved the producer off index while it was rendering.
+ ****************************************************************************/
+void WaveRingFilled(WAVE_RING *ring, INT16U index){
+    if((ring->free == 0) || (index != ring->fill)){
+        return;
+    }else{
+    }
+    ring->free--;
+    ring->fill++;
+    if(ring->fill >= ring->num_blocks){
+        ring->fill = 0;
+    }else{
+    }
+}
@@ -0,0 +1,22 @@
+/****************************************************************************
+ * WaveRing.h
+ * Header file for WaveRing.c
+ * Block index bookkeeping for the DMA block ring feeding the DAC.
+ ****************************************************************************/
+#ifndef WAVERING_H_
+#define WAVERING_H_
+
+typedef struct {
+    INT16U num_blocks;  /* blocks in the ring                               */
+    INT16U play;        /* block the DMA is playing                         */
+    INT16U fill;        /* next block for the producer to render            */
+    INT16U free;        /* played blocks waiting to be rendered again       */
+    INT32U overruns;    /* times the DMA moved onto a block not rendered    */
+} WAVE_RING;
+
+void WaveRingInit(WAVE_RING *ring, INT16U num_blocks);
+INT16U WaveRingBlockDone(WAVE_RING *ring);
+INT8U WaveRingNextFill(const WAVE_RING *ring, INT16U *index);
+void WaveRingFilled(WAVE_RING *ring, INT16U index);
+
+#endif /* WAVERING_H_ */
@@ -0,0 +1,90 @@
+/****************************************************************************
+ * WaveSeq.c
+ * Plays a list of steps, each held for a whole number of ticks. The caller
+ * converts the step times to ticks once, samples at the DAC rate for the
+ * sine outputs or reloads of the PWM counter for the pulse output, then
+ * splits its render loop or counts its interrupts with WaveSeqRun() and
+ * WaveSeqAdvance(), so every transition lands on its exact tick. There are
+ * no divides past WaveSeqTicks().
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveSeq.h"
+
+/****************************************************************************
+ * WaveSeqTicks() - Public
+ * Ticks in time_ms at clock/div ticks per second, rounded, at least one so
+ * every step is heard.
+ ****************************************************************************/
+INT32U WaveSeqTicks(INT32U time_ms, INT32U clock, INT32U div){
+    INT64U den = (INT64U)div * 1000u;
+    INT64U ticks;
+
+    if(den == 0){
+        return 1;
+    }else{
+    }
+    ticks = (((INT64U)time_ms * clock) + (den >> 1)) / den;
+    if(ticks == 0){
+        ticks = 1;
+    }else if(ticks > 0xFFFFFFFFu){
+        ticks = 0xFFFFFFFFu;
+    }else{
+    }
+    return (INT32U)ticks;
+}
+/****************************************************************************
+ * WaveSeqStart() - Public
+ * Starts seq at step 0 with the first num_steps lengths, which the caller
+ * has filled in. num_steps 0 leaves it stopped.
+ ****************************************************************************/
+void WaveSeqStart(WAVE_SEQ *seq, INT8U num_steps, INT8U loop){
+    if(num_steps > WAVE_SEQ_MAX_STEPS){
+        num_steps = WAVE_SEQ_MAX_STEPS;
+    }else{
+    }
+    seq->num_steps = num_steps;
+    seq->loop = loop;
+    seq->index = 0;
+    seq->left = (num_steps > 0) ? seq->length[0] : 0;
+}
+/****************************************************************************
+ * WaveSeqStop() - Public
+ ****************************************************************************/
+void WaveSeqStop(WAVE_SEQ *seq){
+    seq->index = seq->num_steps;
+    seq->left = 0;
+}
+/****************************************************************************
+ * WaveSeqRun() - Public
+ * Returns how many of the next num_ticks belong to the current step, all
+ * of them once the sequence has stopped.
+ ****************************************************************************/
+INT32U WaveSeqRun(const WAVE_SEQ *seq, INT32U num_ticks){
+    if((seq->left == 0) || (seq->left >= num_ticks)){
+        return num_ticks;
+    }else{
+        return seq->left;
+    }
+}
+/****************************************************************************
+ * WaveSeqAdvance() - Public
+ * Counts num_ticks, at most WaveSeqRun() of them, off the current step.
+ * Returns TRUE when that ends the step, with seq->index at the next step or
+ * at num_steps if the sequence has stopped.
+ ****************************************************************************/
+INT8U WaveSeqAdvance(WAVE_SEQ *seq, INT32U num_ticks){
+    if(seq->left == 0){
+        return FALSE;
+    }else if(num_ticks < seq->left){
+        seq->left -= num_ticks;
+        return FALSE;
+    }else{
+    }
+    seq->index++;
+    if((seq->index >= seq->num_steps) && (seq->loop == TRUE)){
+        seq->index = 0;
+    }else{
+    }
+    seq->left = (seq->index < seq->num_steps) ? seq->length[seq->index] : 0;
+    return TRUE;
+}
@@ -0,0 +1,33 @@
+/****************************************************************************
+ * WaveSeq.h
+ * Header file for WaveSeq.c
+ * Table-driven step sequences counted in samples or PWM periods.
+ ****************************************************************************/
+#ifndef WAVESEQ_H_
+#define WAVESEQ_H_
+
+#define WAVE_SEQ_MAX_STEPS  16u
+
+/* One step of a sequence, held for time_ms                                 */
+typedef struct {
+    INT8U  shape;       /* WAVE_SHAPE, sine outputs only                    */
+    INT8U  amp;         /* sine amplitude, or pulse duty cycle in percent   */
+    INT16U freq;        /* Hz                                               */
+    INT32U time_ms;     /* time the step holds                              */
+} WAVE_SEQ_STEP;
+
+typedef struct {
+    INT32U length[WAVE_SEQ_MAX_STEPS];  /* ticks each step holds, >= 1      */
+    INT32U left;        /* ticks left in the current step, 0 once stopped   */
+    INT8U  index;       /* current step, num_steps once stopped             */
+    INT8U  num_steps;
+    INT8U  loop;        /* TRUE starts over after the last step             */
+} WAVE_SEQ;
+
+INT32U WaveSeqTicks(INT32U time_ms, INT32U clock, INT32U div);
+void WaveSeqStart(WAVE_SEQ *seq, INT8U num_steps, INT8U loop);
+void WaveSeqStop(WAVE_SEQ *seq);
+INT32U WaveSeqRun(const WAVE_SEQ *seq, INT32U num_ticks);
+INT8U WaveSeqAdvance(WAVE_SEQ *seq, INT32U num_ticks);
+
+#endif /* WAVESEQ_H_ */
@@ -0,0 +1,46 @@
+/****************************************************************************
+ * WaveStat.c
+ * Running statistics for the block timing measurements in Sinewave.c.
+ * WaveStatAdd() is a compare or two and an add so it can run inside a
+ * critical section every block. The divide is left to WaveStatAvg().
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveStat.h"
+
+/****************************************************************************
+ * WaveStatReset() - Public
+ ****************************************************************************/
+void WaveStatReset(WAVE_STAT *stat){
+    stat->count = 0;
+    stat->min = 0;
+    stat->max = 0;
+    stat->sum = 0;
+}
+/****************************************************************************
+ * WaveStatAdd() - Public
+ ****************************************************************************/
+void WaveStatAdd(WAVE_STAT *stat, INT32S value){
+    if((stat->count == 0) || (value < stat->min)){
+        stat->min = value;
+    }else{
+    }
+    if((stat->count == 0) || (value > stat->max)){
+        stat->max = value;
+    }else{
+    }
+    stat->sum += value;
+    stat->count++;
+}
+/****************************************************************************
+ * WaveStatAvg() - Public
+ * Returns the mean of the values added, 0 if there are none.
+ ****************************************************************************/
+INT32S WaveStatAvg(const WAVE_STAT *stat){
+    INT32S avg;
+    if(stat->count == 0){
+        avg = 0;
+    }else{
+        avg = (INT32S)(stat->sum / (INT64S)stat->count);
+    }
+    return avg;
+}
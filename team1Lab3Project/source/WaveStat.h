@@ -0,0 +1,20 @@
+/****************************************************************************
+ * WaveStat.h
+ * Header file for WaveStat.c
+ * Running min/avg/max of a signed measurement.
+ ****************************************************************************/
+#ifndef WAVESTAT_H_
+#define WAVESTAT_H_
+
+typedef struct {
+    INT32U count;       /* values added since the last reset                */
+    INT32S min;
+    INT32S max;
+    INT64S sum;
+} WAVE_STAT;
+
+void WaveStatReset(WAVE_STAT *stat);
+void WaveStatAdd(WAVE_STAT *stat, INT32S value);
+INT32S WaveStatAvg(const WAVE_STAT *stat);
+
+#endif /* WAVESTAT_H_ */
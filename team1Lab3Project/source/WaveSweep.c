@@ -0,0 +1,88 @@
+/****************************************************************************
+ * WaveSweep.c
+ * Sine chirp from start_freq to stop_freq over time_ms. All divides and
+ * the logarithm are done once in WaveSweepStart(), the render loops in
+ * WaveDDS.c only add (linear) or multiply (logarithmic) the phase step
+ * each sample. After the sweep the output holds the stop frequency.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveSweep.h"
+
+#define WAVE_SWEEP_MIN_SAMPLES  16u
+#define WAVE_SWEEP_MAX_LOG_STEP 0.4f    /* ln of the step ratio per sample, e^0.4 - 1 < 0.5 keeps ratio below 2^31 */
+
+/****************************************************************************
+ * WaveSweepStart() - Public
+ * Sets up sweep at sample_rate. A log sweep from or to 0 Hz is impossible
+ * and runs linear instead. The log ratio is expm1f(x), e^x - 1 without
+ * the cancellation that loses a small per-sample step in single precision.
+ * The x + x^2/2 + x^3/6 series it replaces was 2% off at x = 0.4.
+ * A log sweep takes at least enough samples to hold x, the log of the
+ * per-sample step ratio, to WAVE_SWEEP_MAX_LOG_STEP, so a short sweep over
+ * a wide range cannot overflow ratio.
+ ****************************************************************************/
+void WaveSweepStart(WAVE_SWEEP *sweep, INT32U start_freq, INT32U stop_freq, INT32U time_ms,
+                    INT32U sample_rate, WAVE_SWEEP_LAW law){
+    INT64U num_samples;
+    INT32U start_step;
+    INT8U logsweep = (INT8U)((law == WAVE_SWEEP_LOG) && (start_freq != 0) && (stop_freq != 0));
+    FP32 span = 0.0f;
+    FP32 x;
+
+    start_step = DDSPhaseStep(start_freq, sample_rate);
+    sweep->stop_step = DDSPhaseStep(stop_freq, sample_rate);
+    sweep->step = (INT64U)start_step << 32;
+    num_samples = ((INT64U)time_ms * sample_rate) / 1000u;
+    if(num_samples < WAVE_SWEEP_MIN_SAMPLES){
+        num_samples = WAVE_SWEEP_MIN_SAMPLES;
+    }else if(num_samples > 0xFFFFFFFFu){
+        num_samples = 0xFFFFFFFFu;
+    }else{
+    }
+    if(logsweep == TRUE){
+        span = logf((FP32)stop_freq / (FP32)start_freq);
+        if((FP32)num_samples < ceilf(fabsf(span) / WAVE_SWEEP_MAX_LOG_STEP)){
+            num_samples = (INT64U)ceilf(fabsf(span) / WAVE_SWEEP_MAX_LOG_STEP);
+        }else{
+        }
+    }else{
+    }
+    sweep->remaining = (INT32U)num_samples;
+    if(logsweep == TRUE){
+        sweep->law = WAVE_SWEEP_LOG;
+        x = span / (FP32)num_samples;
+        sweep->ratio = (INT32S)lroundf(expm1f(x) * 4294967296.0f);
+        sweep->delta = 0;
+    }else{
+        sweep->law = WAVE_SWEEP_LIN;
+        sweep->delta = (INT64S)((((INT64S)sweep->stop_step - (INT64S)start_step) * 4294967296LL) /
+                                (INT64S)num_samples);
+        sweep->ratio = 0;
+    }
+}
+/****************************************************************************
+ * WaveSweepBlock() - Public
+ * Renders num_samples Q15 sine samples of the sweep into out. The block
+ * that reaches the end snaps to the exact stop step and finishes there.
+ ****************************************************************************/
+void WaveSweepBlock(WAVE_SWEEP *sweep, INT32U *phase, INT16S *out, INT32U num_samples){
+    INT32U n = num_samples;
+
+    if(n > sweep->remaining){
+        n = sweep->remaining;
+    }else{
+    }
+    if(sweep->law == WAVE_SWEEP_LOG){
+        DDSSineSweepLog(phase, &sweep->step, sweep->ratio, out, n);
+    }else{
+        DDSSineSweepLin(phase, &sweep->step, sweep->delta, out, n);
+    }
+    sweep->remaining -= n;
+    if(sweep->remaining == 0){
+        sweep->step = (INT64U)sweep->stop_step << 32;
+        DDSSineBlock(phase, sweep->stop_step, &out[n], num_samples - n);
+    }else{
+    }
+}
@@ -0,0 +1,24 @@
+/****************************************************************************
+ * WaveSweep.h
+ * Header file for WaveSweep.c
+ * Linear and logarithmic sine frequency sweeps (chirps).
+ ****************************************************************************/
+#ifndef WAVESWEEP_H_
+#define WAVESWEEP_H_
+
+typedef enum {WAVE_SWEEP_LIN, WAVE_SWEEP_LOG} WAVE_SWEEP_LAW;
+
+typedef struct {
+    INT64U step;        /* phase step now, Q32.32                           */
+    INT64S delta;       /* WAVE_SWEEP_LIN, added to step every sample       */
+    INT32S ratio;       /* WAVE_SWEEP_LOG, step *= 1 + ratio/2^32 per sample */
+    INT32U stop_step;   /* phase step at the stop frequency                 */
+    INT32U remaining;   /* samples left in the sweep, 0 once it is done     */
+    INT8U  law;
+} WAVE_SWEEP;
+
+void WaveSweepStart(WAVE_SWEEP *sweep, INT32U start_freq, INT32U stop_freq, INT32U time_ms,
+                    INT32U sample_rate, WAVE_SWEEP_LAW law);
+void WaveSweepBlock(WAVE_SWEEP *sweep, INT32U *phase, INT16S *out, INT32U num_samples);
+
+#endif /* WAVESWEEP_H_ */
@@ -0,0 +1,163 @@
+/****************************************************************************
+ * WaveTone.c
+ * Multi-tone generator for distortion and intermodulation tests. Up to
+ * WAVE_TONE_MAX harmonics of the generator frequency, each with its own
+ * amplitude and phase, are summed into one Q15 block.
+ * Each tone is a second order resonator, y[n] = 2*cos(w)*y[n-1] - y[n-2],
+ * run as y[n] = 2*y[n-1] - y[n-2] - k*y[n-1] with k = 2 - 2*cos(w). k is
+ * stored normalised with its own shift, since for a tone far below the
+ * sample rate 2*cos(w) is 2 to within a few Q30 counts. That is one
+ * multiply per tone per sample instead of a table lookup.
+ * The state is Q29 and is re-seeded from the DDS table at the exact
+ * generator phase at the start of every block, which stops the amplitude
+ * and phase drift of the recursion and keeps the tones locked to the
+ * generator phase accumulator. The second seed is taken as the first less
+ * the difference 2*A*cos*sin(w/2), not from a second table lookup, so the
+ * Q15 table error does not turn into a slope error on slow tones.
+ * Headroom scaling is worked out once in WaveToneSet() and k once per step
+ * change, in float.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveTone.h"
+
+#define WAVE_TONE_FULL  (32767 - (INT32S)WAVE_TONE_MAX)  /* room for each tone's rounding */
+
+static void waveToneCoefs(WAVE_TONES *tones, INT32U step);
+static void waveToneNorm(FP32 value, INT32S *man, INT8U *shift);
+
+/****************************************************************************
+ * WaveToneSet() - Public
+ * Loads num_tones tones from set, dropping harmonic 0 and any past
+ * WAVE_TONE_MAX. If the amplitudes add up to more than full scale they are
+ * all scaled down by the same factor, so the sum can never clip.
+ ****************************************************************************/
+void WaveToneSet(WAVE_TONES *tones, const WAVE_TONE_SET *set, INT8U num_tones){
+    INT32S sum = 0;
+    INT8U i;
+    INT8U k = 0;
+
+    for(i = 0; (i < num_tones) && (k < WAVE_TONE_MAX); i++){
+        if(set[i].harmonic != 0){
+            tones->harmonic[k] = set[i].harmonic;
+            tones->amp[k] = (set[i].amp > 32767u) ? 32767 : (INT32S)set[i].amp;
+            tones->phase[k] = (INT32U)set[i].phase << 16;
+            sum += tones->amp[k];
+            k++;
+        }else{
+        }
+    }
+    if(sum > WAVE_TONE_FULL){
+        for(i = 0; i < k; i++){
+            tones->amp[i] = (INT32S)(((INT64S)tones->amp[i] * WAVE_TONE_FULL) / sum);
+        }
+    }else{
+    }
+    tones->num_tones = k;
+    waveToneCoefs(tones, 0);
+}
+/****************************************************************************
+ * waveToneCoefs() - Private
+ * k = 4*sin^2(w/2) and g = 2*sin(w/2) for each tone at generator step.
+ ****************************************************************************/
+static void waveToneCoefs(WAVE_TONES *tones, INT32U step){
+    INT64U tone_step;
+    FP32 g;
+    INT8U i;
+
+    tones->step = step;
+    for(i = 0; i < tones->num_tones; i++){
+        tone_step = (INT64U)step * tones->harmonic[i];
+        if((tone_step == 0) || (tone_step >= 0x80000000u)){
+            tones->k_man[i] = 0;                        /* silent, would alias */
+            tones->k_shift[i] = 0;
+            tones->g_man[i] = 0;
+            tones->g_shift[i] = 0;
+        }else{
+            g = 2.0f * sinf(((FP32)tone_step * 3.14159265f) / 4294967296.0f);
+            waveToneNorm(g * g, &tones->k_man[i], &tones->k_shift[i]);
+            waveToneNorm(g, &tones->g_man[i], &tones->g_shift[i]);
+        }
+    }
+}
+/****************************************************************************
+ * waveToneNorm() - Private
+ * value as man/2^shift with man filling 31 bits, for 0 < value < 4. The
+ * shift is at least 29 and held to 62 so the products stay in 64 bits.
+ ****************************************************************************/
+static void waveToneNorm(FP32 value, INT32S *man, INT8U *shift){
+    int exp;
+    INT32S sh;
+
+    (void)frexpf(value, &exp);                          /* value = m*2^exp, 0.5 <= m < 1 */
+    sh = 31 - exp;
+    if(sh > 62){
+        sh = 62;
+    }else{
+    }
+    *man = (INT32S)lroundf(ldexpf(value, (int)sh));
+    if(*man < 0){                                       /* rounded up to 2^31 */
+        *man = 0x7FFFFFFF;
+    }else{
+    }
+    *shift = (INT8U)sh;
+}
+/****************************************************************************
+ * WaveToneRender() - Public
+ * Renders num_samples Q15 samples of the tone sum into out for a generator
+ * at phase and step. The caller advances its own phase.
+ ****************************************************************************/
+void WaveToneRender(WAVE_TONES *tones, INT32U phase, INT32U step, INT16S *out, INT32U num_samples){
+    INT32U ph;
+    INT32U tone_step;
+    INT64S k_man;
+    INT64S k_round;
+    INT8U k_shift;
+    INT32S y0;
+    INT32S y1;
+    INT32S y2;
+    INT8U first = TRUE;
+    INT32U i;
+    INT8U t;
+
+    if(step != tones->step){
+        waveToneCoefs(tones, step);
+    }else{
+    }
+    for(t = 0; t < tones->num_tones; t++){
+        if(tones->k_man[t] != 0){
+            k_man = tones->k_man[t];
+            k_shift = tones->k_shift[t];
+            k_round = (INT64S)1 << (k_shift - 1);
+            tone_step = step * tones->harmonic[t];
+            ph = (phase * tones->harmonic[t]) + tones->phase[t];
+            y1 = (tones->amp[t] * DDSSineSample(ph - tone_step)) >> 1;
+            y2 = y1 - (INT32S)(((INT64S)(tones->amp[t] * DDSSineSample(ph - tone_step - (tone_step >> 1) + 0x40000000u)) *
+                                tones->g_man[t]) >> (tones->g_shift[t] + 1u));
+            if(first == TRUE){
+                for(i = 0; i < num_samples; i++){
+                    y0 = ((2 * y1) - y2) - (INT32S)(((k_man * y1) + k_round) >> k_shift);
+                    y2 = y1;
+                    y1 = y0;
+                    out[i] = (INT16S)((y0 + 0x2000) >> 14);
+                }
+                first = FALSE;
+            }else{
+                for(i = 0; i < num_samples; i++){
+                    y0 = ((2 * y1) - y2) - (INT32S)(((k_man * y1) + k_round) >> k_shift);
+                    y2 = y1;
+                    y1 = y0;
+                    out[i] = (INT16S)(out[i] + ((y0 + 0x2000) >> 14));
+                }
+            }
+        }else{
+        }
+    }
+    if(first == TRUE){
+        for(i = 0; i < num_samples; i++){
+            out[i] = 0;
+        }
+    }else{
+    }
+}
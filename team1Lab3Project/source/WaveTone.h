@@ -0,0 +1,37 @@
+/****************************************************************************
+ * WaveTone.h
+ * Header file for WaveTone.c
+ * Sum of harmonics of a generator from recursive sine oscillators.
+ ****************************************************************************/
+#ifndef WAVETONE_H_
+#define WAVETONE_H_
+
+#define WAVE_TONE_MAX   8u
+
+/* One tone as configured */
+typedef struct {
+    INT16U harmonic;    /* multiple of the generator frequency, 0 drops the tone */
+    INT16U amp;         /* Q15, scaled down together if the sum exceeds full scale */
+    INT16U phase;       /* start phase, 2^16 per period                     */
+} WAVE_TONE_SET;
+
+/* Tone set at run time. k = 2 - 2*cos(w) is k_man/2^k_shift and
+ * g = 2*sin(w/2) is g_man/2^g_shift for the step they were last worked out
+ * at. k_man is 0 for a tone at or above half the sample rate.             */
+struct WAVE_TONES_S {
+    INT32S k_man[WAVE_TONE_MAX];
+    INT32S g_man[WAVE_TONE_MAX];
+    INT8U  k_shift[WAVE_TONE_MAX];
+    INT8U  g_shift[WAVE_TONE_MAX];
+    INT32S amp[WAVE_TONE_MAX];      /* Q15 after headroom scaling           */
+    INT32U harmonic[WAVE_TONE_MAX];
+    INT32U phase[WAVE_TONE_MAX];    /* 2^32 per period                      */
+    INT32U step;                    /* generator step coef belongs to       */
+    INT8U  num_tones;
+};
+typedef struct WAVE_TONES_S WAVE_TONES;
+
+void WaveToneSet(WAVE_TONES *tones, const WAVE_TONE_SET *set, INT8U num_tones);
+void WaveToneRender(WAVE_TONES *tones, INT32U phase, INT32U step, INT16S *out, INT32U num_samples);
+
+#endif /* WAVETONE_H_ */
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""
+GenInterpTable.py
+Generates source/InterpTable.c, the polyphase FIR taps for the interpolating
+upsampler in WaveInterp.c.
+
+Usage: python3 tools/GenInterpTable.py [factor] [taps] [beta] > source/InterpTable.c
+
+factor and taps must match WAVE_INTERP_L and WAVE_INTERP_TAPS in
+WaveInterp.h. The prototype is a factor*taps long Kaiser windowed sinc with
+its cutoff at half the render rate and a gain of factor, so every phase
+passes the render-rate signal at unity. Defaults are 4 8 7.0, about -70 dB
+on the images of tones up to 0.2 of the render rate.
+Each phase is stored oldest-sample-first for the dot product in
+WaveInterpBlock().
+"""
+import math
+import sys
+
+
+def bessel_i0(x):
+    total = 1.0
+    term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def main():
+    factor = int(sys.argv[1]) if len(sys.argv) > 1 else 4
+    taps = int(sys.argv[2]) if len(sys.argv) > 2 else 8
+    beta = float(sys.argv[3]) if len(sys.argv) > 3 else 7.0
+    num = factor * taps
+    fc = 0.5 / factor
+    proto = []
+    for n in range(num):
+        m = n - (num - 1) / 2.0
+        if m == 0:
+            sinc = 2.0 * fc
+        else:
+            sinc = math.sin(2.0 * math.pi * fc * m) / (math.pi * m)
+        win = bessel_i0(beta * math.sqrt(1.0 - (2.0 * n / (num - 1) - 1.0) ** 2)) / bessel_i0(beta)
+        proto.append(factor * sinc * win)
+
+    out = []
+    out.append("/****************************************************************************")
+    out.append(" * InterpTable.c")
+    out.append(" * Polyphase FIR taps, Q15, for the interpolating upsampler in WaveInterp.c.")
+    out.append(" * GENERATED FILE - do not edit. Regenerate with:")
+    out.append(" *     python3 tools/GenInterpTable.py %d %d %.1f > source/InterpTable.c"
+               % (factor, taps, beta))
+    out.append(" ****************************************************************************/")
+    out.append("#include \"MCUType.h\"")
+    out.append("#include \"WaveInterp.h\"")
+    out.append("")
+    out.append("#if (WAVE_INTERP_L != %d) || (WAVE_INTERP_TAPS != %d)" % (factor, taps))
+    out.append("#error \"InterpTable.c does not match WaveInterp.h, regenerate it\"")
+    out.append("#endif")
+    out.append("")
+    out.append("const INT16S WaveInterpTable[WAVE_INTERP_L][WAVE_INTERP_TAPS] = {")
+    for p in range(factor):
+        vals = [proto[(taps - 1 - m) * factor + p] for m in range(taps)]
+        q15 = [max(-32768, min(32767, int(round(32768.0 * v)))) for v in vals]
+        sep = "," if p + 1 < factor else ""
+        out.append("    {" + ", ".join("%6d" % v for v in q15) + "}" + sep)
+    out.append("};")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""
+GenSineTable.py
+Generates source/SineTable.c, the flash-resident quarter-wave sine table used
+by the DDS engine in WaveDDS.c.
+
+Usage: python3 tools/GenSineTable.py [qtr_bits] > source/SineTable.c
+
+qtr_bits sets the table to 2^qtr_bits entries plus one guard entry and must
+match DDS_QTR_BITS in WaveDDS.h. Default is 8 (1024 points per full period).
+"""
+import math
+import sys
+
+
+def main():
+    qtr_bits = int(sys.argv[1]) if len(sys.argv) > 1 else 8
+    size = 1 << qtr_bits
+    vals = [int(round(32767.0 * math.sin(0.5 * math.pi * i / size)))
+            for i in range(size + 1)]
+
+    out = []
+    out.append("/****************************************************************************")
+    out.append(" * SineTable.c")
+    out.append(" * Quarter-wave sine table, Q15, for the DDS engine in WaveDDS.c.")
+    out.append(" * GENERATED FILE - do not edit. Regenerate with:")
+    out.append(" *     python3 tools/GenSineTable.py %d > source/SineTable.c" % qtr_bits)
+    out.append(" ****************************************************************************/")
+    out.append("#include \"MCUType.h\"")
+    out.append("#include \"WaveDDS.h\"")
+    out.append("")
+    out.append("#if (DDS_QTR_BITS != %d)" % qtr_bits)
+    out.append("#error \"SineTable.c does not match DDS_QTR_BITS, regenerate it\"")
+    out.append("#endif")
+    out.append("")
+    out.append("const INT16S DDSQtrSineTable[DDS_QTR_SIZE + 1] = {")
+    for i in range(0, len(vals), 8):
+        row = ", ".join("%6d" % v for v in vals[i:i + 8])
+        sep = "," if i + 8 < len(vals) else ""
+        out.append("    " + row + sep)
+    out.append("};")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""
+GenWaveMip.py
+Generates source/WaveMipTables.c, the band-limited octave tables (mipmaps)
+of the sawtooth, square and triangle generators in WaveGen.c.
+
+Usage: python3 tools/GenWaveMip.py [levels] [top_harm] > source/WaveMipTables.c
+
+levels and top_harm must match WAVE_MIP_LEVELS and WAVE_MIP_TOP_HARM in
+WaveMip.h. Level j holds harmonics 1..top_harm>>j of the ideal shape, summed
+from its Fourier series, so it plays alias-free up to a phase step of
+2^31/(top_harm>>j). Each table has at least 8 entries per period of its top
+harmonic, 256 at least, so linear interpolation stays well below the 12-bit
+DAC. Defaults are 9 256.
+All levels of a shape share one scale, the one that fits the largest Gibbs
+overshoot into Q15, so the fundamental has the same level at every octave.
+The phase follows the naive generators: 0 starts the period rising through
+zero (sawtooth, triangle) or at the rising edge (square).
+"""
+import math
+import sys
+
+
+def series(shape, h):
+    """Sine coefficient of harmonic h, 0 where the shape has none."""
+    if shape == "Sawtooth":
+        return (2.0 / math.pi) * (1.0 if h % 2 else -1.0) / h
+    if h % 2 == 0:
+        return 0.0
+    if shape == "Square":
+        return (4.0 / math.pi) / h
+    return (8.0 / (math.pi * math.pi)) * (1.0 if h % 4 == 1 else -1.0) / (h * h)
+
+
+def level_bits(harm):
+    bits = 8
+    while (1 << bits) < 8 * harm:
+        bits += 1
+    return bits
+
+
+def render(shape, harm, bits):
+    size = 1 << bits
+    coefs = [(h, series(shape, h)) for h in range(1, harm + 1)]
+    return [sum(c * math.sin(2.0 * math.pi * h * n / size) for h, c in coefs if c != 0.0)
+            for n in range(size)]
+
+
+def main():
+    levels = int(sys.argv[1]) if len(sys.argv) > 1 else 9
+    top_harm = int(sys.argv[2]) if len(sys.argv) > 2 else 256
+    shapes = ["Sawtooth", "Square", "Triangle"]
+
+    out = []
+    out.append("/****************************************************************************")
+    out.append(" * WaveMipTables.c")
+    out.append(" * Band-limited octave tables, Q15, for the WaveGen.c sawtooth, square and")
+    out.append(" * triangle generators. See WaveMip.h.")
+    out.append(" * GENERATED FILE - do not edit. Regenerate with:")
+    out.append(" *     python3 tools/GenWaveMip.py %d %d > source/WaveMipTables.c" % (levels, top_harm))
+    out.append(" ****************************************************************************/")
+    out.append("#include \"MCUType.h\"")
+    out.append("#include \"WaveGen.h\"")
+    out.append("#include \"WaveMip.h\"")
+    out.append("")
+    out.append("#if (WAVE_MIP_LEVELS != %d) || (WAVE_MIP_TOP_HARM != %d)" % (levels, top_harm))
+    out.append("#error \"WaveMipTables.c does not match WaveMip.h, regenerate it\"")
+    out.append("#endif")
+    for shape in shapes:
+        tables = []
+        for j in range(levels):
+            harm = top_harm >> j
+            bits = level_bits(harm)
+            tables.append((harm, bits, render(shape, harm, bits)))
+        peak = max(max(abs(v) for v in t) for _, _, t in tables)
+        scale = 32767.0 / peak
+        for j, (harm, bits, t) in enumerate(tables):
+            vals = [int(round(v * scale)) for v in t]
+            out.append("")
+            out.append("/* %s, harmonics 1..%d */" % (shape, harm))
+            out.append("static const INT16S waveMip%s%d[%d] = {" % (shape, j, 1 << bits))
+            for i in range(0, len(vals), 8):
+                row = ", ".join("%6d" % v for v in vals[i:i + 8])
+                sep = "," if i + 8 < len(vals) else ""
+                out.append("    " + row + sep)
+            out.append("};")
+        out.append("")
+        out.append("const WAVE_MIPMAP WaveMip%s = {" % shape)
+        ptrs = ["&waveMip%s%d[0]" % (shape, j) for j in range(levels)]
+        out.append("    {")
+        for i in range(0, levels, 3):
+            sep = "," if i + 3 < levels else ""
+            out.append("        " + ", ".join(ptrs[i:i + 3]) + sep)
+        out.append("    },")
+        out.append("    {" + ", ".join("%du" % b for _, b, _ in tables) + "}")
+        out.append("};")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,467 @@
+/****************************************************************************
+ * WaveBench.c
+ * Host benchmark of the hot paths of the firmware, built on a PC from the
+ * same source files with tools/host/Host.mk:
+ *  - the sample loop of sinewaveProcTask(), WaveRenderBlock() itself, for
+ *    each shape, with effects, AM and the upsampling path, which only the
+ *    tones shape with WAVE_GEN_UP_TONES or more tones takes,
+ *    WaveGenUpsampleWins(). tones8 against tones8_upsample shows the win at
+ *    WAVE_TONE_MAX tones. sine_upsample asks to upsample a table shape,
+ *    which WaveRenderBlock() declines, so it runs as sine_stream
+ *  - one channel of table DDS and DAC format against the per-sample
+ *    arm_sin_q31() loop it replaced, tools/host/HostSinQ31.h
+ *  - the FTM value computation of PulsewaveTask(), WavePwm.c
+ *  - MemFill() and MemChkSum() from MemoryTools.c
+ *  - the digit conversion of LcdDispDecWord(), LcdDec.c
+ *
+ * Every case runs a fixed amount of work, BENCH_WARMUP times untimed and
+ * then BENCH_REPS times timed, and reports the fastest. Each case is then
+ * timed against BENCH_REF, run again right after it: the old sine loop,
+ * host-only code that never changes. The ratio is what the baseline holds
+ * and compares, so a slower or busier machine moves both alike and only
+ * a case that slowed against the reference counts as a regression. The
+ * ratios only compare between builds with one compiler.
+ *
+ * Usage: WaveBench              ns and units per second, and the ratio
+ *        WaveBench -r           name and ratio, the baseline format
+ *        WaveBench base [pct]   also compares the ratios with the baseline
+ *                               file base and exits 1 if a case is more
+ *                               than pct percent slower, BENCH_TOLERANCE
+ *                               by default
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MCUType.h"
+#include "app_cfg.h"
+#include "WaveRender.h"
+#include "WaveDDS.h"
+#include "WaveDac.h"
+#include "WavePwm.h"
+#include "MemoryTools.h"
+#include "LcdLayered.h"
+#include "LcdDec.h"
+#include "HostSinQ31.h"
+
+#define BENCH_WARMUP        3u
+#define BENCH_REPS          15u
+#define BENCH_TOLERANCE     20.0        /* percent slower flagged as a regression */
+#define BENCH_REF           "sine_q31_old" /* case the ratios are taken to          */
+#define BENCH_RATE          48000u      /* sample rate of the stream cases, Hz     */
+#define BENCH_FREQ          1000u       /* generator frequency, Hz                 */
+#define BENCH_TONES8_FREQ   250u        /* 8 tones within WAVE_INTERP_MAX_STEP     */
+#define BENCH_BLOCK         WAVE_PLAN_MAX_BLOCK
+#define BENCH_BLOCKS        200u        /* blocks per stream run                   */
+#define BENCH_CALLS         1000000u    /* calls per PWM and decimal run           */
+#define BENCH_MEM_BYTES     65536u
+#define BENCH_MEM_PASSES    100u
+#define BENCH_MAX_CASES     32u
+#define BENCH_AMP           20          /* Sinewave.c amplitude of the sine cases  */
+
+typedef struct {
+    const char *name;
+    const char *unit;
+    void (*setup)(void);    /* untimed, before the warm-up, or NULL */
+    void (*run)(void);
+    FP64 units;             /* units of work in one run */
+} BENCH_CASE;
+
+static void benchSetup(WAVE_SHAPE shape, INT8U fx, WAVE_MOD_TYPE mod);
+static void benchStream(void);
+static void benchDDS(void);
+static void benchSinQ31(void);
+static void benchUpsample(void);
+static void benchDacPair(void);
+static void benchPwm(void);
+static void benchDec(void);
+static void benchMemFill(void);
+static void benchMemChkSum(void);
+static void benchSine(void);
+static void benchTriangle(void);
+static void benchSawtooth(void);
+static void benchSquare(void);
+static void benchUser(void);
+static void benchTones(void);
+static void benchNoise(void);
+static void benchPink(void);
+static void benchFx(void);
+static void benchAm(void);
+static void benchTones8(void);
+static void benchDac(void);
+static FP64 benchTime(const BENCH_CASE *bcase);
+static FP64 benchNow(void);
+static INT8U benchLoad(const char *path, char names[][32], FP64 *ratio, INT8U max);
+
+static const BENCH_CASE BenchCases[] = {
+    {"sine_stream",     "sample", benchSine,     benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"sine_dds",        "sample", NULL,          benchDDS,       (FP64)BENCH_BLOCKS * BENCH_BLOCK},
+    {"sine_q31_old",    "sample", HostSinQ31Init, benchSinQ31,   (FP64)BENCH_BLOCKS * BENCH_BLOCK},
+    {"triangle_stream", "sample", benchTriangle, benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"sawtooth_stream", "sample", benchSawtooth, benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"square_stream",   "sample", benchSquare,   benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"user_stream",     "sample", benchUser,     benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"tones_stream",    "sample", benchTones,    benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"noise_stream",    "sample", benchNoise,    benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"pink_stream",     "sample", benchPink,     benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"sine_fx_stream",  "sample", benchFx,       benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"sine_am_stream",  "sample", benchAm,       benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"sine_upsample",   "sample", benchSine,     benchUpsample,  2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"tones8_stream",   "sample", benchTones8,   benchStream,    2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"tones8_upsample", "sample", benchTones8,   benchUpsample,  2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"dac_pair",        "sample", benchDac,      benchDacPair,   2.0 * BENCH_BLOCKS * BENCH_BLOCK},
+    {"pwm_calc",        "call",   NULL,          benchPwm,       (FP64)BENCH_CALLS},
+    {"lcd_dec",         "call",   NULL,          benchDec,       (FP64)BENCH_CALLS},
+    {"mem_fill",        "byte",   NULL,          benchMemFill,   (FP64)BENCH_MEM_PASSES * BENCH_MEM_BYTES},
+    {"mem_chksum",      "byte",   NULL,          benchMemChkSum, (FP64)BENCH_MEM_PASSES * BENCH_MEM_BYTES},
+};
+#define BENCH_NUM_CASES     (sizeof(BenchCases) / sizeof(BenchCases[0]))
+
+static const WAVE_TONE_SET BenchTones8[WAVE_TONE_MAX] = {
+    {1, 16384, 0}, {2, 8192, 0}, {3, 8192, 16384}, {4, 4096, 0}, {5, 4096, 0}, {6, 2048, 0}, {7, 2048, 0}, {8, 1024, 0}
+};
+static WAVE_RENDER_CH BenchChan[WAVE_RENDER_NUM_CH];
+static INT16U BenchFrames[2 * BENCH_BLOCK];
+static INT16S BenchUserTable[WAVE_USER_SIZE];
+static INT8U BenchMem[BENCH_MEM_BYTES];
+static volatile INT32U BenchSink;           /* keeps the results live */
+
+int main(int argc, char **argv){
+    static char base_names[BENCH_MAX_CASES][32];
+    static FP64 base_ratio[BENCH_MAX_CASES];
+    FP64 tol = BENCH_TOLERANCE;
+    FP64 ns;
+    FP64 ratio;
+    FP64 delta;
+    INT8U raw = FALSE;
+    INT8U num_base = 0;
+    INT8U regressions = 0;
+    INT8U ref;
+    INT8U i;
+    INT8U j;
+
+    if((argc > 1) && (strcmp(argv[1], "-r") == 0)){
+        raw = TRUE;
+    }else if(argc > 1){
+        num_base = benchLoad(argv[1], base_names, base_ratio, BENCH_MAX_CASES);
+        if(num_base == 0){
+            fprintf(stderr, "WaveBench: no baseline in %s\n", argv[1]);
+            return 2;
+        }else{
+        }
+        if(argc > 2){
+            tol = atof(argv[2]);
+        }else{
+        }
+    }else{
+    }
+    for(ref = 0; strcmp(BenchCases[ref].name, BENCH_REF) != 0; ref++){
+    }
+    for(i = 0; i < BENCH_NUM_CASES; i++){
+        ns = benchTime(&BenchCases[i]);
+        ratio = (i == ref) ? 1.0 : (ns / benchTime(&BenchCases[ref]));
+        if(raw == TRUE){
+            printf("%-16s %.4f\n", BenchCases[i].name, ratio);
+            continue;
+        }else{
+        }
+        printf("%-16s %8.3f ns/%-6s %9.2f M%s/s %8.3f ref", BenchCases[i].name, ns, BenchCases[i].unit,
+               1.0e3 / ns, BenchCases[i].unit, ratio);
+        for(j = 0; (j < num_base) && (strcmp(base_names[j], BenchCases[i].name) != 0); j++){
+        }
+        if(j < num_base){
+            delta = 100.0 * (ratio - base_ratio[j]) / base_ratio[j];
+            printf("  base %8.3f %+6.1f%%", base_ratio[j], delta);
+            if(delta > tol){
+                printf("  REGRESSION");
+                regressions++;
+            }else{
+            }
+        }else if(num_base > 0){
+            printf("  not in baseline");
+        }else{
+        }
+        printf("\n");
+    }
+    if(num_base > 0){
+        printf("%u regression(s) over %.1f%%\n", regressions, tol);
+    }else{
+    }
+    return (regressions > 0) ? 1 : 0;
+}
+
+/****************************************************************************
+ * benchSetup() - Private
+ * Starts both channels as SineWaveInit() and sineSetFreq() would, at
+ * BENCH_FREQ and BENCH_RATE and amplitude BENCH_AMP with shape, fx chain
+ * stages and mod, no sweep and no sequence.
+ ****************************************************************************/
+static void benchSetup(WAVE_SHAPE shape, INT8U fx, WAVE_MOD_TYPE mod){
+    static const WAVE_TONE_SET tones[4] = {{1, 16384, 0}, {2, 8192, 0}, {3, 8192, 16384}, {5, 4096, 0}};
+    static const WAVE_FX_SET fxset[3] = {{WAVE_FX_LOWPASS, 4000}, {WAVE_FX_HIGHPASS, 20}, {WAVE_FX_CLIP, 30000}};
+    INT32U i;
+    INT8U ch;
+
+    for(i = 0; i < WAVE_USER_SIZE; i++){            /* a ramp, then one sine period */
+        BenchUserTable[i] = (i < (WAVE_USER_SIZE / 2)) ? (INT16S)((INT32S)(i * 256u) - 32768) :
+                            DDSSineSample((i - (WAVE_USER_SIZE / 2)) << (32 - WAVE_USER_BITS + 1));
+    }
+    for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+        BenchChan[ch].sweep.remaining = 0;
+        WaveSeqStart(&BenchChan[ch].seq, 0, FALSE);
+        WaveModStart(&BenchChan[ch].mod, mod, 500, 50, BENCH_RATE);
+        WaveFxChainInit(&BenchChan[ch].fx, &fxset[0], fx, BENCH_RATE);
+        WaveToneSet(&BenchChan[ch].tones, &tones[0], 4);
+        WaveNoiseSeed(&BenchChan[ch].noise, ch);
+        WaveMipBuildUser(&BenchChan[ch].usermip, &BenchUserTable[0]);
+        BenchChan[ch].gen.tones = &BenchChan[ch].tones;
+        BenchChan[ch].gen.noise = &BenchChan[ch].noise;
+        BenchChan[ch].gen.user = &BenchChan[ch].usermip;
+        BenchChan[ch].shape = (INT8U)shape;
+        BenchChan[ch].step = DDSPhaseStep(BENCH_FREQ, BENCH_RATE);
+        BenchChan[ch].amp = BENCH_AMP;
+        WaveRenderSeqApply(&BenchChan[ch]);
+        BenchChan[ch].gen.phase = ch * 0x40000000u;
+    }
+}
+
+/****************************************************************************
+ * benchStream() - Private
+ * WaveRenderBlock() direct, as sinewaveProcTask() fills the ring without
+ * SetSinUpsample(): render, effects and the DAC frame format,
+ * BENCH_BLOCKS blocks of BENCH_BLOCK frames.
+ ****************************************************************************/
+static void benchStream(void){
+    INT32U blk;
+
+    for(blk = 0; blk < BENCH_BLOCKS; blk++){
+        WaveRenderBlock(&BenchChan[0], &BenchFrames[0], BENCH_BLOCK, FALSE);
+        BenchSink += BenchFrames[blk % BENCH_BLOCK];
+    }
+}
+
+/****************************************************************************
+ * benchDDS() - Private
+ * The WaveDDS.c path of one channel at amplitude BENCH_AMP: DDSSineBlock()
+ * and WaveDacFormat(), BENCH_BLOCKS blocks of BENCH_BLOCK samples.
+ ****************************************************************************/
+static void benchDDS(void){
+    static INT32U phase = 0;
+    INT32U step = DDSPhaseStep(BENCH_FREQ, BENCH_RATE);
+    INT32U blk;
+
+    for(blk = 0; blk < BENCH_BLOCKS; blk++){
+        DDSSineBlock(&phase, step, &BenchChan[0].block[0], BENCH_BLOCK);
+        WaveDacFormat(&BenchChan[0].block[0], &BenchFrames[0], BENCH_BLOCK, BENCH_AMP * WAVE_RENDER_AMP_SCALE);
+        BenchSink += BenchFrames[blk % BENCH_BLOCK];
+    }
+}
+
+/****************************************************************************
+ * benchSinQ31() - Private
+ * The sinewaveProcTask() loop WaveDDS.c replaced, as much work as
+ * benchDDS(): a Q31 phase step, arm_sin_q31() and the /22, >> 20 scaling
+ * per sample.
+ ****************************************************************************/
+static void benchSinQ31(void){
+    static INT32S arg = 0;
+    INT32S step = (INT32S)(BENCH_FREQ * HOST_SIN_Q31_STEP);
+    INT32U blk;
+    INT32U i;
+
+    for(blk = 0; blk < BENCH_BLOCKS; blk++){
+        for(i = 0; i < BENCH_BLOCK; i++){
+            arg = (arg + step) & 0x7FFFFFFF;
+            BenchFrames[i] = (INT16U)HostSinQ31Dac(BENCH_AMP, arg);
+        }
+        BenchSink += BenchFrames[blk % BENCH_BLOCK];
+    }
+}
+
+/****************************************************************************
+ * Case setups - Private
+ ****************************************************************************/
+static void benchSine(void){
+    benchSetup(WAVE_SHAPE_SINE, 0, WAVE_MOD_OFF);
+}
+static void benchTriangle(void){
+    benchSetup(WAVE_SHAPE_TRIANGLE, 0, WAVE_MOD_OFF);
+}
+static void benchSawtooth(void){
+    benchSetup(WAVE_SHAPE_SAWTOOTH, 0, WAVE_MOD_OFF);
+}
+static void benchSquare(void){
+    benchSetup(WAVE_SHAPE_SQUARE, 0, WAVE_MOD_OFF);
+}
+static void benchUser(void){
+    benchSetup(WAVE_SHAPE_USER, 0, WAVE_MOD_OFF);
+}
+static void benchTones(void){
+    benchSetup(WAVE_SHAPE_TONES, 0, WAVE_MOD_OFF);
+}
+static void benchNoise(void){
+    benchSetup(WAVE_SHAPE_NOISE, 0, WAVE_MOD_OFF);
+}
+static void benchPink(void){
+    benchSetup(WAVE_SHAPE_PINK, 0, WAVE_MOD_OFF);
+}
+static void benchFx(void){
+    benchSetup(WAVE_SHAPE_SINE, 3, WAVE_MOD_OFF);
+}
+static void benchAm(void){
+    benchSetup(WAVE_SHAPE_SINE, 0, WAVE_MOD_AM);
+}
+static void benchTones8(void){
+    INT8U ch;
+
+    benchSetup(WAVE_SHAPE_TONES, 0, WAVE_MOD_OFF);
+    for(ch = 0; ch < WAVE_RENDER_NUM_CH; ch++){
+        WaveToneSet(&BenchChan[ch].tones, &BenchTones8[0], WAVE_TONE_MAX);
+        BenchChan[ch].step = DDSPhaseStep(BENCH_TONES8_FREQ, BENCH_RATE);
+        BenchChan[ch].gen.step = BenchChan[ch].step;
+    }
+}
+static void benchDac(void){
+    benchSetup(WAVE_SHAPE_SINE, 0, WAVE_MOD_OFF);
+    benchStream();
+}
+
+/****************************************************************************
+ * benchUpsample() - Private
+ * WaveRenderBlock() with SetSinUpsample() on: a channel WaveGenUpsampleWins()
+ * picks renders a quarter of the samples at WAVE_INTERP_L times the step
+ * through the interpolation FIR, any other renders direct.
+ ****************************************************************************/
+static void benchUpsample(void){
+    INT32U blk;
+
+    for(blk = 0; blk < BENCH_BLOCKS; blk++){
+        WaveRenderBlock(&BenchChan[0], &BenchFrames[0], BENCH_BLOCK, TRUE);
+        BenchSink += BenchFrames[blk % BENCH_BLOCK];
+    }
+}
+
+/****************************************************************************
+ * benchDacPair() - Private
+ * WaveDacFormatPair() alone, on the blocks benchDac() rendered.
+ ****************************************************************************/
+static void benchDacPair(void){
+    INT32U blk;
+
+    for(blk = 0; blk < BENCH_BLOCKS; blk++){
+        WaveDacFormatPair(&BenchChan[0].block[0], &BenchChan[1].block[0], &BenchFrames[0], BENCH_BLOCK,
+                          (INT16S)(20000 + blk), 30000);
+        BenchSink += BenchFrames[blk % BENCH_BLOCK];
+    }
+}
+
+/****************************************************************************
+ * benchPwm() - Private
+ * The PulsewaveTask() update: prescaler, MOD and CnV for frequencies
+ * spread over 10 Hz to 10 kHz and every duty.
+ ****************************************************************************/
+static void benchPwm(void){
+    WAVE_PWM pwm;
+    INT32U freq;
+    INT32U i;
+
+    for(i = 0; i < BENCH_CALLS; i++){
+        freq = 10u + ((i * 7919u) % 9991u);
+        WavePwmPrescale(freq, &pwm);
+        WavePwmCalc(freq, (INT16U)(i % 101u), &pwm);
+        BenchSink += pwm.mod + pwm.cnv;
+    }
+}
+
+/****************************************************************************
+ * benchDec() - Private
+ * LcdDecFormat() for six digit fields in all three modes.
+ ****************************************************************************/
+static void benchDec(void){
+    INT8C chars[LCD_COL_16];
+    INT32U i;
+
+    for(i = 0; i < BENCH_CALLS; i++){
+        (void)LcdDecFormat(&chars[0], (i * 2654435761u) % 1000000u, 6, (LCD_MODE)(i % 3u));
+        BenchSink += (INT32U)chars[0];
+    }
+}
+
+static void benchMemFill(void){
+    INT32U i;
+
+    for(i = 0; i < BENCH_MEM_PASSES; i++){
+        MemFill((INT8U)i, &BenchMem[0], &BenchMem[BENCH_MEM_BYTES - 1]);
+    }
+    BenchSink += BenchMem[BENCH_MEM_BYTES / 2];
+}
+
+static void benchMemChkSum(void){
+    INT32U i;
+
+    for(i = 0; i < BENCH_MEM_PASSES; i++){
+        BenchSink += MemChkSum(&BenchMem[0], &BenchMem[BENCH_MEM_BYTES - 1]);
+    }
+}
+
+/****************************************************************************
+ * benchTime() - Private
+ * Sets up bcase and runs it BENCH_WARMUP times, then returns the fastest of BENCH_REPS
+ * timed runs in ns per unit.
+ ****************************************************************************/
+static FP64 benchTime(const BENCH_CASE *bcase){
+    FP64 best = 0.0;
+    FP64 start;
+    FP64 t;
+    INT32U i;
+
+    if(bcase->setup != NULL){
+        bcase->setup();
+    }else{
+    }
+    for(i = 0; i < BENCH_WARMUP; i++){
+        bcase->run();
+    }
+    for(i = 0; i < BENCH_REPS; i++){
+        start = benchNow();
+        bcase->run();
+        t = benchNow() - start;
+        if((i == 0) || (t < best)){
+            best = t;
+        }else{
+        }
+    }
+    return best / bcase->units;
+}
+
+static FP64 benchNow(void){
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((FP64)ts.tv_sec * 1.0e9) + (FP64)ts.tv_nsec;
+}
+
+/****************************************************************************
+ * benchLoad() - Private
+ * Reads up to max "name ratio" lines from the baseline file at path,
+ * skipping blank lines and # comments. Returns the number read, 0 if none.
+ ****************************************************************************/
+static INT8U benchLoad(const char *path, char names[][32], FP64 *ratio, INT8U max){
+    char line[128];
+    FILE *fp;
+    INT8U num = 0;
+
+    fp = fopen(path, "r");
+    if(fp == NULL){
+        return 0;
+    }else{
+    }
+    while((num < max) && (fgets(line, sizeof(line), fp) != NULL)){
+        if((line[0] != '#') && (sscanf(line, "%31s %lf", names[num], &ratio[num]) == 2) && (ratio[num] > 0.0)){
+            num++;
+        }else{
+        }
+    }
+    fclose(fp);
+    return num;
+}
@@ -0,0 +1,50 @@
+#############################################################################
+# Host.mk - Builds the OS-free modules for a PC, for tools/bench and
+# tools/test. Include it after setting OUT, the build directory.
+#
+# $(OUT)/libwave.a      portable C paths, as the K65 build without the DSP
+# $(OUT)/libwave_dsp.a  DSP intrinsic paths on tools/host/HostDsp.h
+#
+# The modules keep their own #include "MCUType.h". HostMCUType.h is forced
+# ahead of it and claims its guard, so no source file is copied or edited.
+#############################################################################
+HOST_DIR  := $(abspath $(dir $(lastword $(MAKEFILE_LIST))))
+PROJ_DIR  := $(abspath $(HOST_DIR)/../..)
+
+CFLAGS    ?= -O2
+HOST_WARN := -Wall -Wextra -Wno-unused-parameter
+HOST_INC  := -include $(HOST_DIR)/HostMCUType.h -I$(HOST_DIR) \
+             -I$(PROJ_DIR)/source -I$(PROJ_DIR)/board -I$(PROJ_DIR)/uCOS/uC-CFG
+HOST_LIBS := -lm
+
+# These modules have no OS or hardware dependencies: no uC/OS calls and no
+# K65 registers, only MCUType.h and each other. That is what lets the bench
+# and the tests build them here, so a module that needs either has to come
+# off this list.
+HOST_SRC  := WaveAna.c WaveDDS.c WaveDac.c WaveDacBuf.c WaveFft.c WaveFx.c \
+             WaveGen.c WaveInterp.c WaveMip.c WaveMipTables.c WaveMod.c \
+             WaveNoise.c WavePlan.c WavePwm.c WaveRender.c WaveRing.c \
+             WaveSeq.c WaveStat.c WaveSweep.c WaveTone.c SineTable.c \
+             InterpTable.c MemoryTools.c LcdDec.c
+
+vpath %.c $(PROJ_DIR)/source $(PROJ_DIR)/board
+
+HOST_OBJ     := $(addprefix $(OUT)/obj/,$(HOST_SRC:.c=.o))
+HOST_OBJ_DSP := $(addprefix $(OUT)/obj_dsp/,$(HOST_SRC:.c=.o))
+
+$(OUT)/obj/%.o: %.c | $(OUT)/obj
+	$(CC) $(CFLAGS) $(HOST_WARN) $(HOST_INC) -MMD -MP -c $< -o $@
+
+$(OUT)/obj_dsp/%.o: %.c | $(OUT)/obj_dsp
+	$(CC) $(CFLAGS) $(HOST_WARN) -DHOST_DSP $(HOST_INC) -MMD -MP -c $< -o $@
+
+$(OUT)/libwave.a: $(HOST_OBJ)
+	$(AR) rcs $@ $^
+
+$(OUT)/libwave_dsp.a: $(HOST_OBJ_DSP)
+	$(AR) rcs $@ $^
+
+$(OUT)/obj $(OUT)/obj_dsp:
+	mkdir -p $@
+
+-include $(HOST_OBJ:.o=.d) $(HOST_OBJ_DSP:.o=.d)
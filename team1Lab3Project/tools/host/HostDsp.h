@@ -0,0 +1,60 @@
+/**********************************************************************************
+* HostDsp.h - C versions of the Cortex-M4 DSP intrinsics used by WaveDac.c and
+* WaveInterp.c, so their packed paths can be checked against the portable ones
+* on a PC. Each follows the ARMv7-M instruction description, including the
+* saturation. They are for testing, not speed.
+**********************************************************************************/
+#ifndef HOST_DSP_H_
+#define HOST_DSP_H_
+
+static inline INT32S hostDspSat(INT32S val, INT32S min, INT32S max){
+    return (val > max) ? max : ((val < min) ? min : val);
+}
+static inline INT32S hostDspLo(INT32U x){
+    return (INT16S)(x & 0xFFFFu);
+}
+static inline INT32S hostDspHi(INT32U x){
+    return (INT16S)(x >> 16);
+}
+static inline INT32U hostDspPack(INT32S lo, INT32S hi){
+    return ((INT32U)lo & 0xFFFFu) | (((INT32U)hi & 0xFFFFu) << 16);
+}
+
+static inline INT32U __SMLAD(INT32U x, INT32U y, INT32U acc){
+    return (INT32U)(hostDspLo(x) * hostDspLo(y)) + (INT32U)(hostDspHi(x) * hostDspHi(y)) + acc;
+}
+static inline INT32U __SMLADX(INT32U x, INT32U y, INT32U acc){
+    return (INT32U)(hostDspLo(x) * hostDspHi(y)) + (INT32U)(hostDspHi(x) * hostDspLo(y)) + acc;
+}
+static inline INT32U __SMUAD(INT32U x, INT32U y){
+    return __SMLAD(x, y, 0u);
+}
+static inline INT32U __SMUADX(INT32U x, INT32U y){
+    return __SMLADX(x, y, 0u);
+}
+static inline INT32U __QADD16(INT32U x, INT32U y){
+    return hostDspPack(hostDspSat(hostDspLo(x) + hostDspLo(y), -32768, 32767),
+                       hostDspSat(hostDspHi(x) + hostDspHi(y), -32768, 32767));
+}
+static inline INT32U __QSUB16(INT32U x, INT32U y){
+    return hostDspPack(hostDspSat(hostDspLo(x) - hostDspLo(y), -32768, 32767),
+                       hostDspSat(hostDspHi(x) - hostDspHi(y), -32768, 32767));
+}
+static inline INT32S __SSAT(INT32S val, INT32U bits){
+    return hostDspSat(val, -(1 << (bits - 1u)), (1 << (bits - 1u)) - 1);
+}
+static inline INT32U __USAT(INT32S val, INT32U bits){
+    return (INT32U)hostDspSat(val, 0, (1 << bits) - 1);
+}
+static inline INT32U __USAT16(INT32U x, INT32U bits){
+    return hostDspPack(hostDspSat(hostDspLo(x), 0, (1 << bits) - 1),
+                       hostDspSat(hostDspHi(x), 0, (1 << bits) - 1));
+}
+static inline INT32U __PKHBT(INT32U lo, INT32U hi, INT32U shift){
+    return (lo & 0xFFFFu) | ((hi << shift) & 0xFFFF0000u);
+}
+static inline INT32U __PKHTB(INT32U hi, INT32U lo, INT32U shift){
+    return (hi & 0xFFFF0000u) | ((lo >> shift) & 0xFFFFu);
+}
+
+#endif /* HOST_DSP_H_ */
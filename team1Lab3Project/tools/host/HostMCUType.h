@@ -0,0 +1,40 @@
+/**********************************************************************************
+* HostMCUType.h - Standard types for building the OS-free modules on a PC.
+*
+* Forced ahead of every file with -include by tools/host/Host.mk. It claims the
+* MCU_TYPE_PRESENT guard, so source/MCUType.h and the K65 and uC/OS headers it
+* pulls in are skipped. The types keep the K65 widths on a 64-bit host, where
+* long is 64 bits.
+* With HOST_DSP defined the DSP intrinsic paths are built too, on HostDsp.h.
+**********************************************************************************/
+#ifndef  MCU_TYPE_PRESENT
+#define  MCU_TYPE_PRESENT
+
+#include <stdint.h>
+
+/**********************************************************************************
+* Standard WWU type definitions
+**********************************************************************************/
+typedef char                INT8C;
+typedef uint8_t             INT8U;
+typedef int8_t              INT8S;
+typedef uint16_t            INT16U;
+typedef int16_t             INT16S;
+typedef uint32_t            INT32U;
+typedef int32_t             INT32S;
+typedef uint64_t            INT64U;
+typedef int64_t             INT64S;
+typedef float               FP32;
+typedef double              FP64;
+
+#ifdef HOST_DSP
+#define __ARM_FEATURE_DSP   1
+#include "HostDsp.h"
+#endif
+/**********************************************************************************
+* General Defined Constants
+**********************************************************************************/
+#define FALSE    0
+#define TRUE     1
+
+#endif
@@ -0,0 +1,49 @@
+/**********************************************************************************
+* HostSinQ31.h - The per-sample sine path WaveDDS.c replaced, for comparing the
+* two on a PC: the CMSIS arm_sin_q31(), a 512 entry Q31 table with linear
+* interpolation, and the old sinewaveProcTask() scaling of its result to a DAC
+* word. Used by tools/test/TestWaveDDS.c for accuracy and tools/bench for speed.
+**********************************************************************************/
+#ifndef HOST_SIN_Q31_H_
+#define HOST_SIN_Q31_H_
+
+#include <math.h>
+
+#define HOST_SIN_Q31_STEP   44739u      /* old Q31 phase step per Hz at 48 kS/s */
+
+static INT32S HostSinTableQ31[513];
+
+/* Fills the table as CMSIS does, sin(2*pi*i/512) in Q31 with +1 saturated */
+static inline void HostSinQ31Init(void){
+    FP64 ideal;
+    INT32U i;
+
+    for(i = 0; i <= 512u; i++){
+        ideal = sin(2.0 * 3.14159265358979323846 * i / 512.0) * 2147483648.0;
+        HostSinTableQ31[i] = (ideal > 2147483647.0) ? 2147483647 : (INT32S)llround(ideal);
+    }
+}
+
+/* arm_sin_q31() for x in 0 to 0x7FFFFFFF, a full turn */
+static inline INT32S HostSinQ31(INT32S x){
+    INT32U index;
+    INT32U fract;
+    INT32S a;
+    INT32S b;
+    INT32S val;
+
+    index = (INT32U)x >> 22;
+    fract = ((INT32U)x - (index << 22)) << 9;
+    a = HostSinTableQ31[index];
+    b = HostSinTableQ31[index + 1];
+    val = (INT32S)(((INT64S)(0x80000000u - fract) * a) >> 32);
+    val = (INT32S)((((INT64S)val << 32) + ((INT64S)fract * b)) >> 32);
+    return val << 1;
+}
+
+/* The old DAC word at arg and amplitude amp, /22 against overflow, then >> 20 */
+static inline INT32S HostSinQ31Dac(INT32S amp, INT32S arg){
+    return ((amp * (HostSinQ31(arg) / 22)) >> 20) + 0x7FF;
+}
+
+#endif /* HOST_SIN_Q31_H_ */
@@ -0,0 +1,31 @@
+/****************************************************************************
+ * HostTest.h
+ * Checks for the host tests in tools/test. Each test is one program that
+ * prints what it measured, checks it with HOST_CHECK() and returns
+ * HostTestEnd() from main(), nonzero if a check failed.
+ ****************************************************************************/
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+
+#define HOST_CHECK(cond)    hostTestCheck((cond) ? TRUE : FALSE, #cond, __FILE__, __LINE__)
+
+static INT32U HostTestChecks;
+static INT32U HostTestFails;
+
+static inline void hostTestCheck(INT8U ok, const char *cond, const char *file, INT32U line){
+    HostTestChecks++;
+    if(ok == FALSE){
+        HostTestFails++;
+        printf("FAIL %s:%u: %s\n", file, line, cond);
+    }else{
+    }
+}
+
+static inline int HostTestEnd(const char *name){
+    printf("%s: %u checks, %u failed\n", name, HostTestChecks, HostTestFails);
+    return (HostTestFails > 0) ? 1 : 0;
+}
+
+#endif /* HOST_TEST_H_ */
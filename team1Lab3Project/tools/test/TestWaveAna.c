@@ -0,0 +1,148 @@
+/****************************************************************************
+ * TestWaveAna.c
+ * Host test of the real FFT in WaveFft.c and the analyzer in WaveAna.c.
+ *  - WaveFftReal() matches a direct DFT for every size up to
+ *    WAVE_FFT_MAX_SIZE, in the arm_rfft_fast_f32 layout
+ *  - a 12-bit 1 kHz tone at a real PIT rate reads a THD and SFDR near the
+ *    DAC's quantization
+ *  - injected harmonics and a non-harmonic spur read at their levels
+ *  - the measured frequency stays within TEST_MAX_PPM of a tone anywhere
+ *    between bins
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveFft.h"
+#include "WaveAna.h"
+#include "HostTest.h"
+
+#define TEST_MAX_FFT_ERR    3.0e-5      /* against the DFT, inputs within 1  */
+#define TEST_RATE           (60.0e6 / 1251.0)   /* PIT rate near 48 kS/s     */
+#define TEST_FREQ           1000.0
+#define TEST_AMP            1860.0      /* codes                             */
+#define TEST_MAX_THD        -80.0       /* dB, clean 12-bit tone             */
+#define TEST_MIN_SFDR       85.0
+#define TEST_H2             1.0e-3      /* -60 dB                            */
+#define TEST_H3             3.0e-4      /* -70.5 dB                          */
+#define TEST_SPUR           1.0e-4      /* -80 dB                            */
+#define TEST_SPUR_FREQ      7777.0
+#define TEST_MAX_DB_ERR     1.0
+#define TEST_MAX_PPM        1.0
+#define TEST_PI             3.14159265358979323846
+
+static FP64 testFftErr(INT32U n);
+static void testTone(INT16U *codes, FP64 freq, FP64 amp, FP64 h2, FP64 h3, FP64 spur);
+
+int main(void){
+    static INT16U codes[WAVE_ANA_SIZE];
+    WAVE_ANA_RESULT r;
+    INT32U n;
+    FP64 err;
+    FP64 max_err = 0.0;
+    FP64 f;
+    FP64 thd;
+    FP64 max_ppm = 0.0;
+
+    srand(18);
+    for(n = 16; n <= WAVE_FFT_MAX_SIZE; n *= 2u){
+        err = testFftErr(n);
+        max_err = (err > max_err) ? err : max_err;
+    }
+    printf("FFT against the DFT, 16 to %u points: max error %.2e\n", WAVE_FFT_MAX_SIZE, max_err);
+    HOST_CHECK(max_err <= TEST_MAX_FFT_ERR);
+
+    testTone(&codes[0], TEST_FREQ, TEST_AMP, 0.0, 0.0, 0.0);
+    WaveAnaRun(&codes[0], (FP32)TEST_RATE, (FP32)TEST_FREQ, &r);
+    printf("clean: %.4f Hz, %.2f ppm, level %.2f dB, THD %.1f dB, SFDR %.1f dB\n", r.freq, r.freq_err_ppm,
+           r.level_db, r.thd_db, r.sfdr_db);
+    HOST_CHECK(r.thd_db <= TEST_MAX_THD);
+    HOST_CHECK(r.sfdr_db >= TEST_MIN_SFDR);
+    HOST_CHECK(fabs(r.level_db - (20.0 * log10(TEST_AMP / 2048.0))) <= TEST_MAX_DB_ERR);
+
+    testTone(&codes[0], TEST_FREQ, TEST_AMP, TEST_H2, TEST_H3, 0.0);
+    WaveAnaRun(&codes[0], (FP32)TEST_RATE, (FP32)TEST_FREQ, &r);
+    thd = 10.0 * log10((TEST_H2 * TEST_H2) + (TEST_H3 * TEST_H3));
+    printf("harmonics: THD %.1f dB (%.1f), SFDR %.1f dB (%.1f)\n", r.thd_db, thd, r.sfdr_db,
+           -20.0 * log10(TEST_H2));
+    HOST_CHECK(fabs(r.thd_db - thd) <= TEST_MAX_DB_ERR);
+    HOST_CHECK(fabs(r.sfdr_db + (20.0 * log10(TEST_H2))) <= TEST_MAX_DB_ERR);
+
+    testTone(&codes[0], TEST_FREQ, TEST_AMP, 0.0, 0.0, TEST_SPUR);
+    WaveAnaRun(&codes[0], (FP32)TEST_RATE, (FP32)TEST_FREQ, &r);
+    printf("spur: THD %.1f dB, SFDR %.1f dB (%.1f)\n", r.thd_db, r.sfdr_db, -20.0 * log10(TEST_SPUR));
+    HOST_CHECK(r.thd_db <= TEST_MAX_THD);
+    HOST_CHECK(fabs(r.sfdr_db + (20.0 * log10(TEST_SPUR))) <= TEST_MAX_DB_ERR);
+
+    for(f = TEST_FREQ - 10.0; f < (TEST_FREQ + 10.0); f += 0.37){
+        testTone(&codes[0], f, 2000.0, 0.0, 0.0, 0.0);
+        WaveAnaRun(&codes[0], (FP32)TEST_RATE, (FP32)f, &r);
+        max_ppm = (fabs(r.freq_err_ppm) > max_ppm) ? fabs(r.freq_err_ppm) : max_ppm;
+    }
+    printf("frequency across bin offsets: worst %.2f ppm\n", max_ppm);
+    HOST_CHECK(max_ppm <= TEST_MAX_PPM);
+
+    return HostTestEnd("TestWaveAna");
+}
+
+/****************************************************************************
+ * testFftErr() - Private
+ * Largest distance between the n point WaveFftReal() of random data and a
+ * direct DFT, over bins 0 to n/2. Bin 0 and n/2 are packed in entries 0
+ * and 1.
+ ****************************************************************************/
+static FP64 testFftErr(INT32U n){
+    static FP32 buf[WAVE_FFT_MAX_SIZE];
+    static FP64 x[WAVE_FFT_MAX_SIZE];
+    FP64 re;
+    FP64 im;
+    FP64 gre;
+    FP64 gim;
+    FP64 d;
+    FP64 max_d = 0.0;
+    INT32U i;
+    INT32U k;
+
+    for(i = 0; i < n; i++){
+        x[i] = ((rand() % 2001) - 1000) / 1000.0;
+        buf[i] = (FP32)x[i];
+    }
+    WaveFftReal(&buf[0], n);
+    for(k = 0; k <= (n / 2u); k++){
+        re = 0.0;
+        im = 0.0;
+        for(i = 0; i < n; i++){
+            re += x[i] * cos(2.0 * TEST_PI * ((k * i) % n) / n);
+            im -= x[i] * sin(2.0 * TEST_PI * ((k * i) % n) / n);
+        }
+        if(k == 0){
+            gre = buf[0];
+            gim = 0.0;
+        }else if(k == (n / 2u)){
+            gre = buf[1];
+            gim = 0.0;
+        }else{
+            gre = buf[2u * k];
+            gim = buf[(2u * k) + 1u];
+        }
+        d = hypot(gre - re, gim - im);
+        max_d = (d > max_d) ? d : max_d;
+    }
+    return max_d;
+}
+
+/****************************************************************************
+ * testTone() - Private
+ * WAVE_ANA_SIZE rounded DAC codes of a tone at freq with amp codes peak,
+ * second and third harmonics h2 and h3 and a spur at TEST_SPUR_FREQ, all
+ * relative to amp.
+ ****************************************************************************/
+static void testTone(INT16U *codes, FP64 freq, FP64 amp, FP64 h2, FP64 h3, FP64 spur){
+    FP64 ph;
+    INT32U i;
+
+    for(i = 0; i < WAVE_ANA_SIZE; i++){
+        ph = 2.0 * TEST_PI * freq * i / TEST_RATE;
+        codes[i] = (INT16U)lround(2048.0 + (amp * (sin(ph) + (h2 * sin(2.0 * ph)) + (h3 * sin(3.0 * ph)) +
+                                                  (spur * sin(2.0 * TEST_PI * TEST_SPUR_FREQ * i / TEST_RATE)))));
+    }
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * TestWaveDDS.c
+ * Host test of the table DDS in WaveDDS.c against sin() and against the
+ * per-sample arm_sin_q31() path it replaced.
+ *  - Q15 samples within TEST_MAX_Q15_ERR of the rounded sine
+ *  - split blocks continue the phase exactly
+ *  - DDSPhaseStep() is the rounded step
+ *  - at amplitude 20 the DAC words of the old and new paths are within
+ *    TEST_MAX_DAC_DIFF LSB, and the new SNR is at least TEST_MIN_SNR dB
+ *    and at least TEST_MIN_SNR_GAIN dB better than the old
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveDac.h"
+#include "HostTest.h"
+#include "HostSinQ31.h"
+
+#define TEST_MAX_Q15_ERR    1.0         /* LSB Q15, interpolation error      */
+#define TEST_MAX_DAC_DIFF   3           /* LSB of the 12-bit DAC             */
+#define TEST_MIN_SNR        73.0        /* dB at amplitude 20                */
+#define TEST_MIN_SNR_GAIN   5.0         /* dB over the old path              */
+#define TEST_AMP            20          /* Sinewave.c amplitude units        */
+#define TEST_AMP_SCALE      186         /* WAVE_RENDER_AMP_SCALE             */
+#define TEST_RATE           48000u
+#define TEST_SAMPLES        4800u       /* per frequency                     */
+#define TEST_PI             3.14159265358979323846
+
+int main(void){
+    static INT16S blk[TEST_SAMPLES];
+    static INT16S part[TEST_SAMPLES];
+    INT32U phase;
+    INT32U ph;
+    INT32U step;
+    INT32U arg;
+    INT32U freq;
+    INT32U i;
+    INT16S y;
+    INT16U dac;
+    INT32S old_dac;
+    INT32S diff;
+    INT32S max_diff = 0;
+    FP64 err;
+    FP64 max_err = 0.0;
+    FP64 ideal;
+    FP64 sig = 0.0;
+    FP64 noise_old = 0.0;
+    FP64 noise_new = 0.0;
+    FP64 snr_old;
+    FP64 snr_new;
+
+    /* Sample accuracy over every 2^12th phase */
+    for(phase = 0; phase < 0xFFFFF000u; phase += 0x1000u){
+        err = fabs(DDSSineSample(phase) - round(32767.0 * sin(2.0 * TEST_PI * phase / 4294967296.0)));
+        if(err > max_err){
+            max_err = err;
+        }else{
+        }
+    }
+    printf("DDSSineSample max error %.1f LSB Q15\n", max_err);
+    HOST_CHECK(max_err <= TEST_MAX_Q15_ERR);
+
+    /* Phase continuity over uneven blocks */
+    phase = 0x12345678u;
+    step = DDSPhaseStep(997, TEST_RATE);
+    DDSSineBlock(&phase, step, &blk[0], TEST_SAMPLES);
+    ph = 0x12345678u;
+    for(i = 0; i < TEST_SAMPLES; i += (i % 7u) + 1u){
+        DDSSineBlock(&ph, step, &part[i], (((i % 7u) + 1u) < (TEST_SAMPLES - i)) ? ((i % 7u) + 1u) : (TEST_SAMPLES - i));
+    }
+    HOST_CHECK(ph == phase);
+    for(i = 0; (i < TEST_SAMPLES) && (part[i] == blk[i]); i++){
+    }
+    HOST_CHECK(i == TEST_SAMPLES);
+
+    /* Rounded phase step */
+    for(freq = 1; freq <= 20000; freq += 37){
+        HOST_CHECK(DDSPhaseStep(freq, TEST_RATE) == (INT32U)floor((freq * 4294967296.0 / TEST_RATE) + 0.5));
+    }
+
+    /* Old arm_sin_q31() path against the table path at the DAC */
+    HostSinQ31Init();
+    for(freq = 10; freq <= 10000; freq += 13){
+        arg = 0;
+        step = freq * HOST_SIN_Q31_STEP;
+        for(i = 0; i < TEST_SAMPLES; i++){
+            arg = (arg + step) & 0x7FFFFFFFu;
+            old_dac = HostSinQ31Dac(TEST_AMP, (INT32S)arg);
+            ph = arg << 1;
+            DDSSineBlock(&ph, 0, &y, 1);
+            WaveDacFormatRef(&y, &dac, 1, TEST_AMP * TEST_AMP_SCALE);
+            ideal = sin(2.0 * TEST_PI * arg / 2147483648.0);
+            err = old_dac - ((ideal * TEST_AMP * 2147483648.0 / 22.0 / 1048576.0) + WAVE_DAC_OFFSET);
+            noise_old += err * err;
+            sig += (ideal * TEST_AMP * 2147483648.0 / 22.0 / 1048576.0) * (ideal * TEST_AMP * 2147483648.0 / 22.0 / 1048576.0);
+            err = dac - ((ideal * TEST_AMP * TEST_AMP_SCALE * 32767.0 / 65536.0) + WAVE_DAC_OFFSET);
+            noise_new += err * err;
+            diff = abs(old_dac - (INT32S)dac);
+            if(diff > max_diff){
+                max_diff = diff;
+            }else{
+            }
+        }
+    }
+    snr_old = 10.0 * log10(sig / noise_old);
+    snr_new = 10.0 * log10(sig / noise_new);
+    printf("DAC SNR old %.1f dB, new %.1f dB, max difference %d LSB\n", snr_old, snr_new, max_diff);
+    HOST_CHECK(snr_new >= TEST_MIN_SNR);
+    HOST_CHECK(snr_new >= (snr_old + TEST_MIN_SNR_GAIN));
+    HOST_CHECK(max_diff <= TEST_MAX_DAC_DIFF);
+
+    return HostTestEnd("TestWaveDDS");
+}
@@ -0,0 +1,91 @@
+/****************************************************************************
+ * TestWaveDac.c
+ * Host test of the DAC word formatting in WaveDac.c. Built twice by the
+ * Makefile: TestWaveDac checks the portable path and TestWaveDac_dsp the
+ * packed path on the emulated DSP intrinsics of tools/host/HostDsp.h.
+ *  - WaveDacFormat() matches WaveDacFormatRef() bit for bit
+ *  - WaveDacFormatPair() matches WaveDacFormatPairRef() bit for bit, and
+ *    each of its channels matches WaveDacFormatRef() on that channel
+ *  - full scale samples and gains clamp to 0 and WAVE_DAC_MAX
+ * Blocks have random lengths, odd ones included, random samples and
+ * random gains of either sign.
+ ****************************************************************************/
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveDac.h"
+#include "HostTest.h"
+
+#define TEST_MAX_LEN        513u
+#define TEST_RUNS           4000u
+
+static INT16S testRandS16(void);
+static INT32U testMismatches(const INT16U *a, const INT16U *b, INT32U num);
+
+int main(void){
+    static INT16S src0[TEST_MAX_LEN];
+    static INT16S src1[TEST_MAX_LEN];
+    static INT16U ref[2 * TEST_MAX_LEN];
+    static INT16U out[2 * TEST_MAX_LEN];
+    static INT16U one[TEST_MAX_LEN];
+    static const INT16S edge_samples[4] = {-32768, -32767, 32767, 0};
+    static const INT16S edge_gains[4] = {-32768, -1, 1, 32767};
+    INT32U run;
+    INT32U num;
+    INT32U i;
+    INT32U single_bad = 0;
+    INT32U pair_bad = 0;
+    INT32U chan_bad = 0;
+    INT16S gain0;
+    INT16S gain1;
+    INT16U lo = 0xFFFFu;
+    INT16U hi = 0;
+
+    srand(7);
+    for(run = 0; run < TEST_RUNS; run++){
+        num = 1u + ((INT32U)rand() % TEST_MAX_LEN);
+        gain0 = (INT16S)((rand() % 8000) - 1000);
+        gain1 = (run < 64u) ? edge_gains[run % 4u] : (INT16S)((rand() % 8000) - 1000);
+        for(i = 0; i < num; i++){
+            src0[i] = testRandS16();
+            src1[i] = (run < 64u) ? edge_samples[i % 4u] : testRandS16();
+        }
+        WaveDacFormat(&src0[0], &out[0], num, gain0);
+        WaveDacFormatRef(&src0[0], &ref[0], num, gain0);
+        single_bad += testMismatches(&out[0], &ref[0], num);
+        WaveDacFormatPair(&src0[0], &src1[0], &out[0], num, gain0, gain1);
+        WaveDacFormatPairRef(&src0[0], &src1[0], &ref[0], num, gain0, gain1);
+        pair_bad += testMismatches(&out[0], &ref[0], 2u * num);
+        WaveDacFormatRef(&src1[0], &one[0], num, gain1);
+        for(i = 0; i < num; i++){
+            chan_bad += (one[i] != out[(2u * i) + 1u]) ? 1u : 0u;
+            lo = (out[(2u * i) + 1u] < lo) ? out[(2u * i) + 1u] : lo;
+            hi = (out[(2u * i) + 1u] > hi) ? out[(2u * i) + 1u] : hi;
+        }
+    }
+    printf("%u blocks: format %u, pair %u, pair channel %u mismatches, words %u..%u\n", TEST_RUNS,
+           single_bad, pair_bad, chan_bad, lo, hi);
+    HOST_CHECK(single_bad == 0);
+    HOST_CHECK(pair_bad == 0);
+    HOST_CHECK(chan_bad == 0);
+    HOST_CHECK((lo == 0) && (hi == WAVE_DAC_MAX));
+
+#ifdef HOST_DSP
+    return HostTestEnd("TestWaveDac_dsp");
+#else
+    return HostTestEnd("TestWaveDac");
+#endif
+}
+
+static INT16S testRandS16(void){
+    return (INT16S)(((INT32U)rand() & 0xFFFFu) - 0x8000u);
+}
+
+static INT32U testMismatches(const INT16U *a, const INT16U *b, INT32U num){
+    INT32U bad = 0;
+    INT32U i;
+
+    for(i = 0; i < num; i++){
+        bad += (a[i] != b[i]) ? 1u : 0u;
+    }
+    return bad;
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+ * TestWaveDacBuf.c
+ * Host test of the DAC buffer geometry in WaveDacBuf.c. A model of the
+ * DAC buffer in normal mode, its watermark and top flags, the DMA bursts
+ * with DMOD wrapping the destination and the TCDs that Sinewave.c loads
+ * plays each geometry for three passes of its ring or loop. It checks:
+ *  - every geometry on the buffer plays every sample in order,
+ *    WAVE_DACBUF_BURST triggers late, after the first frame held from
+ *    sineTrigStart()
+ *  - a cached loop ends each pass with the destination back on the word
+ *    it started on
+ *  - the PDB MOD is a whole number of intervals the counter can hold
+ *  - blocks of part bursts, rings of part buffers, intervals past
+ *    WAVE_DACBUF_MAX_INT and fifo FALSE fall back to a PIT frame per
+ *    request
+ * Rings are blocks of 4 to TEST_MAX_BLOCK frames in 2 to TEST_MAX_RING
+ * blocks, loops are 16 to TEST_MAX_LOOP frames.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveDacBuf.h"
+#include "HostTest.h"
+
+#define TEST_MAX_BLOCK      512u
+#define TEST_MAX_RING       6u
+#define TEST_MAX_LOOP       2048u
+#define TEST_PASSES         3u
+#define TEST_RING_LDVAL     299u        /* 200 kS/s                          */
+#define TEST_LOOP_LDVAL     999u        /* 60 kS/s                           */
+
+static INT32U testPlay(const WAVE_DAC_BUF *buf, INT32U block, INT32U num_blocks, INT8U loop);
+
+static INT16U TestSrc[TEST_MAX_RING * TEST_MAX_BLOCK];
+
+int main(void){
+    WAVE_DAC_BUF buf;
+    INT32U block;
+    INT32U num;
+    INT32U len;
+    INT32U ldval;
+    INT32U i;
+    INT32U used = 0;
+    INT32U fallback = 0;
+    INT32U bad = 0;
+
+    for(i = 0; i < (TEST_MAX_RING * TEST_MAX_BLOCK); i++){
+        TestSrc[i] = (INT16U)(1000u + i);
+    }
+
+    for(block = 4; block <= TEST_MAX_BLOCK; block += 4u){
+        for(num = 2; num <= TEST_MAX_RING; num++){
+            if(WaveDacBufPlan(TEST_RING_LDVAL, block, num, TRUE, &buf) == FALSE){
+                HOST_CHECK(((block * num) % WAVE_DACBUF_WORDS) != 0);
+                HOST_CHECK((buf.burst == 1u) && (buf.requests == block));
+                fallback++;
+                continue;
+            }else{
+            }
+            HOST_CHECK(buf.requests == (block / WAVE_DACBUF_BURST));
+            bad += (testPlay(&buf, block, num, FALSE) != 0) ? 1u : 0u;
+            used++;
+        }
+    }
+    for(len = 16; len <= TEST_MAX_LOOP; len++){
+        if(WaveDacBufPlan(TEST_LOOP_LDVAL, len, 1, TRUE, &buf) == FALSE){
+            HOST_CHECK((len % WAVE_DACBUF_WORDS) != 0);
+            fallback++;
+            continue;
+        }else{
+        }
+        bad += (testPlay(&buf, len, 1, TRUE) != 0) ? 1u : 0u;
+        used++;
+    }
+    printf("%u geometries on the DAC buffer, %u playing out of order, %u fell back to the PIT\n", used, bad,
+           fallback);
+    HOST_CHECK(bad == 0);
+
+    /* PDB MOD and the interval limit */
+    for(ldval = 99; ldval < WAVE_DACBUF_MAX_INT; ldval += 97u){
+        HOST_CHECK(WaveDacBufPlan(ldval, 256, 4, TRUE, &buf) == TRUE);
+        HOST_CHECK((buf.pdb_mod < WAVE_DACBUF_MAX_INT) && (((buf.pdb_mod + 1u) % (ldval + 1u)) == 0));
+        HOST_CHECK((WAVE_DACBUF_MAX_INT - (buf.pdb_mod + 1u)) < (ldval + 1u));
+    }
+    HOST_CHECK(WaveDacBufPlan(WAVE_DACBUF_MAX_INT - 1u, 256, 4, TRUE, &buf) == TRUE);
+    HOST_CHECK(WaveDacBufPlan(WAVE_DACBUF_MAX_INT, 256, 4, TRUE, &buf) == FALSE);
+    HOST_CHECK(WaveDacBufPlan(TEST_RING_LDVAL, 258, 4, TRUE, &buf) == FALSE);
+    HOST_CHECK(WaveDacBufPlan(TEST_RING_LDVAL, 0, 4, TRUE, &buf) == FALSE);
+    HOST_CHECK(WaveDacBufPlan(TEST_RING_LDVAL, 256, 4, FALSE, &buf) == FALSE);
+    HOST_CHECK((buf.ldval == TEST_RING_LDVAL) && (WaveDacBufWord(&buf, 5) == 0));
+
+    return HostTestEnd("TestWaveDacBuf");
+}
+
+/****************************************************************************
+ * testPlay() - Private
+ * Plays TEST_PASSES passes of num_blocks blocks of block frames, or of a
+ * loop of block frames, through the model of one DAC and returns the
+ * triggers that converted the wrong sample. A ring reloads the next TCD
+ * by scatter-gather at the end of each block. A loop keeps its one TCD,
+ * SLAST rewinds the source and DADDR runs on.
+ ****************************************************************************/
+static INT32U testPlay(const WAVE_DAC_BUF *buf, INT32U block, INT32U num_blocks, INT8U loop){
+    INT16U dat[WAVE_DACBUF_WORDS];
+    INT32U total = block * num_blocks;
+    INT32U words = (1u << buf->dmod) / 2u;
+    INT32U ptr = buf->start;
+    INT32U blk = 0;
+    INT32U src = 0;
+    INT32U dword;
+    INT32U citer = buf->requests;
+    INT32U bad = 0;
+    INT32U t;
+    INT32U k;
+    INT16U want;
+
+    for(k = 0; k < WAVE_DACBUF_WORDS; k++){
+        dat[k] = TestSrc[0];
+    }
+    dword = WaveDacBufWord(buf, 0);
+    for(t = 0; t < ((TEST_PASSES * total) + buf->burst); t++){
+        ptr = (ptr == buf->upper) ? 0 : (ptr + 1u);
+        if((ptr == (INT32U)(buf->upper - buf->watermark - 1u)) || (ptr == 0)){
+            for(k = 0; k < buf->burst; k++){
+                dat[dword] = TestSrc[src];
+                src++;
+                dword = (dword + 1u) % words;
+            }
+            citer--;
+            if(citer == 0){
+                citer = buf->requests;
+                blk = (blk + 1u) % num_blocks;
+                if(loop == TRUE){
+                    src = 0;
+                    bad += (dword != WaveDacBufWord(buf, 0)) ? 1u : 0u;
+                }else{
+                    src = blk * block;
+                    dword = WaveDacBufWord(buf, blk * block);
+                }
+            }else{
+            }
+        }else{
+        }
+        want = (t < buf->burst) ? TestSrc[0] : TestSrc[(t - buf->burst) % total];
+        bad += (dat[ptr] != want) ? 1u : 0u;
+    }
+    return bad;
+}
@@ -0,0 +1,214 @@
+/****************************************************************************
+ * TestWaveFx.c
+ * Host test of the effects chain in WaveFx.c at TEST_RATE, run in
+ * TEST_BLOCK sample blocks so the filter state carries across calls.
+ *  - the Butterworth biquads give the responses in TestResp, the gain of a
+ *    sine measured over whole periods after a second of settling
+ *  - for every cutoff in range at each rate in TestRates the low-pass
+ *    coefficients sum to a DC gain of exactly 1 and the high-pass ones to
+ *    exactly 0, and up to 100 Hz a settled DC input comes out within
+ *    TEST_MAX_DC LSB of TEST_DC and 0
+ *  - DC offset and Q16 gain saturate at both ends of the Q15 range, clip
+ *    holds its limit inside 0..32767 and the chain drops unknown types
+ *    and stages past WAVE_FX_MAX_STAGES
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveFx.h"
+#include "HostTest.h"
+
+#define TEST_RATE           96000u
+#define TEST_BLOCK          240u
+#define TEST_LEN            (2u * TEST_RATE)    /* settle 1 s, measure 1 s   */
+#define TEST_AMP            30000.0
+#define TEST_DC             20000
+#define TEST_MAX_DC         1
+#define TEST_PI             3.14159265358979323846
+
+typedef struct {
+    INT8U  type;
+    INT32S cutoff;          /* Hz */
+    INT32U freq;            /* Hz, a whole number of periods in TEST_RATE */
+    FP64   db;              /* expected gain */
+    FP64   tol;
+} TEST_RESP;
+
+static FP64 testGainDb(INT8U type, INT32S cutoff, INT32U freq);
+static INT32U testDcBad(INT8U type, INT32S cutoff, INT32U rate);
+static void testSat(void);
+static INT8U testStages(WAVE_FX_CHAIN *chain, const WAVE_FX_SET *set, INT8U num_stages, const INT16S *in,
+                        const INT16S *want);
+
+static const TEST_RESP TestResp[] = {
+    {WAVE_FX_LOWPASS,  1000, 1000,  -3.01, 0.05}, {WAVE_FX_LOWPASS,  1000, 10000, -40.6, 0.3},
+    {WAVE_FX_LOWPASS,  1000, 100,    0.0,  0.05}, {WAVE_FX_HIGHPASS, 1000, 100,   -40.0, 0.3},
+    {WAVE_FX_HIGHPASS, 1000, 1000,  -3.01, 0.05}, {WAVE_FX_HIGHPASS, 1000, 20000,  0.0,  0.05},
+    {WAVE_FX_LOWPASS,  20,   20,    -3.01, 0.05}, {WAVE_FX_LOWPASS,  20,   2,      0.0,  0.05},
+    {WAVE_FX_HIGHPASS, 20,   20,    -3.01, 0.05}
+};
+static const INT32U TestRates[] = {8000, 48000, 96000, 200000};
+static INT16S TestBlk[TEST_LEN];
+
+int main(void){
+    FP64 db;
+    INT32U i;
+    INT32U rate;
+    INT32U cutoff;
+    INT32U cases = 0;
+    INT32U bad = 0;
+
+    for(i = 0; i < (sizeof(TestResp) / sizeof(TestResp[0])); i++){
+        db = testGainDb(TestResp[i].type, TestResp[i].cutoff, TestResp[i].freq);
+        printf("%s %5d Hz at %5u Hz: %+7.2f dB, expected %+7.2f\n",
+               (TestResp[i].type == WAVE_FX_LOWPASS) ? "LP" : "HP", TestResp[i].cutoff, TestResp[i].freq, db,
+               TestResp[i].db);
+        HOST_CHECK(fabs(db - TestResp[i].db) <= TestResp[i].tol);
+    }
+
+    /* DC gain at every cutoff */
+    for(i = 0; i < (sizeof(TestRates) / sizeof(TestRates[0])); i++){
+        rate = TestRates[i];
+        for(cutoff = 1; cutoff < (rate / 2u); cutoff += (cutoff < 100u) ? 1u : 37u){
+            bad += testDcBad(WAVE_FX_LOWPASS, (INT32S)cutoff, rate);
+            bad += testDcBad(WAVE_FX_HIGHPASS, (INT32S)cutoff, rate);
+            cases += 2u;
+        }
+    }
+    printf("%u filters, %u off a DC gain of exactly 1 or 0\n", cases, bad);
+    HOST_CHECK(bad == 0);
+
+    testSat();
+
+    return HostTestEnd("TestWaveFx");
+}
+
+/****************************************************************************
+ * testGainDb() - Private
+ * Gain in dB of a one-stage chain of type at cutoff for a TEST_AMP sine at
+ * freq, from the in-phase and quadrature sums over the second half.
+ ****************************************************************************/
+static FP64 testGainDb(INT8U type, INT32S cutoff, INT32U freq){
+    WAVE_FX_CHAIN chain;
+    WAVE_FX_SET set;
+    INT32U n;
+    FP64 w;
+    FP64 re = 0.0;
+    FP64 im = 0.0;
+
+    set.type = type;
+    set.param = cutoff;
+    WaveFxChainInit(&chain, &set, 1, TEST_RATE);
+    for(n = 0; n < TEST_LEN; n++){
+        TestBlk[n] = (INT16S)lround(TEST_AMP * sin((2.0 * TEST_PI * freq * n) / TEST_RATE));
+    }
+    for(n = 0; n < TEST_LEN; n += TEST_BLOCK){
+        WaveFxChainRun(&chain, &TestBlk[n], TEST_BLOCK);
+    }
+    for(n = TEST_RATE; n < TEST_LEN; n++){
+        w = (2.0 * TEST_PI * freq * n) / TEST_RATE;
+        re += TestBlk[n] * sin(w);
+        im += TestBlk[n] * cos(w);
+    }
+    return 20.0 * log10((2.0 * sqrt((re * re) + (im * im)) / TEST_RATE) / TEST_AMP);
+}
+
+/****************************************************************************
+ * testDcBad() - Private
+ * 1 if the filter of type at cutoff and rate does not sum to a DC gain of
+ * exactly 1 (low-pass) or 0 (high-pass), in Q30 b0 + b1 + b2 against
+ * 1 + a1 + a2, or if TEST_DC held for 20 time constants comes out more
+ * than TEST_MAX_DC from TEST_DC or 0, else 0.
+ ****************************************************************************/
+static INT32U testDcBad(INT8U type, INT32S cutoff, INT32U rate){
+    WAVE_FX_CHAIN chain;
+    WAVE_FX_SET set;
+    INT32U settle = ((20u * rate) / (INT32U)cutoff) + TEST_BLOCK;
+    INT32U n;
+    INT32U i;
+    INT32U len = TEST_BLOCK;
+    INT64S bsum;
+    INT64S asum;
+    INT32S want = (type == WAVE_FX_LOWPASS) ? TEST_DC : 0;
+
+    set.type = type;
+    set.param = cutoff;
+    WaveFxChainInit(&chain, &set, 1, rate);
+    bsum = (INT64S)chain.stage[0].coef[0] + chain.stage[0].coef[1] + chain.stage[0].coef[2];
+    asum = (INT64S)0x40000000 + chain.stage[0].coef[3] + chain.stage[0].coef[4];
+    if(((type == WAVE_FX_LOWPASS) && (bsum != asum)) || ((type == WAVE_FX_HIGHPASS) && (bsum != 0))){
+        return 1;
+    }else{
+    }
+    if(cutoff > 100){                       /* the settled output, low cutoffs only */
+        return 0;
+    }else{
+    }
+    for(n = 0; n < settle; n += len){
+        len = ((settle - n) < TEST_BLOCK) ? (settle - n) : TEST_BLOCK;
+        for(i = 0; i < len; i++){
+            TestBlk[i] = TEST_DC;
+        }
+        WaveFxChainRun(&chain, &TestBlk[0], len);
+    }
+    return (abs(TestBlk[len - 1u] - want) > TEST_MAX_DC) ? 1u : 0u;
+}
+
+/****************************************************************************
+ * testSat() - Private
+ * DC, gain and clip at the ends of the Q15 range, and the chain building.
+ ****************************************************************************/
+static void testSat(void){
+    static const WAVE_FX_SET dc_up[1] = {{WAVE_FX_DC, 20000}};
+    static const WAVE_FX_SET dc_down[1] = {{WAVE_FX_DC, -20000}};
+    static const WAVE_FX_SET gain2[1] = {{WAVE_FX_GAIN, 131072}};
+    static const WAVE_FX_SET gain_half[1] = {{WAVE_FX_GAIN, 32768}};
+    static const WAVE_FX_SET gain_neg[1] = {{WAVE_FX_GAIN, -65536}};
+    static const WAVE_FX_SET clips[2] = {{WAVE_FX_CLIP, 40000}, {WAVE_FX_CLIP, -5}};
+    static const WAVE_FX_SET mixed[6] = {{WAVE_FX_COUNT, 0}, {WAVE_FX_GAIN, 131072}, {WAVE_FX_CLIP, 10000},
+                                         {WAVE_FX_DC, 100}, {WAVE_FX_GAIN, 65536}, {WAVE_FX_DC, 1}};
+    static const INT16S ends[4] = {20000, -20000, 32767, -32768};
+    static const INT16S small[4] = {20000, -20000, 100, -100};
+    static const INT16S mid[4] = {20000, -20000, 3000, -3000};
+    static const INT16S dc_up_out[4] = {32767, 0, 32767, -12768};
+    static const INT16S dc_down_out[4] = {0, -32768, 12767, -32768};
+    static const INT16S gain2_out[4] = {32767, -32768, 200, -200};
+    static const INT16S gain_half_out[4] = {10000, -10000, 16383, -16384};
+    static const INT16S gain_neg_out[4] = {-20000, 20000, -32767, 32767};
+    static const INT16S zero[4] = {0, 0, 0, 0};
+    static const INT16S mixed_out[4] = {10100, -9900, 6100, -5900};
+    WAVE_FX_CHAIN chain;
+
+    HOST_CHECK(testStages(&chain, &dc_up[0], 1, &ends[0], &dc_up_out[0]) == TRUE);
+    HOST_CHECK(testStages(&chain, &dc_down[0], 1, &ends[0], &dc_down_out[0]) == TRUE);
+    HOST_CHECK(testStages(&chain, &gain2[0], 1, &small[0], &gain2_out[0]) == TRUE);
+    HOST_CHECK(testStages(&chain, &gain_half[0], 1, &ends[0], &gain_half_out[0]) == TRUE);
+    HOST_CHECK(testStages(&chain, &gain_neg[0], 1, &ends[0], &gain_neg_out[0]) == TRUE);
+    HOST_CHECK(testStages(&chain, &clips[0], 2, &ends[0], &zero[0]) == TRUE);
+    HOST_CHECK((chain.num_stages == 2u) && (chain.stage[0].coef[0] == 32767) && (chain.stage[1].coef[0] == 0));
+    /* Unknown type dropped, the fifth valid stage past the limit dropped */
+    HOST_CHECK(testStages(&chain, &mixed[0], 6, &mid[0], &mixed_out[0]) == TRUE);
+    HOST_CHECK(chain.num_stages == WAVE_FX_MAX_STAGES);
+}
+
+/****************************************************************************
+ * testStages() - Private
+ * Builds chain from num_stages of set, runs it over the 4 samples of in
+ * and returns TRUE if they come out as want.
+ ****************************************************************************/
+static INT8U testStages(WAVE_FX_CHAIN *chain, const WAVE_FX_SET *set, INT8U num_stages, const INT16S *in,
+                        const INT16S *want){
+    INT16S blk[4];
+    INT8U i;
+    INT8U same = TRUE;
+
+    for(i = 0; i < 4u; i++){
+        blk[i] = in[i];
+    }
+    WaveFxChainInit(chain, set, num_stages, TEST_RATE);
+    WaveFxChainRun(chain, &blk[0], 4);
+    for(i = 0; i < 4u; i++){
+        same = (blk[i] != want[i]) ? FALSE : same;
+    }
+    return same;
+}
@@ -0,0 +1,223 @@
+/****************************************************************************
+ * TestWaveGen.c
+ * Host test of the generators in WaveGen.c against float references.
+ *  - sine against sin()
+ *  - triangle, sawtooth and square against their Fourier series cut at
+ *    the octave the generator picks, at one scale for every octave, taken
+ *    on the table grid and interpolated as the generator does. The error
+ *    against the continuous series is only printed: next to the saw and
+ *    square edges the 8 table points per period of the top harmonic leave
+ *    several hundred LSB of interpolation error
+ *  - user, built from a sine table by WaveMipBuildUser(), against sin()
+ *  - the phase runs on across uneven blocks
+ *  - user without a table, and out of range shapes, fall back to sine
+ *  - WaveGenUpsampleWins() takes only the tones shape with
+ *    WAVE_GEN_UP_TONES or more tones, up to the step that puts its top
+ *    harmonic on max_step
+ * Each shape is played at TEST_RATE for every frequency in TestFreqs.
+ ****************************************************************************/
+#include <math.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+#include "WaveTone.h"
+#include "WaveNoise.h"
+#include "HostTest.h"
+
+#define TEST_RATE           48000u
+#define TEST_BLOCK          512u
+#define TEST_BLOCKS         40u
+#define TEST_PI             3.14159265358979323846
+
+typedef struct {
+    WAVE_SHAPE shape;
+    const char *name;
+    FP64 max_err;           /* LSB Q15 */
+} TEST_SHAPE;
+
+static FP64 testRef(WAVE_SHAPE shape, FP64 phase, INT32U harm);
+static FP64 testGridRef(WAVE_SHAPE shape, INT32U phase, INT32U harm, INT8U bits);
+static FP64 testCoef(WAVE_SHAPE shape, INT32U h);
+static FP64 testScale(WAVE_SHAPE shape);
+
+static const TEST_SHAPE TestShapes[] = {
+    {WAVE_SHAPE_SINE,     "sine",     1.1},
+    {WAVE_SHAPE_TRIANGLE, "triangle", 2.0},
+    {WAVE_SHAPE_SAWTOOTH, "sawtooth", 2.0},
+    {WAVE_SHAPE_SQUARE,   "square",   2.0},
+    {WAVE_SHAPE_USER,     "user",     3.2}
+};
+static const INT32U TestFreqs[] = {10, 100, 997, 3000, 10000};
+
+static WAVE_MIP_USER TestUser;
+static INT16S TestUserTable[WAVE_USER_SIZE];
+
+int main(void){
+    static INT16S out[TEST_BLOCK];
+    static INT16S whole[TEST_BLOCK];
+    WAVE_GEN gen;
+    WAVE_GEN split;
+    WAVE_TONES tones;
+    static const WAVE_TONE_SET tone_set[6] = {{1, 8192, 0}, {2, 4096, 0}, {3, 4096, 0}, {4, 2048, 0}, {5, 2048, 0},
+                                             {6, 1024, 0}};
+    const TEST_SHAPE *ts;
+    INT32U ph0;
+    INT32U harm;
+    INT8U bits;
+    INT8U grid;
+    INT32U f;
+    INT32U b;
+    INT32U i;
+    INT32U s;
+    INT32U ph;
+    FP64 scale;
+    FP64 err;
+    FP64 max_err;
+    FP64 max_cont;
+
+    for(i = 0; i < WAVE_USER_SIZE; i++){
+        TestUserTable[i] = (INT16S)lround(32767.0 * sin(2.0 * TEST_PI * i / WAVE_USER_SIZE));
+    }
+    WaveMipBuildUser(&TestUser, &TestUserTable[0]);
+
+    for(s = 0; s < (sizeof(TestShapes) / sizeof(TestShapes[0])); s++){
+        ts = &TestShapes[s];
+        scale = testScale(ts->shape);
+        max_err = 0.0;
+        max_cont = 0.0;
+        for(f = 0; f < (sizeof(TestFreqs) / sizeof(TestFreqs[0])); f++){
+            gen.user = &TestUser;
+            gen.tones = (WAVE_TONES *)0;
+            gen.noise = (WAVE_NOISE *)0;
+            WaveGenInit(&gen, ts->shape);
+            gen.step = DDSPhaseStep(TestFreqs[f], TEST_RATE);
+            harm = WAVE_MIP_TOP_HARM >> WaveMipSelect(gen.step);
+            grid = ((ts->shape != WAVE_SHAPE_SINE) && (ts->shape != WAVE_SHAPE_USER)) ? TRUE : FALSE;
+            bits = (grid == TRUE) ? gen.mip->bits[WaveMipSelect(gen.step)] : 0;
+            for(b = 0; b < TEST_BLOCKS; b++){
+                ph0 = gen.phase;
+                WaveGenRender(&gen, &out[0], TEST_BLOCK);
+                for(i = 0; i < TEST_BLOCK; i++){
+                    ph = ph0 + (i * gen.step);
+                    err = fabs(out[i] - (scale * testRef(ts->shape, ph / 4294967296.0, harm)));
+                    max_cont = (err > max_cont) ? err : max_cont;
+                    if(grid == TRUE){
+                        err = fabs(out[i] - (scale * testGridRef(ts->shape, ph, harm, bits)));
+                    }else{
+                    }
+                    max_err = (err > max_err) ? err : max_err;
+                }
+            }
+        }
+        printf("%-8s max error %.2f LSB Q15, %.1f against the continuous series\n", ts->name, max_err, max_cont);
+        HOST_CHECK(max_err <= ts->max_err);
+
+        /* Uneven blocks at one octave give the same samples as one block */
+        gen.user = &TestUser;
+        WaveGenInit(&gen, ts->shape);
+        gen.step = DDSPhaseStep(997, TEST_RATE);
+        split = gen;
+        WaveGenRender(&gen, &whole[0], TEST_BLOCK);
+        for(i = 0; i < TEST_BLOCK; i += 37u){
+            WaveGenRender(&split, &out[i], ((TEST_BLOCK - i) < 37u) ? (TEST_BLOCK - i) : 37u);
+        }
+        HOST_CHECK(split.phase == gen.phase);
+        for(i = 0; (i < TEST_BLOCK) && (out[i] == whole[i]); i++){
+        }
+        HOST_CHECK(i == TEST_BLOCK);
+        HOST_CHECK(WaveGenIsPeriodic(&gen) == TRUE);
+        HOST_CHECK(WaveGenUpsampleWins(&gen, 0xFFFFFFFFu) == FALSE);
+    }
+
+    /* Upsampling the tones shape, harmonics 1 to 6 */
+    WaveToneSet(&tones, &tone_set[0], WAVE_GEN_UP_TONES);
+    gen.tones = &tones;
+    WaveGenInit(&gen, WAVE_SHAPE_TONES);
+    gen.step = DDSPhaseStep(997, TEST_RATE);
+    HOST_CHECK(WaveGenUpsampleWins(&gen, 6u * gen.step) == TRUE);
+    HOST_CHECK(WaveGenUpsampleWins(&gen, (6u * gen.step) - 1u) == FALSE);
+    WaveToneSet(&tones, &tone_set[0], WAVE_GEN_UP_TONES - 1u);
+    HOST_CHECK(WaveGenUpsampleWins(&gen, 0xFFFFFFFFu) == FALSE);
+
+    gen.user = (WAVE_MIP_USER *)0;
+    WaveGenInit(&gen, WAVE_SHAPE_USER);
+    HOST_CHECK(gen.ops == &WaveGenSine);
+    WaveGenInit(&gen, WAVE_SHAPE_COUNT);
+    HOST_CHECK(gen.ops == &WaveGenSine);
+
+    return HostTestEnd("TestWaveGen");
+}
+
+/****************************************************************************
+ * testRef() - Private
+ * The shape at phase (0..1 per period) from harmonics 1..harm, unscaled.
+ ****************************************************************************/
+static FP64 testRef(WAVE_SHAPE shape, FP64 phase, INT32U harm){
+    FP64 sum = 0.0;
+    INT32U h;
+
+    if((shape == WAVE_SHAPE_SINE) || (shape == WAVE_SHAPE_USER)){
+        return sin(2.0 * TEST_PI * phase);
+    }else{
+    }
+    for(h = 1; h <= harm; h++){
+        sum += testCoef(shape, h) * sin(2.0 * TEST_PI * h * phase);
+    }
+    return sum;
+}
+
+/****************************************************************************
+ * testGridRef() - Private
+ * testRef() at the two table points around phase, for a table of 2^bits
+ * entries, interpolated linearly.
+ ****************************************************************************/
+static FP64 testGridRef(WAVE_SHAPE shape, INT32U phase, INT32U harm, INT8U bits){
+    FP64 size = (FP64)(1u << bits);
+    FP64 idx = (FP64)(phase >> (32u - bits));
+    FP64 frac = (FP64)((phase >> (16u - bits)) & 0xFFFFu) / 65536.0;
+
+    return ((1.0 - frac) * testRef(shape, idx / size, harm)) + (frac * testRef(shape, (idx + 1.0) / size, harm));
+}
+
+/****************************************************************************
+ * testCoef() - Private
+ * Sine coefficient of harmonic h of the ideal shape, as tools/GenWaveMip.py.
+ ****************************************************************************/
+static FP64 testCoef(WAVE_SHAPE shape, INT32U h){
+    if(shape == WAVE_SHAPE_SAWTOOTH){
+        return (2.0 / TEST_PI) * (((h % 2u) != 0) ? 1.0 : -1.0) / h;
+    }else if((h % 2u) == 0){
+        return 0.0;
+    }else if(shape == WAVE_SHAPE_SQUARE){
+        return (4.0 / TEST_PI) / h;
+    }else{
+        return (8.0 / (TEST_PI * TEST_PI)) * (((h % 4u) == 1) ? 1.0 : -1.0) / ((FP64)h * h);
+    }
+}
+
+/****************************************************************************
+ * testScale() - Private
+ * Q15 scale of the shape: 32767 for the sines, and for the table shapes
+ * the one that fits the largest overshoot of any octave, as the generator.
+ ****************************************************************************/
+static FP64 testScale(WAVE_SHAPE shape){
+    FP64 peak = 0.0;
+    FP64 v;
+    INT32U level;
+    INT32U size;
+    INT32U n;
+
+    if((shape == WAVE_SHAPE_SINE) || (shape == WAVE_SHAPE_USER)){
+        return 32767.0;
+    }else{
+    }
+    for(level = 0; level < WAVE_MIP_LEVELS; level++){
+        size = 1u << WaveMipSawtooth.bits[level];
+        for(n = 0; n < size; n++){
+            v = fabs(testRef(shape, (FP64)n / size, WAVE_MIP_TOP_HARM >> level));
+            peak = (v > peak) ? v : peak;
+        }
+    }
+    return 32767.0 / peak;
+}
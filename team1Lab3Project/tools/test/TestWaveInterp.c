@@ -0,0 +1,215 @@
+/****************************************************************************
+ * TestWaveInterp.c
+ * Host test of the polyphase upsampler in WaveInterp.c. Built twice by the
+ * Makefile: TestWaveInterp checks the portable path and TestWaveInterp_dsp
+ * the packed path on the emulated DSP intrinsics of tools/host/HostDsp.h.
+ *  - WaveInterpBlock() matches WaveInterpBlockRef() bit for bit over
+ *    random blocks, full scale inputs included, with the history carried
+ *  - a channel that re-primes its history from the generator, as
+ *    waveRenderUp() in WaveRender.c does, continues an uninterrupted stream
+ *    exactly
+ *  - at 200 kS/s the worst spur of an upsampled sine stays below the
+ *    12-bit DAC's resolution. The direct DDS spur is printed next to it.
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+#include "WaveTone.h"
+#include "WaveNoise.h"
+#include "WaveInterp.h"
+#include "HostTest.h"
+
+#define TEST_MAX_IN         128u        /* render-rate samples per block     */
+#define TEST_RUNS           2000u
+#define TEST_BLOCK          512u        /* DAC-rate samples per stream block */
+#define TEST_BLOCKS         32u
+#define TEST_PRIME_BLOCK    11u         /* block the second stream joins at  */
+#define TEST_RATE           200000u
+#define TEST_SPUR_LEN       (TEST_BLOCK * TEST_BLOCKS)
+#define TEST_SPUR_SKIP      64u         /* FIR start-up from silence         */
+#define TEST_SPUR_GRID      97.0        /* Hz between scanned frequencies    */
+#define TEST_SPUR_GUARD     800.0       /* Hz kept clear of the tone         */
+#define TEST_MAX_SPUR       -74.0       /* dBc, 12-bit DAC quantization      */
+#define TEST_PI             3.14159265358979323846
+
+static INT16S testRandS16(void);
+static INT32U testStreams(WAVE_SHAPE shape, INT32U freq);
+static FP64 testSpur(const INT16S *x, INT32U num, FP64 freq);
+static FP64 testLevel(const FP64 *x, INT32U num, FP64 freq);
+
+static const INT32U TestFreqs[] = {1000, 5000, 10000};
+
+int main(void){
+    static INT16S in[WAVE_INTERP_HIST + TEST_MAX_IN];
+    static INT16S in_ref[WAVE_INTERP_HIST + TEST_MAX_IN];
+    static INT16S out[WAVE_INTERP_L * TEST_MAX_IN];
+    static INT16S ref[WAVE_INTERP_L * TEST_MAX_IN];
+    static INT16S direct[TEST_SPUR_LEN];
+    static INT16S up[TEST_SPUR_LEN];
+    static INT16S lowrate[WAVE_INTERP_HIST + (TEST_BLOCK / WAVE_INTERP_L)];
+    INT32U run;
+    INT32U num;
+    INT32U i;
+    INT32U f;
+    INT32U b;
+    INT32U phase;
+    INT32U step;
+    INT32U bad = 0;
+    INT32U prime_bad = 0;
+    FP64 spur_direct;
+    FP64 spur_up;
+
+    /* Packed kernel against the reference */
+    WaveInterpReset(&in[0]);
+    WaveInterpReset(&in_ref[0]);
+    srand(12);
+    for(run = 0; run < TEST_RUNS; run++){
+        num = 1u + ((INT32U)rand() % TEST_MAX_IN);
+        for(i = 0; i < num; i++){
+            in[WAVE_INTERP_HIST + i] = (run < 64u) ? (((i & 1u) == 0) ? 32767 : -32768) : testRandS16();
+            in_ref[WAVE_INTERP_HIST + i] = in[WAVE_INTERP_HIST + i];
+        }
+        WaveInterpBlock(&in[0], num, &out[0]);
+        WaveInterpBlockRef(&in_ref[0], num, &ref[0]);
+        for(i = 0; i < (WAVE_INTERP_L * num); i++){
+            bad += (out[i] != ref[i]) ? 1u : 0u;
+        }
+        for(i = 0; i < WAVE_INTERP_HIST; i++){
+            bad += (in[i] != in_ref[i]) ? 1u : 0u;
+        }
+    }
+    printf("%u blocks: %u mismatches against the reference\n", TEST_RUNS, bad);
+    HOST_CHECK(bad == 0);
+
+    /* Re-primed history against an uninterrupted stream */
+    for(f = 0; f < (sizeof(TestFreqs) / sizeof(TestFreqs[0])); f++){
+        prime_bad += testStreams(WAVE_SHAPE_SINE, TestFreqs[f]);
+        prime_bad += testStreams(WAVE_SHAPE_TRIANGLE, TestFreqs[f]);
+    }
+    printf("re-primed streams: %u mismatches\n", prime_bad);
+    HOST_CHECK(prime_bad == 0);
+
+    /* Spurs of the direct and the upsampled sine */
+    for(f = 0; f < (sizeof(TestFreqs) / sizeof(TestFreqs[0])); f++){
+        step = DDSPhaseStep(TestFreqs[f], TEST_RATE);
+        phase = 0;
+        DDSSineBlock(&phase, step, &direct[0], TEST_SPUR_LEN);
+        phase = 0;
+        WaveInterpReset(&lowrate[0]);
+        for(b = 0; b < TEST_SPUR_LEN; b += TEST_BLOCK){
+            DDSSineBlock(&phase, step * WAVE_INTERP_L, &lowrate[WAVE_INTERP_HIST], TEST_BLOCK / WAVE_INTERP_L);
+            WaveInterpBlock(&lowrate[0], TEST_BLOCK / WAVE_INTERP_L, &up[b]);
+        }
+        spur_direct = testSpur(&direct[0], TEST_SPUR_LEN, TestFreqs[f]);
+        spur_up = testSpur(&up[TEST_SPUR_SKIP], TEST_SPUR_LEN - TEST_SPUR_SKIP, TestFreqs[f]);
+        printf("%5u Hz: worst spur direct %.1f dBc, upsampled %.1f dBc\n", TestFreqs[f], spur_direct, spur_up);
+        HOST_CHECK(spur_up <= TEST_MAX_SPUR);
+    }
+
+#ifdef HOST_DSP
+    return HostTestEnd("TestWaveInterp_dsp");
+#else
+    return HostTestEnd("TestWaveInterp");
+#endif
+}
+
+static INT16S testRandS16(void){
+    return (INT16S)(((INT32U)rand() & 0xFFFFu) - 0x8000u);
+}
+
+/****************************************************************************
+ * testStreams() - Private
+ * Upsamples shape at freq twice: once from the start, and once joining at
+ * TEST_PRIME_BLOCK with the history rendered from the generator. Returns
+ * the samples that differ from the joined block on.
+ ****************************************************************************/
+static INT32U testStreams(WAVE_SHAPE shape, INT32U freq){
+    static INT16S whole[WAVE_INTERP_HIST + (TEST_BLOCK / WAVE_INTERP_L)];
+    static INT16S joined[WAVE_INTERP_HIST + (TEST_BLOCK / WAVE_INTERP_L)];
+    static INT16S out_whole[TEST_BLOCK];
+    static INT16S out_joined[TEST_BLOCK];
+    WAVE_GEN gen;
+    WAVE_GEN late;
+    INT32U num_in = TEST_BLOCK / WAVE_INTERP_L;
+    INT32U bad = 0;
+    INT32U b;
+    INT32U i;
+
+    gen.user = (WAVE_MIP_USER *)0;
+    gen.tones = (WAVE_TONES *)0;
+    gen.noise = (WAVE_NOISE *)0;
+    WaveGenInit(&gen, shape);
+    gen.step = DDSPhaseStep(freq, TEST_RATE) * WAVE_INTERP_L;
+    WaveInterpReset(&whole[0]);
+    for(b = 0; b < TEST_BLOCKS; b++){
+        if(b == TEST_PRIME_BLOCK){
+            late = gen;
+            late.phase -= WAVE_INTERP_HIST * late.step;
+            WaveGenRender(&late, &joined[0], WAVE_INTERP_HIST);
+        }else{
+        }
+        WaveGenRender(&gen, &whole[WAVE_INTERP_HIST], num_in);
+        WaveInterpBlock(&whole[0], num_in, &out_whole[0]);
+        if(b >= TEST_PRIME_BLOCK){
+            WaveGenRender(&late, &joined[WAVE_INTERP_HIST], num_in);
+            WaveInterpBlock(&joined[0], num_in, &out_joined[0]);
+            for(i = 0; i < TEST_BLOCK; i++){
+                bad += (out_joined[i] != out_whole[i]) ? 1u : 0u;
+            }
+        }else{
+        }
+    }
+    return bad;
+}
+
+/****************************************************************************
+ * testSpur() - Private
+ * Largest line on a TEST_SPUR_GRID Hz scan of x, away from freq, in dB
+ * against the line at freq. x is Blackman-Harris windowed.
+ ****************************************************************************/
+static FP64 testSpur(const INT16S *x, INT32U num, FP64 freq){
+    static FP64 xw[TEST_SPUR_LEN];
+    FP64 w;
+    FP64 line;
+    FP64 level;
+    FP64 worst = 0.0;
+    FP64 g;
+    INT32U i;
+
+    for(i = 0; i < num; i++){
+        w = 0.35875 - (0.48829 * cos(2.0 * TEST_PI * i / num)) + (0.14128 * cos(4.0 * TEST_PI * i / num)) -
+            (0.01168 * cos(6.0 * TEST_PI * i / num));
+        xw[i] = w * x[i];
+    }
+    line = testLevel(&xw[0], num, freq);
+    for(g = 200.0; g < (TEST_RATE / 2.0); g += TEST_SPUR_GRID){
+        if(fabs(g - freq) >= TEST_SPUR_GUARD){
+            level = testLevel(&xw[0], num, g);
+            worst = (level > worst) ? level : worst;
+        }else{
+        }
+    }
+    return 20.0 * log10(worst / line);
+}
+
+/****************************************************************************
+ * testLevel() - Private
+ * Magnitude of x at freq, by Goertzel.
+ ****************************************************************************/
+static FP64 testLevel(const FP64 *x, INT32U num, FP64 freq){
+    FP64 coef = 2.0 * cos(2.0 * TEST_PI * freq / TEST_RATE);
+    FP64 s0;
+    FP64 s1 = 0.0;
+    FP64 s2 = 0.0;
+    INT32U i;
+
+    for(i = 0; i < num; i++){
+        s0 = x[i] + (coef * s1) - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    return sqrt((s1 * s1) + (s2 * s2) - (coef * s1 * s2));
+}
@@ -0,0 +1,128 @@
+/****************************************************************************
+ * TestWaveMod.c
+ * Host test of the block-rate LFO modulation in WaveMod.c, a 1 kHz sine
+ * at TEST_RATE in TEST_BLOCK sample blocks, as the original commit
+ * measured it.
+ *  - AM, TEST_AM_LFO_CHZ at TEST_AM_DEPTH percent, stays within
+ *    TEST_MAX_AM_ERR of full scale of the unmodulated carrier times the
+ *    ideal gain 1 - depth (1 - sin)/2, and never exceeds the carrier
+ *  - FM, TEST_FM_LFO_CHZ with TEST_FM_DEV Hz deviation, keeps the
+ *    instantaneous frequency within TEST_MAX_FM_ERR Hz of the ideal. The
+ *    frequency is read from the output: a second channel a quarter period
+ *    ahead gives the cosine, atan2() the phase and its advance over
+ *    TEST_FM_SPAN samples the frequency
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveGen.h"
+#include "WaveMip.h"
+#include "WaveTone.h"
+#include "WaveNoise.h"
+#include "WaveMod.h"
+#include "HostTest.h"
+
+#define TEST_RATE           48000u
+#define TEST_BLOCK          480u
+#define TEST_BLOCKS         200u        /* 2 s                               */
+#define TEST_LEN            (TEST_BLOCK * TEST_BLOCKS)
+#define TEST_FREQ           1000u
+#define TEST_AM_LFO_CHZ     200u        /* 2 Hz                              */
+#define TEST_AM_DEPTH       50u
+#define TEST_MAX_AM_ERR     5.5e-4      /* of full scale                     */
+#define TEST_FM_LFO_CHZ     500u        /* 5 Hz                              */
+#define TEST_FM_DEV         200u        /* Hz                                */
+#define TEST_FM_SPAN        8u          /* samples per frequency reading     */
+#define TEST_MAX_FM_ERR     2.5         /* Hz, the chord of the block ramp   */
+#define TEST_PI             3.14159265358979323846
+
+static void testGen(WAVE_GEN *gen, INT32U phase);
+
+static INT16S TestOut[TEST_LEN];
+static INT16S TestQuad[TEST_LEN];
+
+int main(void){
+    WAVE_GEN gen;
+    WAVE_GEN quad;
+    WAVE_MOD mod;
+    WAVE_MOD mod_quad;
+    INT32U b;
+    INT32U n;
+    INT32U j;
+    INT32U over = 0;
+    FP64 t;
+    FP64 gain;
+    FP64 carrier;
+    FP64 err;
+    FP64 max_am = 0.0;
+    FP64 ph0;
+    FP64 ph1;
+    FP64 dph;
+    FP64 f;
+    FP64 ideal;
+    FP64 max_fm = 0.0;
+
+    /* AM against the carrier times the ideal gain */
+    testGen(&gen, 0);
+    testGen(&quad, 0);
+    WaveModStart(&mod, WAVE_MOD_AM, TEST_AM_LFO_CHZ, TEST_AM_DEPTH, TEST_RATE);
+    for(b = 0; b < TEST_BLOCKS; b++){
+        WaveModRender(&mod, &gen, &TestOut[b * TEST_BLOCK], TEST_BLOCK);
+    }
+    WaveGenRender(&quad, &TestQuad[0], TEST_LEN);
+    for(n = 0; n < TEST_LEN; n++){
+        t = (FP64)n / TEST_RATE;
+        carrier = TestQuad[n];
+        gain = 1.0 - ((TEST_AM_DEPTH / 100.0) * (1.0 - sin(2.0 * TEST_PI * TEST_AM_LFO_CHZ * t / 100.0)) / 2.0);
+        err = fabs(TestOut[n] - (carrier * gain)) / 32768.0;
+        max_am = (err > max_am) ? err : max_am;
+        over += (abs(TestOut[n]) > abs(TestQuad[n])) ? 1u : 0u;
+    }
+    printf("AM %u.%02u Hz at %u%%: worst %.2e of full scale, %u samples over the carrier\n", TEST_AM_LFO_CHZ / 100u,
+           TEST_AM_LFO_CHZ % 100u, TEST_AM_DEPTH, max_am, over);
+    HOST_CHECK(max_am <= TEST_MAX_AM_ERR);
+    HOST_CHECK(over == 0);
+
+    /* FM, frequency from the phase of the sine and cosine channels */
+    testGen(&gen, 0);
+    testGen(&quad, 0x40000000u);
+    WaveModStart(&mod, WAVE_MOD_FM, TEST_FM_LFO_CHZ, TEST_FM_DEV, TEST_RATE);
+    mod_quad = mod;
+    for(b = 0; b < TEST_BLOCKS; b++){
+        WaveModRender(&mod, &gen, &TestOut[b * TEST_BLOCK], TEST_BLOCK);
+        WaveModRender(&mod_quad, &quad, &TestQuad[b * TEST_BLOCK], TEST_BLOCK);
+    }
+    for(n = 0; (n + TEST_FM_SPAN) < TEST_LEN; n += TEST_FM_SPAN){
+        ph0 = atan2(TestOut[n], TestQuad[n]);
+        ph1 = atan2(TestOut[n + TEST_FM_SPAN], TestQuad[n + TEST_FM_SPAN]);
+        dph = ph1 - ph0;
+        dph += (dph < 0.0) ? (2.0 * TEST_PI) : 0.0;
+        f = dph * TEST_RATE / (2.0 * TEST_PI * TEST_FM_SPAN);
+        ideal = 0.0;
+        for(j = 0; j < TEST_FM_SPAN; j++){
+            ideal += TEST_FREQ + (TEST_FM_DEV * sin(2.0 * TEST_PI * TEST_FM_LFO_CHZ * (n + j) / (100.0 * TEST_RATE)));
+        }
+        ideal /= TEST_FM_SPAN;
+        err = fabs(f - ideal);
+        max_fm = (err > max_fm) ? err : max_fm;
+    }
+    printf("FM %u.%02u Hz, %u Hz deviation: worst instantaneous frequency error %.2f Hz\n",
+           TEST_FM_LFO_CHZ / 100u, TEST_FM_LFO_CHZ % 100u, TEST_FM_DEV, max_fm);
+    HOST_CHECK(max_fm <= TEST_MAX_FM_ERR);
+
+    return HostTestEnd("TestWaveMod");
+}
+
+/****************************************************************************
+ * testGen() - Private
+ * A sine generator at TEST_FREQ and TEST_RATE starting from phase.
+ ****************************************************************************/
+static void testGen(WAVE_GEN *gen, INT32U phase){
+    gen->user = (WAVE_MIP_USER *)0;
+    gen->tones = (WAVE_TONES *)0;
+    gen->noise = (WAVE_NOISE *)0;
+    WaveGenInit(gen, WAVE_SHAPE_SINE);
+    gen->phase = phase;
+    gen->step = DDSPhaseStep(TEST_FREQ, TEST_RATE);
+}
@@ -0,0 +1,170 @@
+/****************************************************************************
+ * TestWaveNoise.c
+ * Host test of the noise generators in WaveNoise.c over TEST_LEN samples.
+ *  - the top byte of the raw words passes a chi-square test and bits 8 to
+ *    31 have no bias beyond TEST_MAX_BIAS sigma
+ *  - white noise has the rms of uniform Q15, no lag-1 correlation, and
+ *    does not correlate with another channel's seed
+ *  - split blocks continue the stream exactly
+ *  - pink noise falls about 3 dB per octave across the octave bands from
+ *    bin 2 up, from a Hann windowed periodogram averaged over TEST_SEGS
+ *    segments. Bin 1 is left out, the window leaks the mean into it
+ ****************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "MCUType.h"
+#include "WaveNoise.h"
+#include "HostTest.h"
+
+#define TEST_LEN            (1u << 22)
+#define TEST_MAX_CHI2       310.0       /* 255 dof, 99th percentile          */
+#define TEST_MAX_BIAS       4.0         /* sigma                             */
+#define TEST_MAX_CORR       (4.0 / 2048.0)  /* 4 sigma at TEST_LEN samples   */
+#define TEST_MAX_RMS_ERR    0.001       /* relative to uniform               */
+#define TEST_SPLIT          1000u
+#define TEST_SEG            4096u       /* periodogram segment               */
+#define TEST_SEGS           64u
+#define TEST_OCTAVES        10u         /* bands from bin 2 to Nyquist       */
+#define TEST_OCT_BINS       16u         /* bins averaged per octave at most  */
+#define TEST_MIN_SLOPE      2.5         /* dB per octave                     */
+#define TEST_MAX_SLOPE      3.5
+#define TEST_PI             3.14159265358979323846
+
+static FP64 testBand(const INT16S *x, INT32U lo);
+
+static INT32U TestWords[TEST_LEN];
+static INT16S TestWhite[TEST_LEN];
+static INT16S TestOther[TEST_LEN];
+static FP64 TestCos[TEST_SEG];
+static FP64 TestSin[TEST_SEG];
+
+int main(void){
+    WAVE_NOISE noise;
+    WAVE_NOISE split;
+    WAVE_NOISE other;
+    INT32U words[16];
+    INT32U hist[256];
+    INT32U bits[32];
+    INT32U i;
+    INT32U b;
+    INT32U oct;
+    FP64 chi2 = 0.0;
+    FP64 expect = TEST_LEN / 256.0;
+    FP64 bias;
+    FP64 max_bias = 0.0;
+    FP64 mean = 0.0;
+    FP64 var = 0.0;
+    FP64 lag1 = 0.0;
+    FP64 cross = 0.0;
+    FP64 rms;
+    FP64 uniform = 65536.0 / sqrt(12.0);
+    FP64 band[TEST_OCTAVES];
+    FP64 sx = 0.0;
+    FP64 sy = 0.0;
+    FP64 sxx = 0.0;
+    FP64 sxy = 0.0;
+    FP64 slope;
+
+    /* Raw words */
+    WaveNoiseSeed(&noise, 0);
+    split = noise;
+    WaveNoiseFill(&noise, &TestWords[0], TEST_LEN);
+    memset(&hist[0], 0, sizeof(hist));
+    memset(&bits[0], 0, sizeof(bits));
+    for(i = 0; i < TEST_LEN; i++){
+        hist[TestWords[i] >> 24]++;
+        for(b = 0; b < 32u; b++){
+            bits[b] += (TestWords[i] >> b) & 1u;
+        }
+    }
+    for(i = 0; i < 256u; i++){
+        chi2 += (hist[i] - expect) * (hist[i] - expect) / expect;
+    }
+    for(b = 8; b < 32u; b++){
+        bias = fabs(bits[b] - (TEST_LEN / 2.0)) / sqrt(TEST_LEN / 4.0);
+        max_bias = (bias > max_bias) ? bias : max_bias;
+    }
+    printf("top byte chi-square %.1f (255 dof), worst bias bits 8..31 %.2f sigma\n", chi2, max_bias);
+    HOST_CHECK(chi2 <= TEST_MAX_CHI2);
+    HOST_CHECK(max_bias <= TEST_MAX_BIAS);
+
+    /* The same words in uneven blocks */
+    for(i = 0; i < TEST_SPLIT; i += b){
+        b = (i % 13u) + 1u;
+        b = (b < (TEST_SPLIT - i)) ? b : (TEST_SPLIT - i);
+        WaveNoiseFill(&split, &words[0], b);
+        HOST_CHECK(memcmp(&words[0], &TestWords[i], b * sizeof(words[0])) == 0);
+    }
+
+    /* White noise, and a second channel seeded next to it */
+    WaveNoiseWhite(&noise, &TestWhite[0], TEST_LEN);
+    WaveNoiseSeed(&other, 1);
+    WaveNoiseWhite(&other, &TestOther[0], TEST_LEN);
+    for(i = 0; i < TEST_LEN; i++){
+        mean += TestWhite[i];
+    }
+    mean /= TEST_LEN;
+    for(i = 0; i < TEST_LEN; i++){
+        var += (TestWhite[i] - mean) * (TestWhite[i] - mean);
+        lag1 += (i > 0) ? ((TestWhite[i] - mean) * (TestWhite[i - 1u] - mean)) : 0.0;
+        cross += (TestWhite[i] - mean) * TestOther[i];
+    }
+    rms = sqrt(var / TEST_LEN);
+    printf("white mean %.2f rms %.1f (uniform %.1f), lag-1 correlation %.5f, seed 0/1 %.5f\n", mean, rms,
+           uniform, lag1 / var, cross / var);
+    HOST_CHECK(fabs((rms / uniform) - 1.0) <= TEST_MAX_RMS_ERR);
+    HOST_CHECK(fabs(lag1 / var) <= TEST_MAX_CORR);
+    HOST_CHECK(fabs(cross / var) <= TEST_MAX_CORR);
+
+    /* Pink slope, least squares over the octave bands */
+    WaveNoisePink(&noise, &TestWhite[0], TEST_LEN);
+    for(i = 0; i < TEST_SEG; i++){
+        TestCos[i] = cos(2.0 * TEST_PI * i / TEST_SEG);
+        TestSin[i] = sin(2.0 * TEST_PI * i / TEST_SEG);
+    }
+    for(oct = 0; oct < TEST_OCTAVES; oct++){
+        band[oct] = 10.0 * log10(testBand(&TestWhite[0], 2u << oct));
+        sx += oct;
+        sy += band[oct];
+        sxx += (FP64)oct * oct;
+        sxy += oct * band[oct];
+    }
+    slope = -((TEST_OCTAVES * sxy) - (sx * sy)) / ((TEST_OCTAVES * sxx) - (sx * sx));
+    printf("pink falls %.2f dB/octave, %.1f dB over %u octave bands\n", slope, band[0] - band[TEST_OCTAVES - 1u],
+           TEST_OCTAVES);
+    HOST_CHECK((slope >= TEST_MIN_SLOPE) && (slope <= TEST_MAX_SLOPE));
+
+    return HostTestEnd("TestWaveNoise");
+}
+
+/****************************************************************************
+ * testBand() - Private
+ * Mean periodogram power of x over the octave of bins lo to 2*lo-1, at
+ * most TEST_OCT_BINS of them evenly spaced.
+ ****************************************************************************/
+static FP64 testBand(const INT16S *x, INT32U lo){
+    FP64 re;
+    FP64 im;
+    FP64 w;
+    FP64 power = 0.0;
+    INT32U inc = (lo > TEST_OCT_BINS) ? (lo / TEST_OCT_BINS) : 1u;
+    INT32U count = 0;
+    INT32U seg;
+    INT32U k;
+    INT32U n;
+
+    for(k = lo; k < (2u * lo); k += inc){
+        for(seg = 0; seg < TEST_SEGS; seg++){
+            re = 0.0;
+            im = 0.0;
+            for(n = 0; n < TEST_SEG; n++){
+                w = x[(seg * TEST_SEG) + n] * (0.5 - (0.5 * TestCos[n]));
+                re += w * TestCos[(k * n) % TEST_SEG];
+                im += w * TestSin[(k * n) % TEST_SEG];
+            }
+            power += (re * re) + (im * im);
+        }
+        count++;
+    }
+    return power / count;
+}
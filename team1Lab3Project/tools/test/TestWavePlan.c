@@ -0,0 +1,211 @@
+/****************************************************************************
+ * TestWavePlan.c
+ * Host test of the sample rate and block planner in WavePlan.c.
+ *  - the rates and DMA interrupt rates at the settings in the original
+ *    commit, against the fixed 48 kS/s, 375 blocks/s it replaced
+ *  - for every frequency, the rate, block size and the phase step at the
+ *    exact PIT rate
+ *  - WavePlanForChannels() plans for the highest channel
+ *  - WavePlanFitLoop() finds a loop within WAVE_LOOP_MAX_PPM for every
+ *    frequency from 10 Hz to 10 kHz, exact at the common settings
+ *  - WavePlanFitChannelLoop() gives every channel whole periods in the
+ *    loop within WAVE_LOOP_MAX_PPM, for pairs of channel frequencies
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "app_cfg.h"
+#include "WavePlan.h"
+#include "HostTest.h"
+
+#define TEST_MAX_FREQ       10000u
+#define TEST_OLD_RATE       48000.0     /* fixed rate before the planner     */
+#define TEST_OLD_IRQ        375.0       /* blocks/s before the planner       */
+#define TEST_MIN_OVERSAMPLE 47.9        /* samples per period, after PIT rounding */
+#define TEST_LOOP_MAX_LEN   1024u       /* DMA buffer length in the original sweep */
+#define TEST_CH_LOOP_LEN    (APP_CFG_WAVE_NUM_BLOCKS * APP_CFG_WAVE_MAX_BLOCK)
+
+typedef struct {
+    INT32U freq;
+    INT32U rate;
+    INT16U block;
+} TEST_PLAN_CASE;
+
+static FP64 testRate(const WAVE_PLAN *plan);
+static FP64 testLoopPpm(const WAVE_LOOP *loop, INT32U freq);
+static void testChannelLoops(void);
+
+static const TEST_PLAN_CASE TestPlanCases[] = {
+    {10, 8000, 80}, {50, 8000, 80}, {100, 8000, 80}, {1000, 48000, 480}, {10000, 200000, 512}
+};
+static const INT32U TestLoopExact[] = {10, 100, 1000, 3000};
+
+int main(void){
+    WAVE_PLAN plan;
+    WAVE_PLAN chplan;
+    WAVE_LOOP loop;
+    INT32U freqs[2];
+    INT32U steps[2];
+    INT32U freq;
+    INT32U block;
+    INT32U i;
+    FP64 rate;
+    FP64 exact;
+    FP64 ppm;
+    FP64 max_ppm = 0.0;
+    FP64 max_lsb = 0.0;
+    INT32U max_ppm_freq = 0;
+    INT32U misses = 0;
+
+    printf(" freq   rate  block  blocks/s  samples%%  irq%%\n");
+    for(i = 0; i < (sizeof(TestPlanCases) / sizeof(TestPlanCases[0])); i++){
+        WavePlanForFreq(TestPlanCases[i].freq, &plan);
+        printf("%5u %6u %6u %9.1f %8.0f %5.0f\n", plan.freq, plan.sample_rate, plan.block_samples,
+               (FP64)plan.sample_rate / plan.block_samples, 100.0 * plan.sample_rate / TEST_OLD_RATE,
+               100.0 * plan.sample_rate / plan.block_samples / TEST_OLD_IRQ);
+        HOST_CHECK(plan.sample_rate == TestPlanCases[i].rate);
+        HOST_CHECK(plan.block_samples == TestPlanCases[i].block);
+    }
+
+    for(freq = 1; freq <= TEST_MAX_FREQ; freq++){
+        WavePlanForFreq(freq, &plan);
+        rate = testRate(&plan);
+        HOST_CHECK((rate >= WAVE_PLAN_MIN_RATE) && (rate <= WAVE_PLAN_MAX_RATE));
+        HOST_CHECK(plan.sample_rate == (INT32U)rate);
+        if(rate < WAVE_PLAN_MAX_RATE){
+            HOST_CHECK((rate / freq) >= TEST_MIN_OVERSAMPLE);
+        }else{
+        }
+        block = (plan.sample_rate / WAVE_PLAN_BLOCK_RATE) & ~(WAVE_PLAN_BLOCK_ALIGN - 1u);
+        block = (block > WAVE_PLAN_MAX_BLOCK) ? WAVE_PLAN_MAX_BLOCK : block;
+        HOST_CHECK(plan.block_samples == ((block < WAVE_PLAN_MIN_BLOCK) ? WAVE_PLAN_MIN_BLOCK : block));
+
+        /* Step against the exact PIT rate, not the whole-Hz sample_rate */
+        exact = freq * 4294967296.0 / rate;
+        HOST_CHECK(fabs(plan.phase_step - exact) <= 0.5);
+        if(fabs(plan.phase_step - exact) > max_lsb){
+            max_lsb = fabs(plan.phase_step - exact);
+        }else{
+        }
+        ppm = 1.0e6 * fabs((plan.phase_step * rate / 4294967296.0) - freq) / freq;
+        if((freq >= 10) && (ppm > max_ppm)){
+            max_ppm = ppm;
+            max_ppm_freq = freq;
+        }else{
+        }
+    }
+    printf("1-%u Hz: step within %.3f LSB, 10-%u Hz: worst %.3f ppm at %u Hz\n", TEST_MAX_FREQ, max_lsb,
+           TEST_MAX_FREQ, max_ppm, max_ppm_freq);
+
+    for(freq = 5; freq <= TEST_MAX_FREQ; freq += 97){
+        freqs[0] = freq;
+        freqs[1] = (freq * 3u) / 2u;
+        WavePlanForChannels(&freqs[0], 2, &chplan, &steps[0]);
+        WavePlanForFreq(freqs[1], &plan);
+        HOST_CHECK((chplan.pit_ldval == plan.pit_ldval) && (chplan.block_samples == plan.block_samples));
+        HOST_CHECK((steps[0] == WavePlanStep(&plan, freqs[0])) && (steps[1] == plan.phase_step));
+    }
+
+    /* Cached loops */
+    max_ppm = 0.0;
+    for(freq = 10; freq <= TEST_MAX_FREQ; freq++){
+        WavePlanForFreq(freq, &plan);
+        if(WavePlanFitLoop(&plan, TEST_LOOP_MAX_LEN, &loop) == FALSE){
+            misses++;
+            continue;
+        }else{
+        }
+        HOST_CHECK((loop.length >= WAVE_LOOP_MIN_LEN) && (loop.length <= TEST_LOOP_MAX_LEN));
+        HOST_CHECK((4 * abs((INT32S)loop.pit_ldval - (INT32S)plan.pit_ldval)) <= (INT32S)(plan.pit_ldval + 1));
+        HOST_CHECK(loop.phase_step == (INT32U)((((INT64U)loop.periods << 32) + (loop.length >> 1)) / loop.length));
+        ppm = testLoopPpm(&loop, freq);
+        HOST_CHECK(ppm <= WAVE_LOOP_MAX_PPM);
+        if(ppm > max_ppm){
+            max_ppm = ppm;
+            max_ppm_freq = freq;
+        }else{
+        }
+    }
+    printf("loops 10-%u Hz: %u without a loop, worst %.1f ppm at %u Hz\n", TEST_MAX_FREQ, misses, max_ppm,
+           max_ppm_freq);
+    HOST_CHECK(misses == 0);
+    for(i = 0; i < (sizeof(TestLoopExact) / sizeof(TestLoopExact[0])); i++){
+        WavePlanForFreq(TestLoopExact[i], &plan);
+        HOST_CHECK(WavePlanFitLoop(&plan, TEST_LOOP_MAX_LEN, &loop) == TRUE);
+        HOST_CHECK(testLoopPpm(&loop, TestLoopExact[i]) == 0.0);
+    }
+    WavePlanForFreq(0, &plan);
+    HOST_CHECK(WavePlanFitLoop(&plan, TEST_LOOP_MAX_LEN, &loop) == FALSE);
+
+    testChannelLoops();
+
+    return HostTestEnd("TestWavePlan");
+}
+
+/****************************************************************************
+ * testRate() - Private
+ * The rate the PIT really runs at for plan.
+ ****************************************************************************/
+static FP64 testRate(const WAVE_PLAN *plan){
+    return (FP64)WAVE_BUS_CLK / (plan->pit_ldval + 1);
+}
+
+/****************************************************************************
+ * testLoopPpm() - Private
+ * Error of the frequency loop plays, against freq, in ppm.
+ ****************************************************************************/
+static FP64 testLoopPpm(const WAVE_LOOP *loop, INT32U freq){
+    FP64 out;
+
+    out = (FP64)loop->periods * WAVE_BUS_CLK / ((loop->pit_ldval + 1.0) * loop->length);
+    return 1.0e6 * fabs(out - freq) / freq;
+}
+
+/****************************************************************************
+ * testChannelLoops() - Private
+ * Pairs DAC0 at 10 Hz to 10 kHz with DAC1 silent, equal, at double or half
+ * and at 3/2. A fitted loop must give each channel a step that wraps the
+ * phase back to within half a loop length of a whole period count, and a
+ * frequency at the loop's PIT rate within WAVE_LOOP_MAX_PPM.
+ ****************************************************************************/
+static void testChannelLoops(void){
+    WAVE_PLAN plan;
+    WAVE_LOOP loop;
+    INT32U freqs[2];
+    INT32U steps[2];
+    INT32U loop_steps[2];
+    INT32U tried = 0;
+    INT32U fitted = 0;
+    INT32U f0;
+    INT32U k;
+    INT8U ch;
+    INT32S wrap;
+    FP64 out;
+    FP64 ppm;
+    FP64 max_ppm = 0.0;
+
+    for(f0 = 10; f0 <= TEST_MAX_FREQ; f0 += 17){
+        for(k = 0; k < 4; k++){
+            freqs[0] = f0;
+            freqs[1] = (k == 0) ? 0 : ((k == 1) ? f0 : ((k == 2) ? (((2u * f0) > TEST_MAX_FREQ) ? (f0 / 2u) : (2u * f0)) :
+                                                       ((3u * f0) / 2u)));
+            WavePlanForChannels(&freqs[0], 2, &plan, &steps[0]);
+            tried++;
+            HOST_CHECK(plan.freq == ((freqs[0] > freqs[1]) ? freqs[0] : freqs[1]));
+            if(WavePlanFitChannelLoop(&plan, &freqs[0], 2, TEST_CH_LOOP_LEN, &loop, &loop_steps[0]) == FALSE){
+                continue;
+            }else{
+            }
+            fitted++;
+            for(ch = 0; ch < 2; ch++){
+                wrap = (INT32S)(loop_steps[ch] * (INT32U)loop.length);
+                HOST_CHECK(abs(wrap) <= (INT32S)(loop.length / 2u));
+                out = loop_steps[ch] / 4294967296.0 * WAVE_BUS_CLK / (loop.pit_ldval + 1.0);
+                ppm = (freqs[ch] == 0) ? out : (1.0e6 * fabs(out - freqs[ch]) / freqs[ch]);
+                HOST_CHECK(ppm <= WAVE_LOOP_MAX_PPM);
+                max_ppm = (ppm > max_ppm) ? ppm : max_ppm;
+            }
+        }
+    }
+    printf("channel pairs %u, loops fitted %u, worst %.1f ppm\n", tried, fitted, max_ppm);
+}
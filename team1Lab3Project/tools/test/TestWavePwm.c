@@ -0,0 +1,328 @@
+/****************************************************************************
+ * TestWavePwm.c
+ * Host test of the FTM3 values from WavePwm.c that PulseTrain.c loads
+ * through the synchronized reload.
+ *  - for every frequency in range at each duty in TestDuties, MOD and CnV
+ *    describe the period WavePwmCalc() reports, CnV gives the rounded
+ *    duty and duty 100 holds the output high
+ *  - a sequence step played on the alignment and prescaler of a lower
+ *    step, as pulseSeqStart() does, keeps them, gets valid MOD and CnV
+ *    and the period nearest its frequency on that grid
+ *  - WaveSeqTicks() times a step in whole periods within half a period
+ *  - WavePwmPrescale() and WavePwmCalc() give the period and duty of the
+ *    exhaustive WavePwmPlanRef() at every frequency and every duty from 0
+ *    to 100. The frequency error stays within that of half a bus clock at
+ *    WAVE_PWM_MAX_FREQ and the duty within half a count. Over 10 Hz to
+ *    10 kHz the error is far under that of the fixed /16 and /128
+ *    center-aligned setting they replaced
+ *  - WavePwmEdges() on the edge-aligned setting of every frequency, for
+ *    phases and duties across the period, places each edge within half a
+ *    count of its exact position, never ends the pulse before it starts
+ *    and cuts a pulse running past the period at its end
+ *  - WavePwmDeadtime() for every ns up to TEST_DT_MAX_NS gives at least
+ *    the time asked for, less than one step of its prescaler more, on the
+ *    finest prescaler that reaches it, or the longest dead time there is
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WavePwm.h"
+#include "WaveSeq.h"
+#include "HostTest.h"
+
+#define TEST_SEQ_MIN_STEP   1.01        /* ratio between sequence low frequencies */
+#define TEST_MAX_PPM        4167.0      /* half a bus clock at WAVE_PWM_MAX_FREQ  */
+#define TEST_MAX_DUTY       0.42        /* %, half a count of 120 at the top      */
+#define TEST_OLD_LO         10u         /* range of the old fixed setting, Hz     */
+#define TEST_OLD_HI         10000u
+#define TEST_OLD_MAX_PPM    100.0       /* new worst over the old range           */
+#define TEST_EDGE_FINE      1000u       /* every frequency below, Hz              */
+#define TEST_EDGE_STEP      97u         /* frequency step above TEST_EDGE_FINE    */
+#define TEST_PHASE_STEP     7u          /* of WAVE_PWM_EDGE_FULL                  */
+#define TEST_DUTY_STEP      13u
+#define TEST_DT_MAX_NS      20000u
+#define TEST_DT_LONGEST     1008u       /* bus clocks, 63 at /16                  */
+
+static INT32U testBad(const WAVE_PWM *pwm, INT16U duty);
+static INT32U testCounts(const WAVE_PWM *pwm);
+static void testPlanner(void);
+static void testEdges(void);
+static void testDeadtime(void);
+
+static const INT16U TestDuties[] = {0, 1, 33, 50, 99, 100};
+static const INT32U TestSeqRatio[] = {1, 2, 3, 10, 100};
+static const INT32U TestSeqMs[] = {1, 7, 100, 1000, 60000};
+
+int main(void){
+    WAVE_PWM pwm;
+    WAVE_PWM step;
+    INT32U freq;
+    INT32U minfreq;
+    INT32U unit;
+    INT32U clocks;
+    INT32U ticks;
+    INT32U cases = 0;
+    INT32U bad = 0;
+    INT32U seq_cases = 0;
+    INT32U seq_bad = 0;
+    INT32U i;
+    INT32U k;
+    FP64 low;
+    FP64 err;
+    FP64 exact;
+
+    for(freq = WAVE_PWM_MIN_FREQ; freq <= WAVE_PWM_MAX_FREQ; freq++){
+        for(i = 0; i < (sizeof(TestDuties) / sizeof(TestDuties[0])); i++){
+            WavePwmPrescale(freq, &pwm);
+            WavePwmCalc(freq, TestDuties[i], &pwm);
+            bad += testBad(&pwm, TestDuties[i]);
+            cases++;
+        }
+    }
+    printf("%u frequency/duty cases, %u with inconsistent MOD/CnV\n", cases, bad);
+    HOST_CHECK(bad == 0);
+
+    /* Sequence steps on the lowest step's setting */
+    for(low = WAVE_PWM_MIN_FREQ; low <= WAVE_PWM_MAX_FREQ; low *= TEST_SEQ_MIN_STEP){
+        minfreq = (INT32U)low;
+        for(k = 0; k < (sizeof(TestSeqRatio) / sizeof(TestSeqRatio[0])); k++){
+            freq = minfreq * TestSeqRatio[k];
+            if(freq > WAVE_PWM_MAX_FREQ){
+                continue;
+            }else{
+            }
+            WavePwmPrescale(minfreq, &pwm);
+            step = pwm;
+            WavePwmCalc(freq, 50, &step);
+            seq_cases++;
+            seq_bad += ((step.ps != pwm.ps) || (step.center != pwm.center)) ? 1u : 0u;
+            seq_bad += testBad(&step, 50);
+            unit = (step.center == TRUE) ? (2u << step.ps) : (1u << step.ps);
+            exact = (FP64)WAVE_PWM_BUS_CLK / freq;
+            err = (step.period > exact) ? (step.period - exact) : (exact - step.period);
+            if((testCounts(&step) > ((step.center == TRUE) ? 1u : 2u)) && (err >= unit)){
+                seq_bad++;
+            }else{
+            }
+            for(i = 0; i < (sizeof(TestSeqMs) / sizeof(TestSeqMs[0])); i++){
+                ticks = WaveSeqTicks(TestSeqMs[i], WAVE_PWM_BUS_CLK, step.period);
+                clocks = TestSeqMs[i] * (WAVE_PWM_BUS_CLK / 1000u);
+                err = ((FP64)ticks * step.period) - clocks;
+                if(((err > (step.period / 2.0)) && (ticks > 1u)) || (err < -(step.period / 2.0))){
+                    seq_bad++;
+                }else{
+                }
+            }
+        }
+    }
+    printf("%u sequence steps on a lower step's prescaler, %u bad\n", seq_cases, seq_bad);
+    HOST_CHECK(seq_bad == 0);
+
+    testPlanner();
+    testEdges();
+    testDeadtime();
+
+    return HostTestEnd("TestWavePwm");
+}
+
+/****************************************************************************
+ * testCounts() - Private
+ * Counts per period of pwm, in units of its prescaled clock, one count
+ * of a center-aligned period being two clocks.
+ ****************************************************************************/
+static INT32U testCounts(const WAVE_PWM *pwm){
+    return (pwm->center == TRUE) ? pwm->mod : ((INT32U)pwm->mod + 1u);
+}
+
+/****************************************************************************
+ * testBad() - Private
+ * 1 if MOD, CnV and the period of pwm do not agree with each other and
+ * with duty, else 0.
+ ****************************************************************************/
+static INT32U testBad(const WAVE_PWM *pwm, INT16U duty){
+    INT32U unit = (pwm->center == TRUE) ? (2u << pwm->ps) : (1u << pwm->ps);
+    INT32U counts = testCounts(pwm);
+
+    if((counts == 0) || (pwm->period != (counts * unit))){
+        return 1;
+    }else if(duty >= 100){
+        if(pwm->center == TRUE){
+            return (pwm->cnv != pwm->mod) ? 1u : 0u;
+        }else{
+            return ((pwm->cnv <= pwm->mod) && (pwm->mod != 0xFFFFu)) ? 1u : 0u;
+        }
+    }else{
+        return (pwm->cnv != (((counts * duty) + 50u) / 100u)) ? 1u : 0u;
+    }
+}
+
+/****************************************************************************
+ * testPlanner() - Private
+ * Every frequency and duty against WavePwmPlanRef(). The two may pick
+ * different grids for the same period, so the period and the duty
+ * fraction CnV/counts are compared. The old setting is MOD = 1875000/freq
+ * at /16, 234375/freq at /128 below 100 Hz, truncated.
+ ****************************************************************************/
+static void testPlanner(void){
+    WAVE_PWM pwm;
+    WAVE_PWM ref;
+    INT32U freq;
+    INT32U cases = 0;
+    INT32U bad = 0;
+    INT32U ppm_freq = 0;
+    INT32U duty_freq = 0;
+    INT32U old_freq = 0;
+    INT32U new_freq = 0;
+    INT32U old_clk;
+    INT16U duty;
+    FP64 ppm;
+    FP64 max_ppm = 0.0;
+    FP64 derr;
+    FP64 max_duty = 0.0;
+    FP64 old_ppm = 0.0;
+    FP64 new_ppm = 0.0;
+
+    for(freq = WAVE_PWM_MIN_FREQ; freq <= WAVE_PWM_MAX_FREQ; freq++){
+        for(duty = 0; duty <= 100; duty++){
+            WavePwmPrescale(freq, &pwm);
+            WavePwmCalc(freq, duty, &pwm);
+            WavePwmPlanRef(freq, duty, &ref);
+            cases++;
+            if((pwm.period != ref.period) ||
+               (((INT64U)pwm.cnv * testCounts(&ref)) != ((INT64U)ref.cnv * testCounts(&pwm)))){
+                bad++;
+            }else{
+            }
+            if(duty < 100){
+                derr = fabs((100.0 * pwm.cnv / testCounts(&pwm)) - duty);
+                if(derr > max_duty){
+                    max_duty = derr;
+                    duty_freq = freq;
+                }else{
+                }
+            }else{
+            }
+        }
+        ppm = 1.0e6 * fabs(((FP64)WAVE_PWM_BUS_CLK / pwm.period) - freq) / freq;
+        if(ppm > max_ppm){
+            max_ppm = ppm;
+            ppm_freq = freq;
+        }else{
+        }
+        if((freq >= TEST_OLD_LO) && (freq <= TEST_OLD_HI)){
+            if(ppm > new_ppm){
+                new_ppm = ppm;
+                new_freq = freq;
+            }else{
+            }
+            old_clk = (freq >= 100u) ? 1875000u : 234375u;
+            ppm = 1.0e6 * fabs(((FP64)old_clk / (old_clk / freq)) - freq) / freq;
+            if(ppm > old_ppm){
+                old_ppm = ppm;
+                old_freq = freq;
+            }else{
+            }
+        }else{
+        }
+    }
+    printf("%u planner cases, %u mismatches against WavePwmPlanRef()\n", cases, bad);
+    printf("worst frequency error %.0f ppm at %u Hz, worst duty error %.2f%% at %u Hz\n", max_ppm, ppm_freq,
+           max_duty, duty_freq);
+    printf("%u Hz-%u Hz: worst %.0f ppm at %u Hz, was %.0f ppm at %u Hz\n", TEST_OLD_LO, TEST_OLD_HI, new_ppm,
+           new_freq, old_ppm, old_freq);
+    HOST_CHECK(bad == 0);
+    HOST_CHECK(max_ppm <= TEST_MAX_PPM);
+    HOST_CHECK(max_duty <= TEST_MAX_DUTY);
+    HOST_CHECK(new_ppm <= TEST_OLD_MAX_PPM);
+}
+
+/****************************************************************************
+ * testEdges() - Private
+ * WavePwmEdges() against the exact edges, counts * phase and counts * end
+ * over WAVE_PWM_EDGE_FULL, compared in thousandths of a count. An end
+ * edge past 0xFFFF counts, the last count of the longest period, is held
+ * there and only checked for order.
+ ****************************************************************************/
+static void testEdges(void){
+    WAVE_PWM pwm;
+    INT32U freq;
+    INT32U counts;
+    INT32U end;
+    INT32U cases = 0;
+    INT32U bad = 0;
+    INT16U phase;
+    INT16U duty;
+    INT16U c0v;
+    INT16U c1v;
+
+    for(freq = WAVE_PWM_MIN_FREQ; freq <= WAVE_PWM_MAX_FREQ;
+        freq += (freq < TEST_EDGE_FINE) ? 1u : TEST_EDGE_STEP){
+        WavePwmPrescaleEdge(freq, &pwm);
+        WavePwmCalc(freq, 50, &pwm);
+        if(pwm.center == TRUE){
+            bad++;
+            continue;
+        }else{
+        }
+        counts = (INT32U)pwm.mod + 1u;
+        for(phase = 0; phase <= WAVE_PWM_EDGE_FULL; phase += TEST_PHASE_STEP){
+            for(duty = 0; duty <= WAVE_PWM_EDGE_FULL; duty += TEST_DUTY_STEP){
+                WavePwmEdges(&pwm, phase, duty, &c0v, &c1v);
+                cases++;
+                end = ((INT32U)phase + duty > WAVE_PWM_EDGE_FULL) ? WAVE_PWM_EDGE_FULL : ((INT32U)phase + duty);
+                if(llabs(((INT64S)c0v * WAVE_PWM_EDGE_FULL) - ((INT64S)counts * phase)) >
+                   (INT64S)(WAVE_PWM_EDGE_FULL / 2u)){
+                    bad++;
+                }else{
+                }
+                if((((counts * end) / WAVE_PWM_EDGE_FULL) <= 0xFFFFu) &&
+                   (llabs(((INT64S)c1v * WAVE_PWM_EDGE_FULL) - ((INT64S)counts * end)) >
+                    (INT64S)(WAVE_PWM_EDGE_FULL / 2u))){
+                    bad++;
+                }else{
+                }
+                bad += (c1v < c0v) ? 1u : 0u;
+            }
+        }
+    }
+    printf("%u pulse edge cases, %u more than half a count off or out of order\n", cases, bad);
+    HOST_CHECK(bad == 0);
+}
+
+/****************************************************************************
+ * testDeadtime() - Private
+ * WavePwmDeadtime() decoded to bus clocks, DTVAL times the DTPS divider,
+ * against ns * WAVE_PWM_BUS_CLK / 10^9, compared in ns * 10^9 / bus clock
+ * units to stay exact.
+ ****************************************************************************/
+static void testDeadtime(void){
+    INT64U want;
+    INT64U have;
+    INT32U ns;
+    INT32U div;
+    INT32U clocks;
+    INT32U bad = 0;
+    INT8U reg;
+
+    for(ns = 0; ns <= TEST_DT_MAX_NS; ns++){
+        reg = WavePwmDeadtime(ns);
+        div = ((reg >> 6) == 3u) ? 16u : (((reg >> 6) == 2u) ? 4u : 1u);
+        clocks = (reg & 0x3Fu) * div;
+        want = (INT64U)ns * WAVE_PWM_BUS_CLK;               /* clocks * 10^9 */
+        have = (INT64U)clocks * 1000000000u;
+        if((have < want) && (clocks != TEST_DT_LONGEST)){
+            bad++;                                          /* short */
+        }else{
+        }
+        if((div > 1u) && (want <= ((INT64U)63u * (div / 4u) * 1000000000u))){
+            bad++;                                          /* a finer divider reached it */
+        }else{
+        }
+        if((have >= want) && ((have - want) >= ((INT64U)div * 1000000000u))){
+            bad++;                                          /* a step or more over */
+        }else{
+        }
+    }
+    printf("dead time 0 to %u ns, %u short, a step over or not on the finest divider\n", TEST_DT_MAX_NS, bad);
+    HOST_CHECK(bad == 0);
+}
@@ -0,0 +1,98 @@
+/****************************************************************************
+ * TestWaveRing.c
+ * Host test of the DMA block ring bookkeeping in WaveRing.c. For rings of
+ * 2 to TEST_MAX_BLOCKS blocks it interleaves DMA block completions and
+ * producer fills at random, with the DMA sometimes finishing a block while
+ * the producer is rendering, and the producer slowing down as the run goes
+ * on so overruns occur. It checks:
+ *  - every block the DMA starts without a refill is a counted overrun
+ *  - the producer is never handed the playing block
+ *  - free never passes num_blocks-1
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveRing.h"
+#include "HostTest.h"
+
+#define TEST_MAX_BLOCKS     8u
+#define TEST_STEPS          400000u
+#define TEST_SLOWDOWN       100000u     /* steps per producer slowdown      */
+
+static void testDone(WAVE_RING *ring);
+static INT32U testRand(void);
+
+static INT8U TestFresh[TEST_MAX_BLOCKS];   /* rendered since it last played */
+static INT32U TestStale;
+static INT32U TestSeed = 1;
+
+int main(void){
+    WAVE_RING ring;
+    INT32U num;
+    INT32U t;
+    INT32U fills;
+    INT32U ignored;
+    INT16U index;
+    INT16U free_before;
+    INT16U k;
+
+    for(num = 2; num <= TEST_MAX_BLOCKS; num++){
+        WaveRingInit(&ring, (INT16U)num);
+        for(k = 0; k < num; k++){
+            TestFresh[k] = TRUE;
+        }
+        TestFresh[0] = FALSE;                       /* playing */
+        TestStale = 0;
+        fills = 0;
+        ignored = 0;
+        for(t = 0; t < TEST_STEPS; t++){
+            if((testRand() % 3u) == 0){
+                testDone(&ring);
+            }else{
+            }
+            if(((testRand() % (1u + (t / TEST_SLOWDOWN))) == 0) && (WaveRingNextFill(&ring, &index) == TRUE)){
+                HOST_CHECK(index != ring.play);
+                if((testRand() % 5u) == 0){         /* DMA moves on during the render */
+                    testDone(&ring);
+                }else{
+                }
+                if(index != ring.play){
+                    TestFresh[index] = TRUE;
+                }else{
+                }
+                free_before = ring.free;
+                WaveRingFilled(&ring, index);
+                if(ring.free == free_before){
+                    ignored++;
+                }else{
+                    fills++;
+                }
+            }else{
+            }
+            HOST_CHECK(ring.free <= (num - 1u));
+        }
+        printf("N=%u overruns %u stale blocks %u fills %u ignored %u\n", num, ring.overruns, TestStale,
+               fills, ignored);
+        HOST_CHECK(TestStale == ring.overruns);
+        HOST_CHECK(ring.overruns > 0);
+    }
+
+    return HostTestEnd("TestWaveRing");
+}
+
+/****************************************************************************
+ * testDone() - Private
+ * The DMA finishes a block and starts the next, which is stale unless it
+ * was rendered since it last played.
+ ****************************************************************************/
+static void testDone(WAVE_RING *ring){
+    (void)WaveRingBlockDone(ring);
+    if(TestFresh[ring->play] == FALSE){
+        TestStale++;
+    }else{
+    }
+    TestFresh[ring->play] = FALSE;
+}
+
+static INT32U testRand(void){
+    TestSeed = (TestSeed * 1103515245u) + 12345u;
+    return (TestSeed >> 16) & 0x7FFFu;
+}
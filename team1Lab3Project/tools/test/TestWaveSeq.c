@@ -0,0 +1,149 @@
+/****************************************************************************
+ * TestWaveSeq.c
+ * Host test of the step sequencer in WaveSeq.c, driven as WaveRenderBlock()
+ * drives it: blocks of uneven size, each capped at TEST_MAX_CHUNK, split
+ * with WaveSeqRun() over two channels and counted off with
+ * WaveSeqAdvance().
+ *  - every transition lands on the cumulative tick count of the step
+ *    lengths, looping sequences over TEST_LOOPS passes, and one-shot
+ *    sequences stop after their last step with index num_steps, left 0
+ *    and no further transitions
+ *  - no chunk crosses a transition of either channel
+ *  - WaveSeqTicks() rounds, keeps every step at least one tick and
+ *    saturates, WaveSeqStart() holds num_steps to WAVE_SEQ_MAX_STEPS and
+ *    WaveSeqStop() stops
+ * Lengths are 1 to TEST_MAX_LEN ticks from TEST_RUNS pseudo-random runs.
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveSeq.h"
+#include "HostTest.h"
+
+#define TEST_RUNS           2000u
+#define TEST_MAX_LEN        700u
+#define TEST_MAX_CHUNK      256u        /* WAVE_PLAN_MAX_BLOCK             */
+#define TEST_MAX_BLOCK      1000u
+#define TEST_LOOPS          3u
+
+static INT32U testRun(INT8U loop);
+static INT32U testRand(void);
+
+static INT32U TestSeed = 1;
+
+int main(void){
+    WAVE_SEQ seq;
+    INT32U bad_once = 0;
+    INT32U bad_loop = 0;
+    INT32U run;
+
+    for(run = 0; run < TEST_RUNS; run++){
+        bad_once += testRun(FALSE);
+        bad_loop += testRun(TRUE);
+    }
+    printf("%u one-shot and %u looping runs over two channels, %u and %u transitions off their tick\n", TEST_RUNS,
+           TEST_RUNS, bad_once, bad_loop);
+    HOST_CHECK(bad_once == 0);
+    HOST_CHECK(bad_loop == 0);
+
+    /* Tick conversion */
+    HOST_CHECK(WaveSeqTicks(1000, 48000, 1) == 48000u);
+    HOST_CHECK(WaveSeqTicks(1, 1500, 1) == 2u);                     /* 1.5 rounds up   */
+    HOST_CHECK(WaveSeqTicks(1, 1499, 1) == 1u);
+    HOST_CHECK(WaveSeqTicks(0, 48000, 1) == 1u);
+    HOST_CHECK(WaveSeqTicks(1000, 48000, 0) == 1u);
+    HOST_CHECK(WaveSeqTicks(0xFFFFFFFFu, 200000, 1) == 0xFFFFFFFFu);
+
+    /* Start and stop */
+    seq.length[0] = 5;
+    WaveSeqStart(&seq, WAVE_SEQ_MAX_STEPS + 4u, FALSE);
+    HOST_CHECK((seq.num_steps == WAVE_SEQ_MAX_STEPS) && (seq.index == 0) && (seq.left == 5u));
+    HOST_CHECK((WaveSeqRun(&seq, 100) == 5u) && (WaveSeqRun(&seq, 3) == 3u));
+    WaveSeqStop(&seq);
+    HOST_CHECK((seq.left == 0) && (seq.index == seq.num_steps) && (WaveSeqRun(&seq, 100) == 100u));
+    HOST_CHECK(WaveSeqAdvance(&seq, 100) == FALSE);
+    WaveSeqStart(&seq, 0, TRUE);
+    HOST_CHECK((seq.left == 0) && (WaveSeqAdvance(&seq, 1) == FALSE));
+
+    return HostTestEnd("TestWaveSeq");
+}
+
+/****************************************************************************
+ * testRun() - Private
+ * Plays two random sequences with loop through random blocks and returns
+ * the transitions that did not land on their tick, plus chunks that ran
+ * past one and one-shot sequences that did not stop cleanly.
+ ****************************************************************************/
+static INT32U testRun(INT8U loop){
+    WAVE_SEQ seq[2];
+    INT32U next[2];         /* tick of the next transition */
+    INT32U passes[2] = {0, 0};
+    INT32U total = 0;
+    INT32U end;
+    INT32U block;
+    INT32U chunk;
+    INT32U bad = 0;
+    INT8U steps[2];
+    INT8U ch;
+    INT8U i;
+
+    end = 0;
+    for(ch = 0; ch < 2u; ch++){
+        steps[ch] = (INT8U)((testRand() % WAVE_SEQ_MAX_STEPS) + 1u);
+        for(i = 0; i < steps[ch]; i++){
+            seq[ch].length[i] = (testRand() % TEST_MAX_LEN) + 1u;
+        }
+        WaveSeqStart(&seq[ch], steps[ch], loop);
+        next[ch] = seq[ch].length[0];
+    }
+    for(ch = 0; ch < 2u; ch++){
+        block = 0;
+        for(i = 0; i < steps[ch]; i++){
+            block += seq[ch].length[i];
+        }
+        block *= (loop == TRUE) ? TEST_LOOPS : 1u;
+        end = (block > end) ? block : end;
+    }
+    end += TEST_MAX_BLOCK;
+    while(total < end){
+        block = (testRand() % TEST_MAX_BLOCK) + 1u;
+        while(block > 0){
+            chunk = (block > TEST_MAX_CHUNK) ? TEST_MAX_CHUNK : block;
+            for(ch = 0; ch < 2u; ch++){
+                chunk = WaveSeqRun(&seq[ch], chunk);
+            }
+            for(ch = 0; ch < 2u; ch++){
+                if((seq[ch].left > 0) && ((total + chunk) > next[ch])){
+                    bad++;                                  /* ran past a transition */
+                }else{
+                }
+                if(WaveSeqAdvance(&seq[ch], chunk) == TRUE){
+                    bad += ((total + chunk) != next[ch]) ? 1u : 0u;
+                    if(seq[ch].index == 0){
+                        passes[ch]++;
+                    }else{
+                    }
+                    next[ch] += seq[ch].left;
+                }else{
+                }
+            }
+            total += chunk;
+            block -= chunk;
+        }
+    }
+    for(ch = 0; ch < 2u; ch++){
+        if(loop == TRUE){
+            bad += ((passes[ch] < TEST_LOOPS) || (seq[ch].left == 0)) ? 1u : 0u;
+        }else{
+            bad += ((seq[ch].index != steps[ch]) || (seq[ch].left != 0) || (passes[ch] != 0)) ? 1u : 0u;
+        }
+    }
+    return bad;
+}
+
+/****************************************************************************
+ * testRand() - Private
+ * 15 bits of an LCG, the same sequence on every host.
+ ****************************************************************************/
+static INT32U testRand(void){
+    TestSeed = (TestSeed * 1103515245u) + 12345u;
+    return (TestSeed >> 16) & 0x7FFFu;
+}
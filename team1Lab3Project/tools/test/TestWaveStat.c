@@ -0,0 +1,96 @@
+/****************************************************************************
+ * TestWaveStat.c
+ * Host test of the running statistics in WaveStat.c that GetSinStats()
+ * reports.
+ *  - min, avg and max of TEST_RUNS pseudo-random runs of slack-like
+ *    values, negative ones included, match a direct pass over the values.
+ *    The average truncates toward zero like the divide in WaveStatAvg()
+ *  - TEST_BIG values at each end of the INT32S range average exactly,
+ *    the 64-bit sum does not wrap
+ *  - a reset, or no values, reads back count, min, avg and max 0, and the
+ *    first value after a reset is both min and max
+ ****************************************************************************/
+#include "MCUType.h"
+#include "WaveStat.h"
+#include "HostTest.h"
+
+#define TEST_RUNS           1000u
+#define TEST_MAX_LEN        500u        /* values per run                    */
+#define TEST_SPAN           200000      /* values from -SPAN/2 to SPAN/2     */
+#define TEST_BIG            100000u
+
+static INT32U testRand(void);
+
+static INT32S TestVals[TEST_MAX_LEN];
+static INT32U TestSeed = 1;
+
+int main(void){
+    WAVE_STAT stat;
+    INT32U run;
+    INT32U len;
+    INT32U i;
+    INT32U bad = 0;
+    INT32S min;
+    INT32S max;
+    INT64S sum;
+
+    for(run = 0; run < TEST_RUNS; run++){
+        WaveStatReset(&stat);
+        len = (testRand() % TEST_MAX_LEN) + 1u;
+        min = 0x7FFFFFFF;
+        max = -0x7FFFFFFF - 1;
+        sum = 0;
+        for(i = 0; i < len; i++){
+            TestVals[i] = (INT32S)(testRand() << 15);
+            TestVals[i] = (INT32S)(((INT32U)TestVals[i] | testRand()) % (TEST_SPAN + 1u)) - (TEST_SPAN / 2);
+            WaveStatAdd(&stat, TestVals[i]);
+            min = (TestVals[i] < min) ? TestVals[i] : min;
+            max = (TestVals[i] > max) ? TestVals[i] : max;
+            sum += TestVals[i];
+        }
+        if((stat.count != len) || (stat.min != min) || (stat.max != max) ||
+           (WaveStatAvg(&stat) != (INT32S)(sum / (INT64S)len))){
+            bad++;
+        }else{
+        }
+    }
+    printf("%u runs of up to %u values, %u with the wrong count, min, avg or max\n", TEST_RUNS, TEST_MAX_LEN,
+           bad);
+    HOST_CHECK(bad == 0);
+
+    /* Ends of the range */
+    WaveStatReset(&stat);
+    for(i = 0; i < TEST_BIG; i++){
+        WaveStatAdd(&stat, 0x7FFFFFFF);
+    }
+    HOST_CHECK((WaveStatAvg(&stat) == 0x7FFFFFFF) && (stat.min == 0x7FFFFFFF) && (stat.max == 0x7FFFFFFF));
+    WaveStatReset(&stat);
+    for(i = 0; i < TEST_BIG; i++){
+        WaveStatAdd(&stat, -0x7FFFFFFF - 1);
+    }
+    HOST_CHECK(WaveStatAvg(&stat) == (-0x7FFFFFFF - 1));
+    WaveStatAdd(&stat, 0x7FFFFFFF);
+    HOST_CHECK((stat.min == (-0x7FFFFFFF - 1)) && (stat.max == 0x7FFFFFFF));
+
+    /* Reset and the first value after it */
+    WaveStatReset(&stat);
+    HOST_CHECK((stat.count == 0) && (stat.min == 0) && (stat.max == 0) && (WaveStatAvg(&stat) == 0));
+    WaveStatAdd(&stat, 1234);
+    HOST_CHECK((stat.min == 1234) && (stat.max == 1234) && (WaveStatAvg(&stat) == 1234));
+    WaveStatReset(&stat);
+    WaveStatAdd(&stat, -5);
+    HOST_CHECK((stat.count == 1u) && (stat.min == -5) && (stat.max == -5) && (WaveStatAvg(&stat) == -5));
+    WaveStatAdd(&stat, 2);
+    HOST_CHECK(WaveStatAvg(&stat) == -1);
+
+    return HostTestEnd("TestWaveStat");
+}
+
+/****************************************************************************
+ * testRand() - Private
+ * 15 bits of an LCG, the same sequence on every host.
+ ****************************************************************************/
+static INT32U testRand(void){
+    TestSeed = (TestSeed * 1103515245u) + 12345u;
+    return (TestSeed >> 16) & 0x7FFFu;
+}
@@ -0,0 +1,126 @@
+/****************************************************************************
+ * TestWaveSweep.c
+ * Host test of the sweeps in WaveSweep.c and the chirp loops in WaveDDS.c.
+ * Every sweep in TestSweeps runs linear and logarithmic.
+ *  - the phase advance of each sample, the frequency the DDS actually
+ *    plays, stays within TEST_MAX_FREQ_ERR of the ideal law, f1 + (f2 - f1)t
+ *    or f1 (f2/f1)^t
+ *  - the sweep ends on the exact stop step after its planned number of
+ *    samples, then plays DDSSineBlock() at that step, short sweeps over
+ *    wide ranges included
+ *  - uneven blocks give the same samples as one long block
+ ****************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveSweep.h"
+#include "HostTest.h"
+
+#define TEST_MAX_FREQ_ERR   2.0e-5      /* relative, against the ideal law   */
+#define TEST_MAX_SAMPLES    480000u     /* longest sweep in TestSweeps       */
+#define TEST_TAIL           64u         /* samples checked past the end      */
+#define TEST_LOG_MIN        18u         /* ceil(ln(1000)/0.4), WaveSweep.c   */
+
+typedef struct {
+    INT32U start;           /* Hz */
+    INT32U stop;
+    INT32U ms;
+    INT32U rate;
+} TEST_SWEEP;
+
+static FP64 testSweep(const TEST_SWEEP *tcase, WAVE_SWEEP_LAW law, INT32U *num, INT32U *bad);
+
+static const TEST_SWEEP TestSweeps[] = {
+    {10, 10000, 1000, 48000}, {10000, 10, 1000, 48000}, {20, 20000, 5000, 96000}, {1000, 1001, 100, 48000},
+    {440, 880, 2, 200000}, {100, 3000, 50, 8000}, {10, 10000, 0, 48000}, {10000, 10, 0, 48000}
+};
+static INT16S TestWhole[TEST_MAX_SAMPLES + TEST_TAIL];
+static INT16S TestSplit[TEST_MAX_SAMPLES + TEST_TAIL];
+
+int main(void){
+    INT32U i;
+    INT32U num;
+    INT32U bad;
+    INT32U end_bad = 0;
+    INT32U law;
+    FP64 err;
+    FP64 max_err[2] = {0.0, 0.0};
+    static const char *names[2] = {"lin", "log"};
+
+    for(i = 0; i < (sizeof(TestSweeps) / sizeof(TestSweeps[0])); i++){
+        for(law = 0; law < 2u; law++){
+            err = testSweep(&TestSweeps[i], (WAVE_SWEEP_LAW)law, &num, &bad);
+            printf("%5u Hz to %5u Hz in %4u ms at %6u S/s, %s: %6u samples, worst %.2e\n", TestSweeps[i].start,
+                   TestSweeps[i].stop, TestSweeps[i].ms, TestSweeps[i].rate, names[law], num, err);
+            max_err[law] = (err > max_err[law]) ? err : max_err[law];
+            end_bad += bad;
+        }
+    }
+    printf("worst instantaneous frequency error: linear %.2e, log %.2e\n", max_err[0], max_err[1]);
+    printf("%u sweeps off the stop step or the planned length\n", end_bad);
+    HOST_CHECK(max_err[0] <= TEST_MAX_FREQ_ERR);
+    HOST_CHECK(max_err[1] <= TEST_MAX_FREQ_ERR);
+    HOST_CHECK(end_bad == 0);
+
+    return HostTestEnd("TestWaveSweep");
+}
+
+/****************************************************************************
+ * testSweep() - Private
+ * Runs tcase with law one sample at a time, then in uneven blocks, and
+ * returns the worst relative error of the played frequency against the
+ * ideal law. num is the sweep length in samples. bad counts a sweep that
+ * does not end on the stop step after num samples, does not hold it after,
+ * or whose blocks differ from the single samples.
+ ****************************************************************************/
+static FP64 testSweep(const TEST_SWEEP *tcase, WAVE_SWEEP_LAW law, INT32U *num, INT32U *bad){
+    WAVE_SWEEP sweep;
+    WAVE_SWEEP split;
+    INT32U phase = 0;
+    INT32U ph = 0;
+    INT32U last;
+    INT32U stop_step = DDSPhaseStep(tcase->stop, tcase->rate);
+    INT32U n;
+    INT32U len;
+    FP64 t;
+    FP64 f;
+    FP64 ideal;
+    FP64 err;
+    FP64 max_err = 0.0;
+
+    *bad = 0;
+    WaveSweepStart(&sweep, tcase->start, tcase->stop, tcase->ms, tcase->rate, law);
+    split = sweep;
+    *num = sweep.remaining;
+    if((law == WAVE_SWEEP_LOG) && (tcase->ms == 0)){
+        *bad += (*num != TEST_LOG_MIN) ? 1u : 0u;
+    }else{
+    }
+    for(n = 0; n < (*num + TEST_TAIL); n++){
+        last = phase;
+        WaveSweepBlock(&sweep, &phase, &TestWhole[n], 1);
+        if(n < *num){
+            t = (FP64)n / *num;
+            f = (FP64)(phase - last) * tcase->rate / 4294967296.0;
+            if(law == WAVE_SWEEP_LOG){
+                ideal = tcase->start * pow((FP64)tcase->stop / tcase->start, t);
+            }else{
+                ideal = tcase->start + ((FP64)((INT32S)tcase->stop - (INT32S)tcase->start) * t);
+            }
+            err = fabs(f - ideal) / ideal;
+            max_err = (err > max_err) ? err : max_err;
+            *bad += ((n == (*num - 1u)) && (sweep.remaining != 0)) ? 1u : 0u;
+        }else{
+            *bad += (((phase - last) != stop_step) || (sweep.step != ((INT64U)stop_step << 32))) ? 1u : 0u;
+        }
+    }
+    for(n = 0; n < (*num + TEST_TAIL); n += len){
+        len = ((n * 7u) % 97u) + 1u;
+        len = (len < (*num + TEST_TAIL - n)) ? len : (*num + TEST_TAIL - n);
+        WaveSweepBlock(&split, &ph, &TestSplit[n], len);
+    }
+    *bad += ((ph != phase) || (memcmp(&TestSplit[0], &TestWhole[0], (*num + TEST_TAIL) * sizeof(INT16S)) != 0)) ?
+            1u : 0u;
+    return max_err;
+}
@@ -0,0 +1,158 @@
+/****************************************************************************
+ * TestWaveTone.c
+ * Host test of the resonator tones in WaveTone.c, rendered in TEST_BLOCK
+ * sample blocks with the phase advanced between them as WaveGen.c does.
+ *  - 8 harmonics of TEST_FREQ at TEST_RATE against the exact sum of their
+ *    sines, within TEST_MAX_RMS LSB rms and TEST_MAX_PEAK LSB peak
+ *  - a single TEST_SLOW_FREQ tone at full scale within TEST_MAX_SLOW LSB
+ *  - WaveToneSet() drops harmonic 0 and tones past WAVE_TONE_MAX, clamps
+ *    each amplitude to 32767 and scales a set summing past full scale
+ *    down in proportion, so all tones peaking together do not wrap
+ *  - tones at or above half the sample rate are silent and leave the
+ *    others as they were
+ ****************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "MCUType.h"
+#include "WaveDDS.h"
+#include "WaveTone.h"
+#include "HostTest.h"
+
+#define TEST_RATE           96000u
+#define TEST_FREQ           1000u
+#define TEST_BLOCK          240u
+#define TEST_LEN            (TEST_RATE / 4u)        /* 250 ms             */
+#define TEST_SLOW_FREQ      1u
+#define TEST_SLOW_LEN       (2u * TEST_RATE)        /* two periods        */
+#define TEST_MAX_RMS        1.0                     /* LSB Q15            */
+#define TEST_MAX_PEAK       3.7
+#define TEST_MAX_SLOW       3.0
+#define TEST_PI             3.14159265358979323846
+
+static void testRender(WAVE_TONES *tones, INT32U step, INT16S *out, INT32U len);
+static FP64 testExact(const WAVE_TONES *tones, INT32U n, INT32U step);
+
+static const WAVE_TONE_SET TestEight[8] = {
+    {1, 8000, 0}, {2, 6000, 5000}, {3, 5000, 20000}, {4, 4000, 0}, {5, 3000, 40000}, {6, 2500, 0},
+    {7, 2000, 60000}, {8, 1500, 0}
+};
+static INT16S TestOut[TEST_SLOW_LEN];
+static INT16S TestRef[TEST_LEN];
+
+int main(void){
+    static const WAVE_TONE_SET slow[1] = {{1, 32767, 0}};
+    static const WAVE_TONE_SET loud[10] = {             /* all peak at phase 0 */
+        {1, 32767, 16384}, {0, 30000, 16384}, {2, 40000, 16384}, {3, 16384, 16384}, {4, 16384, 16384},
+        {5, 8192, 16384}, {6, 8192, 16384}, {7, 4096, 16384}, {8, 4096, 16384}, {9, 4096, 16384}
+    };
+    static const WAVE_TONE_SET nyquist[2] = {{1, 10000, 0}, {30, 10000, 0}};
+    WAVE_TONES tones;
+    INT32U step = DDSPhaseStep(TEST_FREQ, TEST_RATE);
+    INT32U n;
+    INT32U i;
+    INT32S sum = 0;
+    INT32S peak = 0;
+    INT32U bad = 0;
+    FP64 err;
+    FP64 sq = 0.0;
+    FP64 max_err = 0.0;
+
+    /* Eight tones against the exact sum */
+    WaveToneSet(&tones, &TestEight[0], 8);
+    testRender(&tones, step, &TestOut[0], TEST_LEN);
+    for(n = 0; n < TEST_LEN; n++){
+        err = fabs(TestOut[n] - testExact(&tones, n, step));
+        sq += err * err;
+        max_err = (err > max_err) ? err : max_err;
+    }
+    printf("8 tones of %u Hz at %u S/s: %.2f LSB rms, %.2f LSB peak\n", TEST_FREQ, TEST_RATE, sqrt(sq / TEST_LEN),
+           max_err);
+    HOST_CHECK(sqrt(sq / TEST_LEN) <= TEST_MAX_RMS);
+    HOST_CHECK(max_err <= TEST_MAX_PEAK);
+
+    /* A slow tone */
+    step = DDSPhaseStep(TEST_SLOW_FREQ, TEST_RATE);
+    WaveToneSet(&tones, &slow[0], 1);
+    testRender(&tones, step, &TestOut[0], TEST_SLOW_LEN);
+    max_err = 0.0;
+    for(n = 0; n < TEST_SLOW_LEN; n++){
+        err = fabs(TestOut[n] - testExact(&tones, n, step));
+        max_err = (err > max_err) ? err : max_err;
+    }
+    printf("%u Hz at full scale: %.2f LSB peak\n", TEST_SLOW_FREQ, max_err);
+    HOST_CHECK(max_err <= TEST_MAX_SLOW);
+
+    /* Headroom scaling */
+    WaveToneSet(&tones, &loud[0], 10);
+    HOST_CHECK(tones.num_tones == WAVE_TONE_MAX);
+    for(i = 0; i < tones.num_tones; i++){
+        sum += tones.amp[i];
+        bad += (tones.harmonic[i] != (i + 1u)) ? 1u : 0u;
+    }
+    printf("%u Q15 of tones summing to %d after scaling\n", 32767u + 32767u + 16384u + 16384u + 8192u + 8192u +
+           4096u + 4096u, sum);
+    HOST_CHECK(bad == 0);
+    HOST_CHECK((sum <= 32767) && (sum > (32767 - (2 * (INT32S)WAVE_TONE_MAX))));
+    HOST_CHECK(tones.amp[0] == tones.amp[1]);
+    HOST_CHECK((abs(tones.amp[2] - (2 * tones.amp[4])) <= 1) && (abs(tones.amp[4] - (2 * tones.amp[6])) <= 1));
+    testRender(&tones, step, &TestOut[0], TEST_LEN);
+    for(n = 0; n < TEST_LEN; n++){
+        peak = (abs(TestOut[n]) > peak) ? abs(TestOut[n]) : peak;
+    }
+    printf("all tones in phase: first sample %d, loudest %d\n", TestOut[0], peak);
+    HOST_CHECK((TestOut[0] >= (sum - (INT32S)WAVE_TONE_MAX)) && (peak == TestOut[0]));
+
+    /* Tones at and above half the rate */
+    step = DDSPhaseStep(TEST_FREQ * 4u, TEST_RATE);                /* harmonic 30 is 120 kHz */
+    WaveToneSet(&tones, &nyquist[1], 1);
+    testRender(&tones, step, &TestOut[0], TEST_LEN);
+    for(n = 0; (n < TEST_LEN) && (TestOut[n] == 0); n++){
+    }
+    HOST_CHECK(n == TEST_LEN);
+    WaveToneSet(&tones, &nyquist[0], 1);
+    testRender(&tones, step, &TestRef[0], TEST_LEN);
+    WaveToneSet(&tones, &nyquist[0], 2);
+    testRender(&tones, step, &TestOut[0], TEST_LEN);
+    for(n = 0; (n < TEST_LEN) && (TestOut[n] == TestRef[n]); n++){
+    }
+    HOST_CHECK(n == TEST_LEN);
+    step = 0x80000000u / 30u;
+    WaveToneSet(&tones, &nyquist[1], 1);
+    testRender(&tones, step + 1u, &TestOut[0], TEST_BLOCK);        /* just over half the rate */
+    for(n = 0; (n < TEST_BLOCK) && (TestOut[n] == 0); n++){
+    }
+    HOST_CHECK(n == TEST_BLOCK);
+
+    return HostTestEnd("TestWaveTone");
+}
+
+/****************************************************************************
+ * testRender() - Private
+ * len samples of tones at step from phase 0, in TEST_BLOCK sample blocks.
+ ****************************************************************************/
+static void testRender(WAVE_TONES *tones, INT32U step, INT16S *out, INT32U len){
+    INT32U phase = 0;
+    INT32U n;
+
+    for(n = 0; n < len; n += TEST_BLOCK){
+        WaveToneRender(tones, phase, step, &out[n], TEST_BLOCK);
+        phase += step * TEST_BLOCK;
+    }
+}
+
+/****************************************************************************
+ * testExact() - Private
+ * The sum of the tones at sample n, from phase 0 at step, with their
+ * scaled amplitudes.
+ ****************************************************************************/
+static FP64 testExact(const WAVE_TONES *tones, INT32U n, INT32U step){
+    FP64 sum = 0.0;
+    FP64 ph;
+    INT32U t;
+
+    for(t = 0; t < tones->num_tones; t++){
+        ph = (((FP64)n * step * tones->harmonic[t]) + tones->phase[t]) / 4294967296.0;
+        sum += tones->amp[t] * sin(2.0 * TEST_PI * ph);
+    }
+    return sum;
+}
@@ -50,6 +50,7 @@
 #define APP_CFG_TSI_CNTR_TASK_PRIO        12u
 #define APP_CFG_PULSE_WAVE_TASK_PRIO      14u
 #define APP_CFG_PROCESSING_TASK_PRIO      16u
+#define APP_CFG_ANALYZER_TASK_PRIO        18u
 
 /*
 *********************************************************************************************************
@@ -63,7 +64,17 @@
 #define APP_CFG_TSI_TASK_STK_SIZE            128u
 #define APP_CFG_TSI_CNTR_TASK_STK_SIZE       128u
 #define APP_CFG_DISP_TASK_STK_SIZE	         128u
-#define APP_CFG_PULSE_WAVE_TASK_STK_SIZE     128u
-#define APP_CFG_PROC_TASK_STK_SIZE           128u
+#define APP_CFG_PULSE_WAVE_TASK_STK_SIZE     256u
+#define APP_CFG_PROC_TASK_STK_SIZE           512u
+#define APP_CFG_ANALYZER_TASK_STK_SIZE       256u
+
+/*
+*********************************************************************************************************
+*                                            WAVEFORM DMA RING
+*********************************************************************************************************
+*/
+#define APP_CFG_WAVE_NUM_BLOCKS              4u     /* DMA blocks in the DAC ring, >= 2          */
+#define APP_CFG_WAVE_MAX_BLOCK               512u   /* largest block the planner uses, samples   */
+#define APP_CFG_WAVE_DAC_FIFO                1u     /* 1 DAC buffers refilled by DMA bursts, 0 PIT per sample */
 
 #endif